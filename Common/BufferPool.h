@@ -0,0 +1,298 @@
+﻿#pragma once
+#include "NetPlatform.h"
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <new>
+#include <cstdint>
+#include <cstddef>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
+#define BUFFER_POOL_MIN_SHIFT 8                    // 가장 작은 크기 등급: 256 bytes
+#define BUFFER_POOL_CLASS_COUNT 10                 // 256 ~ 128KB (2배씩 증가)
+#define BUFFER_POOL_ARENA_SIZE (2 * 1024 * 1024)   // OS에서 한 번에 받아오는 크기 (huge page 한 장)
+#define BUFFER_POOL_CACHE_LIMIT 64                 // 스레드 캐시가 등급별로 들고 있는 최대 블록 수
+#define BUFFER_POOL_TRANSFER_COUNT 32              // 스레드 캐시 <-> 전역 목록 사이에 한 번에 옮기는 블록 수
+
+// 크기 등급별 통계
+struct BufferPoolStats {
+    uint64_t hits;       // 스레드 캐시나 전역 목록에서 재사용
+    uint64_t misses;     // 아레나에서 새로 잘라냄
+    uint64_t oversize;   // 가장 큰 등급보다 커서 풀을 거치지 않음
+    uint64_t arena_bytes;
+    bool huge_pages;     // 아레나가 huge page로 할당되었는지 (한 번이라도 성공했으면 true)
+};
+
+// 네트워크 버퍼용 크기 등급별 메모리 풀 (프레임, Task/응답 페이로드, 연결별 링 버퍼)
+// - 요청 크기를 2의 거듭제곱 등급으로 올려 해당 등급의 빈 블록을 재사용한다.
+// - 스레드마다 등급별 캐시를 두어 대부분의 할당/해제는 잠금 없이 처리하고,
+//   캐시가 비거나 넘칠 때만 전역 목록과 BUFFER_POOL_TRANSFER_COUNT개씩 주고받는다.
+// - 메모리는 BUFFER_POOL_ARENA_SIZE 단위 아레나에서 잘라 쓰며 프로세스 종료까지 OS에 돌려주지 않는다.
+// - EnableHugePages(true)면 아레나를 huge page(Linux MAP_HUGETLB, Windows MEM_LARGE_PAGES)로 먼저 시도한다.
+class BufferPool
+{
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    struct ThreadCache {
+        FreeBlock* heads[BUFFER_POOL_CLASS_COUNT];
+        uint32_t counts[BUFFER_POOL_CLASS_COUNT];
+
+        ThreadCache() {
+            for (int i = 0; i < BUFFER_POOL_CLASS_COUNT; ++i) {
+                heads[i] = nullptr;
+                counts[i] = 0;
+            }
+        }
+
+        // 스레드가 끝나면 들고 있던 블록을 전역 목록으로 반납
+        ~ThreadCache() {
+            for (int i = 0; i < BUFFER_POOL_CLASS_COUNT; ++i) {
+                if (heads[i] != nullptr) {
+                    BufferPool::Instance().PushGlobal(i, heads[i], counts[i]);
+                }
+            }
+        }
+    };
+
+    std::mutex _global_mutex;
+    FreeBlock* _global_heads[BUFFER_POOL_CLASS_COUNT];
+    uint32_t _global_counts[BUFFER_POOL_CLASS_COUNT];
+    uint8_t* _arena_cursor;
+    size_t _arena_left;
+
+    std::atomic<bool> _use_huge_pages;
+    std::atomic<bool> _huge_pages_active;
+    std::atomic<uint64_t> _hits[BUFFER_POOL_CLASS_COUNT];
+    std::atomic<uint64_t> _misses[BUFFER_POOL_CLASS_COUNT];
+    std::atomic<uint64_t> _oversize;
+    std::atomic<uint64_t> _arena_bytes;
+
+    BufferPool()
+        : _arena_cursor(nullptr), _arena_left(0), _use_huge_pages(false), _huge_pages_active(false),
+        _oversize(0), _arena_bytes(0) {
+        for (int i = 0; i < BUFFER_POOL_CLASS_COUNT; ++i) {
+            _global_heads[i] = nullptr;
+            _global_counts[i] = 0;
+            _hits[i].store(0);
+            _misses[i].store(0);
+        }
+    }
+
+    static ThreadCache& LocalCache() {
+        static thread_local ThreadCache cache;
+        return cache;
+    }
+
+    static int ClassOf(size_t size) {
+        size_t classSize = static_cast<size_t>(1) << BUFFER_POOL_MIN_SHIFT;
+        for (int i = 0; i < BUFFER_POOL_CLASS_COUNT; ++i) {
+            if (size <= classSize) {
+                return i;
+            }
+            classSize <<= 1;
+        }
+        return -1;
+    }
+
+    // 아레나 하나를 OS에서 받아옴 (_global_mutex를 잡은 상태)
+    uint8_t* MapArena() {
+        void* memory = nullptr;
+#ifdef _WIN32
+        if (_use_huge_pages.load() && GetLargePageMinimum() != 0) {
+            memory = VirtualAlloc(nullptr, BUFFER_POOL_ARENA_SIZE, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+            if (memory != nullptr) {
+                _huge_pages_active.store(true);
+            }
+        }
+        if (memory == nullptr) {
+            memory = VirtualAlloc(nullptr, BUFFER_POOL_ARENA_SIZE, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+        }
+#else
+        if (_use_huge_pages.load()) {
+#ifdef MAP_HUGETLB
+            memory = mmap(nullptr, BUFFER_POOL_ARENA_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (memory == MAP_FAILED) {
+                memory = nullptr;
+            }
+            else {
+                _huge_pages_active.store(true);
+            }
+#endif
+        }
+        if (memory == nullptr) {
+            memory = mmap(nullptr, BUFFER_POOL_ARENA_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (memory == MAP_FAILED) {
+                memory = nullptr;
+            }
+#ifdef MADV_HUGEPAGE
+            else if (_use_huge_pages.load()) {
+                // 예약된 huge page가 없으면 투명 huge page라도 쓰도록 요청
+                madvise(memory, BUFFER_POOL_ARENA_SIZE, MADV_HUGEPAGE);
+            }
+#endif
+        }
+#endif
+        if (memory != nullptr) {
+            _arena_bytes.fetch_add(BUFFER_POOL_ARENA_SIZE);
+        }
+        return static_cast<uint8_t*>(memory);
+    }
+
+    // 전역 목록에서 최대 BUFFER_POOL_TRANSFER_COUNT개를 가져오고, 없으면 아레나에서 잘라냄
+    FreeBlock* PopGlobal(int sizeClass, uint32_t* count) {
+        size_t blockSize = static_cast<size_t>(1) << (BUFFER_POOL_MIN_SHIFT + sizeClass);
+        std::lock_guard<std::mutex> lock(_global_mutex);
+
+        if (_global_heads[sizeClass] != nullptr) {
+            FreeBlock* head = _global_heads[sizeClass];
+            FreeBlock* tail = head;
+            uint32_t taken = 1;
+            while (taken < BUFFER_POOL_TRANSFER_COUNT && tail->next != nullptr) {
+                tail = tail->next;
+                ++taken;
+            }
+            _global_heads[sizeClass] = tail->next;
+            _global_counts[sizeClass] -= taken;
+            tail->next = nullptr;
+            *count = taken;
+            _hits[sizeClass].fetch_add(1, std::memory_order_relaxed);
+            return head;
+        }
+
+        // 새 블록을 잘라냄 (작은 등급은 여러 개를 한꺼번에)
+        FreeBlock* head = nullptr;
+        uint32_t carved = 0;
+        while (carved < BUFFER_POOL_TRANSFER_COUNT) {
+            if (_arena_left < blockSize) {
+                if (carved > 0) {
+                    break;  // 이번에는 잘라낸 만큼만 넘김 (남은 자투리는 다음에 새 아레나를 받을 때 버려짐)
+                }
+                _arena_cursor = MapArena();
+                if (_arena_cursor == nullptr) {
+                    _arena_left = 0;
+                    return nullptr;
+                }
+                _arena_left = BUFFER_POOL_ARENA_SIZE;
+            }
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(_arena_cursor);
+            _arena_cursor += blockSize;
+            _arena_left -= blockSize;
+            block->next = head;
+            head = block;
+            ++carved;
+        }
+        *count = carved;
+        _misses[sizeClass].fetch_add(1, std::memory_order_relaxed);
+        return head;
+    }
+
+    void PushGlobal(int sizeClass, FreeBlock* head, uint32_t count) {
+        FreeBlock* tail = head;
+        while (tail->next != nullptr) {
+            tail = tail->next;
+        }
+        std::lock_guard<std::mutex> lock(_global_mutex);
+        tail->next = _global_heads[sizeClass];
+        _global_heads[sizeClass] = head;
+        _global_counts[sizeClass] += count;
+    }
+
+public:
+    static BufferPool& Instance() {
+        static BufferPool instance;
+        return instance;
+    }
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    // 이후 새로 받는 아레나부터 적용 (서버 시작 전에 호출)
+    void EnableHugePages(bool enable) {
+        _use_huge_pages.store(enable);
+    }
+
+    // size 이상의 블록 반환 (실제 크기는 Capacity(size))
+    void* Allocate(size_t size) {
+        int sizeClass = ClassOf(size);
+        if (sizeClass < 0) {
+            _oversize.fetch_add(1, std::memory_order_relaxed);
+            return ::operator new(size);
+        }
+
+        ThreadCache& cache = LocalCache();
+        if (cache.heads[sizeClass] == nullptr) {
+            uint32_t count = 0;
+            FreeBlock* batch = PopGlobal(sizeClass, &count);
+            if (batch == nullptr) {
+                throw std::bad_alloc();
+            }
+            cache.heads[sizeClass] = batch;
+            cache.counts[sizeClass] = count;
+        }
+        else {
+            _hits[sizeClass].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        FreeBlock* block = cache.heads[sizeClass];
+        cache.heads[sizeClass] = block->next;
+        --cache.counts[sizeClass];
+        return block;
+    }
+
+    // Allocate()에 넘긴 것과 같은 size로 호출
+    void Free(void* memory, size_t size) {
+        if (memory == nullptr) {
+            return;
+        }
+        int sizeClass = ClassOf(size);
+        if (sizeClass < 0) {
+            ::operator delete(memory);
+            return;
+        }
+
+        ThreadCache& cache = LocalCache();
+        FreeBlock* block = static_cast<FreeBlock*>(memory);
+        block->next = cache.heads[sizeClass];
+        cache.heads[sizeClass] = block;
+        ++cache.counts[sizeClass];
+
+        // 다른 스레드가 할당한 블록이 한 스레드에 계속 쌓이지 않도록 넘치면 절반을 전역으로
+        if (cache.counts[sizeClass] > BUFFER_POOL_CACHE_LIMIT) {
+            FreeBlock* head = cache.heads[sizeClass];
+            FreeBlock* tail = head;
+            for (uint32_t i = 1; i < BUFFER_POOL_TRANSFER_COUNT; ++i) {
+                tail = tail->next;
+            }
+            cache.heads[sizeClass] = tail->next;
+            cache.counts[sizeClass] -= BUFFER_POOL_TRANSFER_COUNT;
+            tail->next = nullptr;
+            PushGlobal(sizeClass, head, BUFFER_POOL_TRANSFER_COUNT);
+        }
+    }
+
+    // size를 요청했을 때 실제로 쓸 수 있는 크기
+    static size_t Capacity(size_t size) {
+        int sizeClass = ClassOf(size);
+        return sizeClass < 0 ? size : static_cast<size_t>(1) << (BUFFER_POOL_MIN_SHIFT + sizeClass);
+    }
+
+    BufferPoolStats GetStats() const {
+        BufferPoolStats stats;
+        stats.hits = 0;
+        stats.misses = 0;
+        for (int i = 0; i < BUFFER_POOL_CLASS_COUNT; ++i) {
+            stats.hits += _hits[i].load(std::memory_order_relaxed);
+            stats.misses += _misses[i].load(std::memory_order_relaxed);
+        }
+        stats.oversize = _oversize.load(std::memory_order_relaxed);
+        stats.arena_bytes = _arena_bytes.load(std::memory_order_relaxed);
+        stats.huge_pages = _huge_pages_active.load();
+        return stats;
+    }
+};
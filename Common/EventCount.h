@@ -0,0 +1,155 @@
+﻿#pragma once
+#include <atomic>
+#include <cstdint>
+
+#if defined(_WIN32)
+#include "NetPlatform.h"
+#pragma comment(lib, "Synchronization.lib")
+#elif defined(__linux__)
+#include <unistd.h>
+#include <time.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#else
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+#endif
+
+#define EVENTCOUNT_SPIN_MIN 16       // 적응형 스핀 최소 횟수
+#define EVENTCOUNT_SPIN_MAX 2048     // 적응형 스핀 최대 횟수
+
+// 잠금 없는 큐용 대기/통지 (event count)
+// - 소비자: PrepareWait()로 현재 epoch를 받은 뒤 큐를 한 번 더 확인하고, 여전히 비어 있으면 Wait(epoch)로 잠든다.
+//   그 사이에 Notify가 오면 epoch가 바뀌어 Wait가 바로 반환되므로 통지를 놓치지 않는다.
+// - 생산자: 넣은 뒤 Notify*()를 부르면 되며, 잠든 소비자가 없으면 원자 변수 하나만 읽고 끝난다.
+// - 잠들기는 Linux futex, Windows WaitOnAddress를 사용한다 (그 외 플랫폼은 condition_variable).
+// - Await()는 짧게 스핀한 뒤 잠들며, 스핀 중에 일을 찾으면 다음 스핀을 늘리고 못 찾으면 줄인다.
+class EventCount
+{
+private:
+    std::atomic<uint32_t> _epoch;
+    std::atomic<uint32_t> _waiters;
+    std::atomic<uint32_t> _spin_limit;
+#if !defined(_WIN32) && !defined(__linux__)
+    std::mutex _mutex;
+    std::condition_variable _cond;
+#endif
+
+    static void CpuRelax() {
+#if defined(_MSC_VER)
+        YieldProcessor();
+#elif defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+
+    void Park(uint32_t epoch, int timeoutMs) {
+#if defined(_WIN32)
+        WaitOnAddress(&_epoch, &epoch, sizeof(epoch), timeoutMs < 0 ? INFINITE : static_cast<DWORD>(timeoutMs));
+#elif defined(__linux__)
+        timespec timeout;
+        timeout.tv_sec = timeoutMs / 1000;
+        timeout.tv_nsec = static_cast<long>(timeoutMs % 1000) * 1000000L;
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&_epoch), FUTEX_WAIT_PRIVATE, epoch,
+            timeoutMs < 0 ? nullptr : &timeout, nullptr, 0);
+#else
+        std::unique_lock<std::mutex> lock(_mutex);
+        auto changed = [&] { return _epoch.load(std::memory_order_acquire) != epoch; };
+        if (timeoutMs < 0) {
+            _cond.wait(lock, changed);
+        }
+        else {
+            _cond.wait_for(lock, std::chrono::milliseconds(timeoutMs), changed);
+        }
+#endif
+    }
+
+    void Wake(bool all) {
+#if defined(_WIN32)
+        if (all) {
+            WakeByAddressAll(&_epoch);
+        }
+        else {
+            WakeByAddressSingle(&_epoch);
+        }
+#elif defined(__linux__)
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&_epoch), FUTEX_WAKE_PRIVATE, all ? INT32_MAX : 1,
+            nullptr, nullptr, 0);
+#else
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (all) {
+            _cond.notify_all();
+        }
+        else {
+            _cond.notify_one();
+        }
+#endif
+    }
+
+    void Notify(bool all) {
+        // 소비자의 PrepareWait(대기자 등록 후 epoch 읽기)와 짝을 이루는 fence
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_waiters.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+        _epoch.fetch_add(1, std::memory_order_release);
+        Wake(all);
+    }
+
+public:
+    EventCount() : _epoch(0), _waiters(0), _spin_limit(EVENTCOUNT_SPIN_MIN * 4) {}
+
+    EventCount(const EventCount&) = delete;
+    EventCount& operator=(const EventCount&) = delete;
+
+    uint32_t PrepareWait() {
+        _waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return _epoch.load(std::memory_order_acquire);
+    }
+
+    void CancelWait() {
+        _waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    // epoch가 그대로면 통지나 timeoutMs(음수면 무한)까지 잠듦
+    void Wait(uint32_t epoch, int timeoutMs) {
+        if (_epoch.load(std::memory_order_acquire) == epoch) {
+            Park(epoch, timeoutMs);
+        }
+        _waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void NotifyOne() { Notify(false); }
+    void NotifyAll() { Notify(true); }
+
+    // tryFn()이 성공할 때까지 스핀한 뒤 통지나 timeoutMs까지 한 번 잠들고 다시 시도
+    // (다른 소비자가 먼저 가져가거나 NotifyAll()로 깨어나면 timeout 전에 false를 반환할 수 있다)
+    template<typename TryFn>
+    bool Await(TryFn tryFn, int timeoutMs) {
+        uint32_t spinLimit = _spin_limit.load(std::memory_order_relaxed);
+        for (uint32_t i = 0; i < spinLimit; ++i) {
+            if (tryFn()) {
+                if (spinLimit < EVENTCOUNT_SPIN_MAX) {
+                    _spin_limit.store(spinLimit * 2, std::memory_order_relaxed);
+                }
+                return true;
+            }
+            CpuRelax();
+        }
+        if (spinLimit > EVENTCOUNT_SPIN_MIN) {
+            _spin_limit.store(spinLimit / 2, std::memory_order_relaxed);
+        }
+
+        uint32_t epoch = PrepareWait();
+        if (tryFn()) {
+            CancelWait();
+            return true;
+        }
+        Wait(epoch, timeoutMs);
+        return tryFn();
+    }
+};
@@ -1,7 +1,12 @@
 #pragma once
 #include <atomic>
 #include <memory>
+#include "EventCount.h"
 
+// 노드 방식 lock-free 큐 (Michael-Scott)
+// - 넣을 때마다 노드와 데이터를 힙에 할당하므로 기본 요청 큐는 MpmcQueue를 사용하고,
+//   이 큐는 USE_LEGACY_LOCKFREE_QUEUE 빌드에서 성능 비교용으로만 사용한다 (TaskQueue.h 참고).
+// - 꺼낸 노드를 바로 해제하므로 소비자가 여럿이면 안전하지 않다 (안전한 메모리 회수 없음).
 template<typename T>
 class LockFreeQueue {
 private:
@@ -14,16 +19,55 @@ private:
 
     std::atomic<Node*> head_;
     std::atomic<Node*> tail_;
+    EventCount not_empty_;
+
+    bool Push(T* data) {
+        Node* new_node = new Node;
+        new_node->data.store(data);
+        return PushChain(new_node, new_node);
+    }
+
+    // first부터 last까지 이미 연결된 노드들을 CAS 한 번으로 뒤에 붙임
+    bool PushChain(Node* first, Node* last_node) {
+
+        while (true) {
+            Node* last = tail_.load();
+            Node* next = last->next.load();
+
+            if (last == tail_.load()) {  // tail이 변경되지 않았는지 확인
+                if (next == nullptr) {
+                    // tail의 next를 새 노드로 설정 시도
+                    if (last->next.compare_exchange_weak(next, first)) {
+                        // 성공하면 tail을 새 노드로 이동
+                        tail_.compare_exchange_weak(last, last_node);
+                        if (first == last_node) {
+                            not_empty_.NotifyOne();
+                        }
+                        else {
+                            not_empty_.NotifyAll();
+                        }
+                        return true;
+                    }
+                }
+                else {
+                    // tail이 실제 마지막이 아니면 tail을 앞으로 이동 시도
+                    tail_.compare_exchange_weak(last, next);
+                }
+            }
+        }
+    }
 
 public:
-    LockFreeQueue() {
+    // capacity는 MpmcQueue와 생성 방식을 맞추기 위한 것으로 사용하지 않음 (크기 제한 없음)
+    explicit LockFreeQueue(size_t capacity = 0) {
+        (void)capacity;
         Node* dummy = new Node;
         head_.store(dummy);
         tail_.store(dummy);
     }
 
     ~LockFreeQueue() {
-        //  ͵ 
+        // 남은 데이터들 정리
         while (Node* const old_head = head_.load()) {
             head_.store(old_head->next);
             T* data = old_head->data.load();
@@ -34,30 +78,39 @@ public:
         }
     }
 
-    void enqueue(const T& item) {
-        Node* new_node = new Node;
-        T* data = new T(std::move(item));
-        new_node->data.store(data);
+    // 크기 제한이 없으므로 항상 true
+    bool enqueue(const T& item) {
+        return Push(new T(item));
+    }
 
-        while (true) {
-            Node* last = tail_.load();
-            Node* next = last->next.load();
+    bool enqueue(T&& item) {
+        return Push(new T(std::move(item)));
+    }
 
-            if (last == tail_.load()) {  // tail  ʾҴ Ȯ
-                if (next == nullptr) {
-                    // tail next    õ
-                    if (last->next.compare_exchange_weak(next, new_node)) {
-                        // ϸ tail   ̵
-                        tail_.compare_exchange_weak(last, new_node);
-                        break;
-                    }
-                }
-                else {
-                    // tail   ƴϸ tail  ̵ õ
-                    tail_.compare_exchange_weak(last, next);
-                }
-            }
+    // items[0..count)를 이동해서 넣음 (크기 제한이 없으므로 항상 count 반환)
+    size_t enqueue_bulk(T* items, size_t count) {
+        if (count == 0) {
+            return 0;
+        }
+        Node* first = new Node;
+        first->data.store(new T(std::move(items[0])));
+        Node* last = first;
+        for (size_t i = 1; i < count; ++i) {
+            Node* node = new Node;
+            node->data.store(new T(std::move(items[i])));
+            last->next.store(node);
+            last = node;
+        }
+        PushChain(first, last);
+        return count;
+    }
+
+    size_t dequeue_bulk(T* out, size_t maxCount) {
+        size_t count = 0;
+        while (count < maxCount && dequeue(out[count])) {
+            ++count;
         }
+        return count;
     }
 
     bool dequeue(T& result) {
@@ -66,28 +119,30 @@ public:
             Node* last = tail_.load();
             Node* next = first->next.load();
 
-            if (first == head_.load()) {  // head  ʾҴ Ȯ
+            if (first == head_.load()) {  // head가 변경되지 않았는지 확인
                 if (first == last) {
                     if (next == nullptr) {
-                        return false;  // ť 
+                        return false;  // 큐가 비어있음
                     }
-                    // tail ó   ̵ õ
+                    // tail이 뒤처져 있으면 앞으로 이동 시도
                     tail_.compare_exchange_weak(last, next);
                 }
                 else {
                     if (next == nullptr) {
-                        continue;  // ٽ õ
+                        continue;  // 다시 시도
                     }
 
-                    //  б
+                    // 데이터 읽기
                     T* data = next->data.load();
                     if (data == nullptr) {
-                        continue;  // ٽ õ
+                        continue;  // 다시 시도
                     }
 
-                    // head   ̵ õ
+                    // head를 다음 노드로 이동 시도
                     if (head_.compare_exchange_weak(first, next)) {
-                        result = *data;
+                        // next는 새 더미 노드가 되므로 데이터 포인터를 비워 소멸자에서 두 번 해제하지 않도록 함
+                        next->data.store(nullptr);
+                        result = std::move(*data);
                         delete data;
                         delete first;
                         return true;
@@ -97,13 +152,28 @@ public:
         }
     }
 
+    // 꺼낼 항목이 없으면 통지나 timeoutMs(음수면 무한)까지 대기 (못 꺼내면 false)
+    bool wait_dequeue(T& result, int timeoutMs) {
+        return not_empty_.Await([&] { return dequeue(result); }, timeoutMs);
+    }
+
+    size_t wait_dequeue_bulk(T* out, size_t maxCount, int timeoutMs) {
+        size_t count = 0;
+        not_empty_.Await([&] { count = dequeue_bulk(out, maxCount); return count > 0; }, timeoutMs);
+        return count;
+    }
+
+    void wake_all() {
+        not_empty_.NotifyAll();
+    }
+
     bool empty() const {
         Node* first = head_.load();
         Node* last = tail_.load();
         return (first == last) && (first->next.load() == nullptr);
     }
 
-    // 뷫 ũ (Ȯ    - lock-free Ư)
+    // 대략적인 크기 (정확하지 않을 수 있음 - lock-free 특성상)
     size_t size() const {
         size_t count = 0;
         Node* current = head_.load()->next.load();
@@ -113,8 +183,10 @@ public:
         }
         return count;
     }
+
+    // 크기 제한이 없으므로 0
+    size_t capacity() const {
+        return 0;
+    }
 };
 
-// Task Response Ưȭ ť
-//using TaskQueue = LockFreeQueue<Task>;
-//using ResponseQueue = LockFreeQueue<Response>;
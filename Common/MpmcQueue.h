@@ -0,0 +1,226 @@
+﻿#pragma once
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include "EventCount.h"
+
+#define MPMC_CACHE_LINE_SIZE 64
+
+// 고정 크기 MPMC 링 버퍼 큐 (Dmitry Vyukov의 bounded MPMC queue 방식)
+// - 칸마다 sequence 번호를 두어 생산자/소비자가 CAS 한 번으로 칸을 차지하고, 칸 단위로만 동기화한다.
+// - 모든 칸은 생성 시 한 번만 할당하며, 넣고 뺄 때는 이동 대입만 하므로 연산마다 힙 할당이 없다.
+// - 생산자 위치와 소비자 위치는 서로 다른 캐시 라인에 두어 false sharing을 막는다.
+// - 가득 차면 enqueue()가 false를 반환한다 (호출자가 처리 방식을 정함).
+// - 소비자는 wait_dequeue()로 빈 큐에서 잠들 수 있고, enqueue()는 잠든 소비자가 있을 때만 깨운다.
+// - enqueue_bulk()/dequeue_bulk()는 연속된 칸 여러 개를 CAS 한 번으로 차지해 여러 항목을 한꺼번에 옮긴다.
+// - LockFreeQueue와 같은 인터페이스(enqueue/dequeue/wait_dequeue/*_bulk/empty/size)를 가진다.
+template<typename T>
+class MpmcQueue {
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    static size_t RoundUpPow2(size_t value) {
+        size_t result = 2;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    alignas(MPMC_CACHE_LINE_SIZE) std::unique_ptr<Cell[]> _buffer;
+    size_t _mask;
+    alignas(MPMC_CACHE_LINE_SIZE) std::atomic<size_t> _enqueue_pos;
+    alignas(MPMC_CACHE_LINE_SIZE) std::atomic<size_t> _dequeue_pos;
+    alignas(MPMC_CACHE_LINE_SIZE) EventCount _not_empty;
+
+    // 넣을 칸을 차지 (가득 차면 nullptr)
+    Cell* ClaimEnqueue() {
+        size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+        while (true) {
+            Cell* cell = &_buffer[pos & _mask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return cell;
+                }
+            }
+            else if (diff < 0) {
+                return nullptr;  // 가득 참
+            }
+            else {
+                pos = _enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // pos부터 최대 maxCount개의 연속된 칸 중 sequence가 pos + i + offset인 칸 수
+    // (offset 0: 비어서 넣을 수 있는 칸, 1: 채워져서 꺼낼 수 있는 칸)
+    size_t CountReady(size_t pos, size_t maxCount, size_t offset) const {
+        size_t count = 0;
+        while (count < maxCount) {
+            const Cell& cell = _buffer[(pos + count) & _mask];
+            if (cell.sequence.load(std::memory_order_acquire) != pos + count + offset) {
+                break;
+            }
+            ++count;
+        }
+        return count;
+    }
+
+public:
+    explicit MpmcQueue(size_t capacity = 65536)
+        : _buffer(new Cell[RoundUpPow2(capacity)]), _mask(RoundUpPow2(capacity) - 1),
+        _enqueue_pos(0), _dequeue_pos(0) {
+        for (size_t i = 0; i <= _mask; ++i) {
+            _buffer[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    bool enqueue(const T& item) {
+        Cell* cell = ClaimEnqueue();
+        if (cell == nullptr) {
+            return false;
+        }
+        cell->data = item;
+        cell->sequence.store(cell->sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        _not_empty.NotifyOne();
+        return true;
+    }
+
+    bool enqueue(T&& item) {
+        Cell* cell = ClaimEnqueue();
+        if (cell == nullptr) {
+            return false;
+        }
+        cell->data = std::move(item);
+        cell->sequence.store(cell->sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        _not_empty.NotifyOne();
+        return true;
+    }
+
+    bool dequeue(T& result) {
+        size_t pos = _dequeue_pos.load(std::memory_order_relaxed);
+        while (true) {
+            Cell* cell = &_buffer[pos & _mask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    result = std::move(cell->data);
+                    // 한 바퀴 뒤의 생산자가 쓸 수 있도록 sequence를 capacity만큼 앞으로
+                    cell->sequence.store(pos + _mask + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0) {
+                return false;  // 비어있음
+            }
+            else {
+                pos = _dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // items[0..count)를 이동해서 넣고 넣은 개수를 반환 (자리가 모자라면 앞쪽부터 들어간 만큼만)
+    size_t enqueue_bulk(T* items, size_t count) {
+        if (count == 0) {
+            return 0;
+        }
+        size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+        size_t claimed;
+        while (true) {
+            claimed = CountReady(pos, count, 0);
+            if (claimed == 0) {
+                // 첫 칸이 아직 이전 바퀴 항목이면 가득 참, 아니면 다른 생산자가 먼저 가져간 것
+                Cell& cell = _buffer[pos & _mask];
+                intptr_t diff = static_cast<intptr_t>(cell.sequence.load(std::memory_order_acquire)) - static_cast<intptr_t>(pos);
+                if (diff < 0) {
+                    return 0;
+                }
+                pos = _enqueue_pos.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (_enqueue_pos.compare_exchange_weak(pos, pos + claimed, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+
+        for (size_t i = 0; i < claimed; ++i) {
+            Cell& cell = _buffer[(pos + i) & _mask];
+            cell.data = std::move(items[i]);
+            cell.sequence.store(pos + i + 1, std::memory_order_release);
+        }
+        _not_empty.NotifyAll();
+        return claimed;
+    }
+
+    // 최대 maxCount개를 out에 이동해서 꺼내고 꺼낸 개수를 반환
+    size_t dequeue_bulk(T* out, size_t maxCount) {
+        if (maxCount == 0) {
+            return 0;
+        }
+        size_t pos = _dequeue_pos.load(std::memory_order_relaxed);
+        size_t claimed;
+        while (true) {
+            claimed = CountReady(pos, maxCount, 1);
+            if (claimed == 0) {
+                Cell& cell = _buffer[pos & _mask];
+                intptr_t diff = static_cast<intptr_t>(cell.sequence.load(std::memory_order_acquire)) - static_cast<intptr_t>(pos + 1);
+                if (diff < 0) {
+                    return 0;
+                }
+                pos = _dequeue_pos.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (_dequeue_pos.compare_exchange_weak(pos, pos + claimed, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+
+        for (size_t i = 0; i < claimed; ++i) {
+            Cell& cell = _buffer[(pos + i) & _mask];
+            out[i] = std::move(cell.data);
+            cell.sequence.store(pos + i + _mask + 1, std::memory_order_release);
+        }
+        return claimed;
+    }
+
+    // 꺼낼 항목이 없으면 잠깐 스핀한 뒤 통지나 timeoutMs(음수면 무한)까지 잠듦 (못 꺼내면 false)
+    bool wait_dequeue(T& result, int timeoutMs) {
+        return _not_empty.Await([&] { return dequeue(result); }, timeoutMs);
+    }
+
+    size_t wait_dequeue_bulk(T* out, size_t maxCount, int timeoutMs) {
+        size_t count = 0;
+        _not_empty.Await([&] { count = dequeue_bulk(out, maxCount); return count > 0; }, timeoutMs);
+        return count;
+    }
+
+    // wait_dequeue()로 잠든 소비자를 모두 깨움 (종료 시 사용)
+    void wake_all() {
+        _not_empty.NotifyAll();
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    // 대략적인 크기 (동시에 넣고 빼는 중이면 정확하지 않을 수 있음)
+    size_t size() const {
+        size_t enqueuePos = _enqueue_pos.load(std::memory_order_relaxed);
+        size_t dequeuePos = _dequeue_pos.load(std::memory_order_relaxed);
+        return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+    }
+
+    size_t capacity() const {
+        return _mask + 1;
+    }
+};
@@ -0,0 +1,110 @@
+﻿#pragma once
+
+// 플랫폼별 소켓 API 차이를 흡수하는 헤더
+// Windows(Winsock2)를 기준으로 작성된 코드가 Linux에서도 그대로 빌드되도록 최소한의 별칭만 제공한다.
+
+#ifdef _WIN32
+
+#include <winSock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "ws2_32.lib")
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+inline int SetSocketNonBlocking(SOCKET sock)
+{
+    u_long mode = 1;  // 1 for non-blocking, 0 for blocking
+    return ioctlsocket(sock, FIONBIO, &mode);
+}
+
+#else
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <sys/uio.h>
+#include <string.h>
+
+typedef int SOCKET;
+
+#define INVALID_SOCKET (-1)
+#define SOCKET_ERROR (-1)
+#define WSAEWOULDBLOCK EWOULDBLOCK
+#define WSAEINTR EINTR
+#define WSAECONNABORTED ECONNABORTED
+#define SD_BOTH SHUT_RDWR
+
+inline int closesocket(SOCKET sock) { return close(sock); }
+inline int WSAGetLastError() { return errno; }
+inline int WSACleanup() { return 0; }
+
+inline int SetSocketNonBlocking(SOCKET sock)
+{
+    int flags = fcntl(sock, F_GETFL, 0);
+    if (flags < 0) {
+        return -1;
+    }
+    return fcntl(sock, F_SETFL, flags | O_NONBLOCK) < 0 ? -1 : 0;
+}
+
+#endif
+
+// accept가 프로세스/시스템 디스크립터 한도로 실패했는지 (백로그의 연결을 받을 수 없는 상태)
+inline bool IsDescriptorLimitError(int error)
+{
+#ifdef _WIN32
+    return error == WSAEMFILE;
+#else
+    return error == EMFILE || error == ENFILE;
+#endif
+}
+
+// 여러 조각을 한 번의 시스템 콜로 전송하기 위한 조각 정보
+struct SendSlice {
+    const void* data;
+    size_t size;
+};
+
+#define MAX_SEND_SLICES 16
+
+// Gather write: 조각들을 순서대로 이어서 한 번에 전송 (보낸 바이트 수, 실패 시 SOCKET_ERROR)
+// Windows는 WSASend, 그 외는 SIGPIPE를 막기 위해 writev 대신 sendmsg(MSG_NOSIGNAL)을 사용한다.
+inline int SendGather(SOCKET sock, const SendSlice* slices, int count)
+{
+    if (count > MAX_SEND_SLICES) {
+        count = MAX_SEND_SLICES;
+    }
+
+#ifdef _WIN32
+    WSABUF buffers[MAX_SEND_SLICES];
+    for (int i = 0; i < count; ++i) {
+        buffers[i].buf = const_cast<CHAR*>(static_cast<const CHAR*>(slices[i].data));
+        buffers[i].len = static_cast<ULONG>(slices[i].size);
+    }
+
+    DWORD sent = 0;
+    if (WSASend(sock, buffers, static_cast<DWORD>(count), &sent, 0, nullptr, nullptr) == SOCKET_ERROR) {
+        return SOCKET_ERROR;
+    }
+    return static_cast<int>(sent);
+#else
+    struct iovec buffers[MAX_SEND_SLICES];
+    for (int i = 0; i < count; ++i) {
+        buffers[i].iov_base = const_cast<void*>(slices[i].data);
+        buffers[i].iov_len = slices[i].size;
+    }
+
+    struct msghdr message;
+    memset(&message, 0, sizeof(message));
+    message.msg_iov = buffers;
+    message.msg_iovlen = static_cast<size_t>(count);
+    return static_cast<int>(sendmsg(sock, &message, MSG_NOSIGNAL));
+#endif
+}
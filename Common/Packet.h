@@ -1,69 +1,83 @@
 #pragma once
 #include <vector>
 #include <string>
-#include <winSock2.h>
-#pragma comment(lib, "ws2_32.lib")
+#include <cstdint>
+#include <chrono>
+#include "NetPlatform.h"
+#include "PacketBuffer.h"
 
-// Task Ÿ  (CLIENT_DISCONNECTED ߰)
+// 서버가 연결마다 발급하는 32비트 핸들 (슬롯 번호 + 세대, 소켓 번호처럼 바로 재사용되지 않음)
+typedef uint32_t ConnectionHandle;
+#define INVALID_CONNECTION_HANDLE 0
+
+enum EventType : uint8_t;  // UserEvent_generated.h
+
+// Task 타입 열거형 (CLIENT_DISCONNECTED 추가)
 enum class TaskType {
-    QUERY,      // SELECT ó
-    UPDATE,     // UPDATE, INSERT, DELETE ó
+    QUERY,      // SELECT 처리
+    UPDATE,     // UPDATE, INSERT, DELETE 처리
     INSERT,
     ITEM_DELETE,
-    CLIENT_DISCONNECTED  // Ŭ̾Ʈ   ˸ ߰
+    CLIENT_DISCONNECTED  // 클라이언트 연결 해제 알림 추가
 };
 
-// DB  ü ( )
+// DB 응답 구조체 (기존과 동일)
 struct DBResponse {
-    int task_id;
-    SOCKET client_socket;
+    uint32_t task_id;  // 응답한 요청의 Task.id
+    ConnectionHandle client_handle;
     int worker_thread_id;
     bool success;
     std::string error_message;
     int affected_rows;
-    std::vector<uint8_t> response_data;
+    PacketBuffer response_data;  // 큐와 스레드 사이에서는 핸들만 이동
 
     DBResponse()
-        : task_id(0), client_socket(INVALID_SOCKET),
+        : task_id(0), client_handle(INVALID_CONNECTION_HANDLE),
         worker_thread_id(0), success(false), affected_rows(0) {
     }
 
-    DBResponse(SOCKET sock, int thread_id, const uint8_t* data, size_t size)
-        : task_id(0), client_socket(sock), worker_thread_id(thread_id),
-        success(false), affected_rows(0) {
-        response_data.assign(data, data + size);
+    DBResponse(ConnectionHandle handle, int thread_id, const uint8_t* data, size_t size)
+        : task_id(0), client_handle(handle), worker_thread_id(thread_id),
+        success(false), affected_rows(0), response_data(PacketBuffer::Copy(data, size)) {
     }
 };
 
-// DB û ü ( )
+// DB 요청 구조체 (기존과 동일)
 struct Task {
-    int id;
-    SOCKET client_socket;
+    uint32_t id;  // 연결별 요청 번호 (WorkerThread가 매김, 응답을 요청 순서대로 보내는 데 사용)
+    ConnectionHandle client_handle;
     int worker_thread_id;
     TaskType type;
-    std::string query;  //  ó ڿ (׽Ʈ)
-    std::vector<uint8_t> flatbuffer_data;
+    std::string query;  // 직접 처리 문자열 (테스트용)
+    PacketBuffer flatbuffer_data;  // 수신한 프레임 그대로 (검증/파싱 모두 이 메모리에서 수행)
+    std::chrono::steady_clock::time_point admitted_at;  // 동시성 제한기를 통과해 요청 큐에 들어간 시각 (지연 측정용)
+    EventType event_type;  // WorkerThread가 검증하면서 읽은 요청 종류 (0이면 DB 스레드가 직접 검증)
 
     Task()
-        : id(0), client_socket(INVALID_SOCKET),
-        worker_thread_id(0), type(TaskType::QUERY) {
+        : id(0), client_handle(INVALID_CONNECTION_HANDLE),
+        worker_thread_id(0), type(TaskType::QUERY), event_type(static_cast<EventType>(0)) {
+    }
+
+    Task(ConnectionHandle handle, int thread_id, const uint8_t* data, size_t size)
+        : id(0), client_handle(handle), worker_thread_id(thread_id),
+        type(TaskType::QUERY), flatbuffer_data(PacketBuffer::Copy(data, size)), event_type(static_cast<EventType>(0)) {
     }
 
-    Task(SOCKET sock, int thread_id, const uint8_t* data, size_t size)
-        : id(0), client_socket(sock), worker_thread_id(thread_id),
-        type(TaskType::QUERY) {
-        flatbuffer_data.assign(data, data + size);
+    // 수신 프레임을 복사 없이 넘겨받는 생성자 (eventType은 이미 검증을 마친 프레임일 때만 넘긴다)
+    Task(ConnectionHandle handle, PacketBuffer&& frame, EventType eventType = static_cast<EventType>(0))
+        : id(0), client_handle(handle), worker_thread_id(0),
+        type(TaskType::QUERY), flatbuffer_data(std::move(frame)), event_type(eventType) {
     }
 
-    //  ó  
-    Task(SOCKET sock, int thread_id, TaskType t, const std::string& q)
-        : id(0), client_socket(sock), worker_thread_id(thread_id),
-        type(t), query(q) {
+    // 간단한 처리 생성용 생성자
+    Task(ConnectionHandle handle, int thread_id, TaskType t, const std::string& q)
+        : id(0), client_handle(handle), worker_thread_id(thread_id),
+        type(t), query(q), event_type(static_cast<EventType>(0)) {
     }
 
-    // Ŭ̾Ʈ    ߰
-    Task(SOCKET sock, TaskType disconnect_type)
-        : id(0), client_socket(sock), worker_thread_id(0),
-        type(disconnect_type) {
+    // 클라이언트 연결 해제용 생성자 추가
+    Task(ConnectionHandle handle, TaskType disconnect_type)
+        : id(0), client_handle(handle), worker_thread_id(0),
+        type(disconnect_type), event_type(static_cast<EventType>(0)) {
     }
 };
\ No newline at end of file
@@ -0,0 +1,108 @@
+﻿#pragma once
+#include <atomic>
+#include <vector>
+#include <new>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include "BufferPool.h"
+
+// 참조 카운트 방식 패킷 버퍼 핸들
+// - 프레임/응답 바이트를 한 번만 채운 뒤 Task, DBResponse, 송신 요청 사이에서는 핸들만 넘긴다.
+//   (복사는 참조 카운트 증가, 이동은 포인터 이동뿐이며 바이트는 복사하지 않음)
+// - 헤더와 바이트를 BufferPool 블록 하나에 담으므로 패킷마다 힙 할당이 일어나지 않는다.
+// - 채운 뒤에는 읽기 전용으로 취급한다. 참조 카운트는 여러 스레드에서 안전하지만
+//   writable_data()는 다른 핸들과 공유하기 전에만 사용한다.
+class PacketBuffer
+{
+private:
+    struct Storage {
+        std::atomic<uint32_t> refs;
+        uint32_t size;
+        // 바이트가 바로 뒤에 이어짐
+    };
+
+    Storage* _storage;
+
+    explicit PacketBuffer(Storage* storage) : _storage(storage) {}
+
+    static size_t BlockSize(size_t size) {
+        return sizeof(Storage) + size;
+    }
+
+    uint8_t* Bytes() const {
+        return reinterpret_cast<uint8_t*>(_storage + 1);
+    }
+
+    void Release() {
+        if (_storage != nullptr && _storage->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            size_t size = _storage->size;
+            _storage->~Storage();
+            BufferPool::Instance().Free(_storage, BlockSize(size));
+        }
+        _storage = nullptr;
+    }
+
+public:
+    PacketBuffer() : _storage(nullptr) {}
+
+    // size 바이트짜리 버퍼 할당 (writable_data()로 채움)
+    static PacketBuffer Allocate(size_t size) {
+        if (size == 0) {
+            return PacketBuffer();
+        }
+        void* block = BufferPool::Instance().Allocate(BlockSize(size));
+        Storage* storage = new (block) Storage;
+        storage->refs.store(1, std::memory_order_relaxed);
+        storage->size = static_cast<uint32_t>(size);
+        return PacketBuffer(storage);
+    }
+
+    static PacketBuffer Copy(const void* data, size_t size) {
+        PacketBuffer buffer = Allocate(size);
+        if (size > 0) {
+            memcpy(buffer.writable_data(), data, size);
+        }
+        return buffer;
+    }
+
+    PacketBuffer(const PacketBuffer& other) : _storage(other._storage) {
+        if (_storage != nullptr) {
+            _storage->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    PacketBuffer(PacketBuffer&& other) noexcept : _storage(other._storage) {
+        other._storage = nullptr;
+    }
+
+    PacketBuffer& operator=(const PacketBuffer& other) {
+        if (this != &other) {
+            PacketBuffer copy(other);
+            std::swap(_storage, copy._storage);
+        }
+        return *this;
+    }
+
+    PacketBuffer& operator=(PacketBuffer&& other) noexcept {
+        if (this != &other) {
+            Release();
+            _storage = other._storage;
+            other._storage = nullptr;
+        }
+        return *this;
+    }
+
+    ~PacketBuffer() {
+        Release();
+    }
+
+    const uint8_t* data() const { return _storage ? Bytes() : nullptr; }
+    uint8_t* writable_data() { return _storage ? Bytes() : nullptr; }
+    size_t size() const { return _storage ? _storage->size : 0; }
+    bool empty() const { return size() == 0; }
+
+    // 같은 바이트를 공유하는 핸들 수 (디버그용)
+    uint32_t use_count() const { return _storage ? _storage->refs.load(std::memory_order_relaxed) : 0; }
+};
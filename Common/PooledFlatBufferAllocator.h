@@ -0,0 +1,23 @@
+﻿#pragma once
+#include "flatbuffers/flatbuffers.h"
+#include "BufferPool.h"
+
+// FlatBufferBuilder가 내부 버퍼를 BufferPool에서 받도록 하는 할당자
+// - 상태가 없으므로 Instance() 하나를 모든 스레드가 같이 쓴다.
+// - 빌더가 커질 때(reallocate_downward)도 풀에서 더 큰 등급을 받아 옮긴다.
+class PooledFlatBufferAllocator : public flatbuffers::Allocator
+{
+public:
+    static PooledFlatBufferAllocator& Instance() {
+        static PooledFlatBufferAllocator instance;
+        return instance;
+    }
+
+    uint8_t* allocate(size_t size) override {
+        return static_cast<uint8_t*>(BufferPool::Instance().Allocate(size));
+    }
+
+    void deallocate(uint8_t* p, size_t size) override {
+        BufferPool::Instance().Free(p, size);
+    }
+};
@@ -0,0 +1,153 @@
+﻿#pragma once
+#include <cstdint>
+#include <cstring>
+#include "BufferPool.h"
+
+// 연결별 송수신용 가변 크기 링 버퍼
+// - 용량은 항상 2의 거듭제곱이며, 부족하면 두 배씩 늘리면서 내용을 앞으로 정렬한다.
+// - 읽기/쓰기 위치는 단조 증가 카운터로 관리하고 마스크로 인덱스를 구한다.
+// - 단일 스레드(소유 워커) 전용이므로 동기화는 하지 않는다.
+// - 메모리는 BufferPool에서 받으므로 연결이 자주 맺고 끊겨도 힙 할당이 반복되지 않는다.
+class RingBuffer
+{
+private:
+    uint8_t* _buffer;
+    size_t _capacity;
+    size_t _mask;
+    size_t _read_pos;
+    size_t _write_pos;
+
+    static size_t RoundUpPow2(size_t value) {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+public:
+    explicit RingBuffer(size_t initialCapacity = 4096)
+        : _capacity(RoundUpPow2(initialCapacity)), _mask(_capacity - 1),
+        _read_pos(0), _write_pos(0) {
+        _buffer = static_cast<uint8_t*>(BufferPool::Instance().Allocate(_capacity));
+    }
+
+    ~RingBuffer() {
+        BufferPool::Instance().Free(_buffer, _capacity);
+    }
+
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+    size_t Size() const { return _write_pos - _read_pos; }
+    size_t Capacity() const { return _capacity; }
+    size_t Writable() const { return Capacity() - Size(); }
+    bool Empty() const { return _write_pos == _read_pos; }
+
+    // 최소 required 바이트를 담을 수 있도록 용량 확보
+    void Reserve(size_t required) {
+        if (required <= Capacity()) {
+            return;
+        }
+
+        size_t newCapacity = RoundUpPow2(required);
+        uint8_t* newBuffer = static_cast<uint8_t*>(BufferPool::Instance().Allocate(newCapacity));
+        size_t size = Size();
+        Peek(newBuffer, size);
+
+        BufferPool::Instance().Free(_buffer, _capacity);
+        _buffer = newBuffer;
+        _capacity = newCapacity;
+        _mask = _capacity - 1;
+        _read_pos = 0;
+        _write_pos = size;
+    }
+
+    // recv()로 바로 채울 수 있는 연속된 빈 공간
+    uint8_t* WritePtr() { return _buffer + (_write_pos & _mask); }
+    size_t ContiguousWritable() const {
+        size_t offset = _write_pos & _mask;
+        size_t untilEnd = Capacity() - offset;
+        size_t writable = Writable();
+        return writable < untilEnd ? writable : untilEnd;
+    }
+    void CommitWrite(size_t bytes) { _write_pos += bytes; }
+
+    // 필요하면 용량을 늘린 뒤 뒤쪽에 bytes만큼 복사 (경계를 넘는 경우 두 번에 나눠 복사)
+    void Write(const void* src, size_t bytes) {
+        Reserve(Size() + bytes);
+
+        size_t first = ContiguousWritable();
+        if (first > bytes) {
+            first = bytes;
+        }
+
+        memcpy(WritePtr(), src, first);
+        if (bytes > first) {
+            memcpy(_buffer, static_cast<const uint8_t*>(src) + first, bytes - first);
+        }
+        _write_pos += bytes;
+    }
+
+    // send()에 바로 넘길 수 있는 연속된 데이터 구간
+    const uint8_t* ReadPtr() const { return _buffer + (_read_pos & _mask); }
+    size_t ContiguousReadable() const {
+        size_t offset = _read_pos & _mask;
+        size_t untilEnd = Capacity() - offset;
+        size_t size = Size();
+        return size < untilEnd ? size : untilEnd;
+    }
+
+    // 읽을 수 있는 데이터를 최대 두 개의 연속 구간으로 돌려줌 (gather write용, 구간 개수 반환)
+    int ReadSegments(const uint8_t* ptrs[2], size_t sizes[2]) const {
+        if (Empty()) {
+            return 0;
+        }
+
+        ptrs[0] = ReadPtr();
+        sizes[0] = ContiguousReadable();
+        if (sizes[0] == Size()) {
+            return 1;
+        }
+
+        ptrs[1] = _buffer;
+        sizes[1] = Size() - sizes[0];
+        return 2;
+    }
+
+    // 읽기 위치를 옮기지 않고 앞에서부터 bytes만큼 복사 (경계를 넘는 경우 두 번에 나눠 복사)
+    bool Peek(void* dest, size_t bytes) const {
+        if (bytes > Size()) {
+            return false;
+        }
+
+        size_t offset = _read_pos & _mask;
+        size_t first = Capacity() - offset;
+        if (first > bytes) {
+            first = bytes;
+        }
+
+        memcpy(dest, _buffer + offset, first);
+        if (bytes > first) {
+            memcpy(static_cast<uint8_t*>(dest) + first, _buffer, bytes - first);
+        }
+        return true;
+    }
+
+    void Consume(size_t bytes) {
+        _read_pos += bytes;
+        if (_read_pos == _write_pos) {
+            // 비었으면 처음으로 되돌려 다음 recv가 최대한 큰 연속 공간을 쓰도록 함
+            _read_pos = 0;
+            _write_pos = 0;
+        }
+    }
+
+    bool Read(void* dest, size_t bytes) {
+        if (!Peek(dest, bytes)) {
+            return false;
+        }
+        Consume(bytes);
+        return true;
+    }
+};
@@ -0,0 +1,14 @@
+﻿#pragma once
+#include "Packet.h"
+#include "LockFreeQueue.h"
+#include "MpmcQueue.h"
+
+#define TASK_QUEUE_CAPACITY 65536  // WorkerThread -> DatabaseThread 요청 큐 크기 (MpmcQueue 사용 시)
+
+// WorkerThread가 넣고 DatabaseThread가 꺼내는 요청 큐
+// 기본은 고정 크기 MpmcQueue이며, USE_LEGACY_LOCKFREE_QUEUE로 빌드하면 기존 노드 방식 큐를 사용한다 (성능 비교용)
+#ifdef USE_LEGACY_LOCKFREE_QUEUE
+typedef LockFreeQueue<Task> TaskQueue;
+#else
+typedef MpmcQueue<Task> TaskQueue;
+#endif
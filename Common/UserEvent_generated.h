@@ -1016,7 +1016,8 @@ struct S2C_ItemData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     VT_RESULT = 4,
     VT_USER_ID = 6,
     VT_ITEMS = 8,
-    VT_GOLD = 10
+    VT_GOLD = 10,
+    VT_HAS_MORE = 12
   };
   ResultCode result() const {
     return static_cast<ResultCode>(GetField<int8_t>(VT_RESULT, 0));
@@ -1030,6 +1031,9 @@ struct S2C_ItemData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   uint32_t gold() const {
     return GetField<uint32_t>(VT_GOLD, 0);
   }
+  bool has_more() const {
+    return GetField<uint8_t>(VT_HAS_MORE, 0) != 0;
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int8_t>(verifier, VT_RESULT, 1) &&
@@ -1038,6 +1042,7 @@ struct S2C_ItemData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            verifier.VerifyVector(items()) &&
            verifier.VerifyVectorOfTables(items()) &&
            VerifyField<uint32_t>(verifier, VT_GOLD, 4) &&
+           VerifyField<uint8_t>(verifier, VT_HAS_MORE, 1) &&
            verifier.EndTable();
   }
 };
@@ -1058,6 +1063,9 @@ struct S2C_ItemDataBuilder {
   void add_gold(uint32_t gold) {
     fbb_.AddElement<uint32_t>(S2C_ItemData::VT_GOLD, gold, 0);
   }
+  void add_has_more(bool has_more) {
+    fbb_.AddElement<uint8_t>(S2C_ItemData::VT_HAS_MORE, static_cast<uint8_t>(has_more), 0);
+  }
   explicit S2C_ItemDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -1074,11 +1082,13 @@ inline ::flatbuffers::Offset<S2C_ItemData> CreateS2C_ItemData(
     ResultCode result = ResultCode_SUCCESS,
     uint32_t user_id = 0,
     ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ItemData>>> items = 0,
-    uint32_t gold = 0) {
+    uint32_t gold = 0,
+    bool has_more = false) {
   S2C_ItemDataBuilder builder_(_fbb);
   builder_.add_gold(gold);
   builder_.add_items(items);
   builder_.add_user_id(user_id);
+  builder_.add_has_more(has_more);
   builder_.add_result(result);
   return builder_.Finish();
 }
@@ -1088,14 +1098,16 @@ inline ::flatbuffers::Offset<S2C_ItemData> CreateS2C_ItemDataDirect(
     ResultCode result = ResultCode_SUCCESS,
     uint32_t user_id = 0,
     const std::vector<::flatbuffers::Offset<ItemData>> *items = nullptr,
-    uint32_t gold = 0) {
+    uint32_t gold = 0,
+    bool has_more = false) {
   auto items__ = items ? _fbb.CreateVector<::flatbuffers::Offset<ItemData>>(*items) : 0;
   return CreateS2C_ItemData(
       _fbb,
       result,
       user_id,
       items__,
-      gold);
+      gold,
+      has_more);
 }
 
 struct C2S_ItemData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
@@ -2366,7 +2378,8 @@ struct S2C_PlayerChat FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   typedef S2C_PlayerChatBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
     VT_RESULT = 4,
-    VT_CHATS = 6
+    VT_CHATS = 6,
+    VT_HAS_MORE = 8
   };
   ResultCode result() const {
     return static_cast<ResultCode>(GetField<int8_t>(VT_RESULT, 0));
@@ -2374,12 +2387,16 @@ struct S2C_PlayerChat FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   const ::flatbuffers::Vector<::flatbuffers::Offset<ChatData>> *chats() const {
     return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<ChatData>> *>(VT_CHATS);
   }
+  bool has_more() const {
+    return GetField<uint8_t>(VT_HAS_MORE, 0) != 0;
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int8_t>(verifier, VT_RESULT, 1) &&
            VerifyOffset(verifier, VT_CHATS) &&
            verifier.VerifyVector(chats()) &&
            verifier.VerifyVectorOfTables(chats()) &&
+           VerifyField<uint8_t>(verifier, VT_HAS_MORE, 1) &&
            verifier.EndTable();
   }
 };
@@ -2394,6 +2411,9 @@ struct S2C_PlayerChatBuilder {
   void add_chats(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ChatData>>> chats) {
     fbb_.AddOffset(S2C_PlayerChat::VT_CHATS, chats);
   }
+  void add_has_more(bool has_more) {
+    fbb_.AddElement<uint8_t>(S2C_PlayerChat::VT_HAS_MORE, static_cast<uint8_t>(has_more), 0);
+  }
   explicit S2C_PlayerChatBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -2408,9 +2428,11 @@ struct S2C_PlayerChatBuilder {
 inline ::flatbuffers::Offset<S2C_PlayerChat> CreateS2C_PlayerChat(
     ::flatbuffers::FlatBufferBuilder &_fbb,
     ResultCode result = ResultCode_SUCCESS,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ChatData>>> chats = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ChatData>>> chats = 0,
+    bool has_more = false) {
   S2C_PlayerChatBuilder builder_(_fbb);
   builder_.add_chats(chats);
+  builder_.add_has_more(has_more);
   builder_.add_result(result);
   return builder_.Finish();
 }
@@ -2418,12 +2440,14 @@ inline ::flatbuffers::Offset<S2C_PlayerChat> CreateS2C_PlayerChat(
 inline ::flatbuffers::Offset<S2C_PlayerChat> CreateS2C_PlayerChatDirect(
     ::flatbuffers::FlatBufferBuilder &_fbb,
     ResultCode result = ResultCode_SUCCESS,
-    const std::vector<::flatbuffers::Offset<ChatData>> *chats = nullptr) {
+    const std::vector<::flatbuffers::Offset<ChatData>> *chats = nullptr,
+    bool has_more = false) {
   auto chats__ = chats ? _fbb.CreateVector<::flatbuffers::Offset<ChatData>>(*chats) : 0;
   return CreateS2C_PlayerChat(
       _fbb,
       result,
-      chats__);
+      chats__,
+      has_more);
 }
 
 struct C2S_PlayerChat FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
@@ -2911,7 +2935,8 @@ struct S2C_GameServerList FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table
   typedef S2C_GameServerListBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
     VT_RESULT = 4,
-    VT_SERVERS = 6
+    VT_SERVERS = 6,
+    VT_HAS_MORE = 8
   };
   ResultCode result() const {
     return static_cast<ResultCode>(GetField<int8_t>(VT_RESULT, 0));
@@ -2919,12 +2944,16 @@ struct S2C_GameServerList FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table
   const ::flatbuffers::Vector<::flatbuffers::Offset<GameServerData>> *servers() const {
     return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<GameServerData>> *>(VT_SERVERS);
   }
+  bool has_more() const {
+    return GetField<uint8_t>(VT_HAS_MORE, 0) != 0;
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int8_t>(verifier, VT_RESULT, 1) &&
            VerifyOffset(verifier, VT_SERVERS) &&
            verifier.VerifyVector(servers()) &&
            verifier.VerifyVectorOfTables(servers()) &&
+           VerifyField<uint8_t>(verifier, VT_HAS_MORE, 1) &&
            verifier.EndTable();
   }
 };
@@ -2939,6 +2968,9 @@ struct S2C_GameServerListBuilder {
   void add_servers(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GameServerData>>> servers) {
     fbb_.AddOffset(S2C_GameServerList::VT_SERVERS, servers);
   }
+  void add_has_more(bool has_more) {
+    fbb_.AddElement<uint8_t>(S2C_GameServerList::VT_HAS_MORE, static_cast<uint8_t>(has_more), 0);
+  }
   explicit S2C_GameServerListBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -2953,9 +2985,11 @@ struct S2C_GameServerListBuilder {
 inline ::flatbuffers::Offset<S2C_GameServerList> CreateS2C_GameServerList(
     ::flatbuffers::FlatBufferBuilder &_fbb,
     ResultCode result = ResultCode_SUCCESS,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GameServerData>>> servers = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GameServerData>>> servers = 0,
+    bool has_more = false) {
   S2C_GameServerListBuilder builder_(_fbb);
   builder_.add_servers(servers);
+  builder_.add_has_more(has_more);
   builder_.add_result(result);
   return builder_.Finish();
 }
@@ -2963,12 +2997,14 @@ inline ::flatbuffers::Offset<S2C_GameServerList> CreateS2C_GameServerList(
 inline ::flatbuffers::Offset<S2C_GameServerList> CreateS2C_GameServerListDirect(
     ::flatbuffers::FlatBufferBuilder &_fbb,
     ResultCode result = ResultCode_SUCCESS,
-    const std::vector<::flatbuffers::Offset<GameServerData>> *servers = nullptr) {
+    const std::vector<::flatbuffers::Offset<GameServerData>> *servers = nullptr,
+    bool has_more = false) {
   auto servers__ = servers ? _fbb.CreateVector<::flatbuffers::Offset<GameServerData>>(*servers) : 0;
   return CreateS2C_GameServerList(
       _fbb,
       result,
-      servers__);
+      servers__,
+      has_more);
 }
 
 struct C2S_JoinGameServer FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
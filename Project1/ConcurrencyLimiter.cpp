@@ -0,0 +1,128 @@
+﻿#include "ConcurrencyLimiter.h"
+#include "UserEvent_generated.h"
+
+ConcurrencyLimiter::ConcurrencyLimiter(std::chrono::milliseconds targetLatency)
+	: _target_latency(std::chrono::duration_cast<std::chrono::microseconds>(targetLatency)),
+	_limit(LIMITER_INITIAL_LIMIT), _in_flight(0), _latency_ewma_us(0.0),
+	_limit_value(LIMITER_INITIAL_LIMIT), _increase_credit(0.0), _last_decrease(std::chrono::steady_clock::now())
+{
+	for (int i = 0; i < TASK_PRIORITY_COUNT; ++i) {
+		_shed[i].store(0);
+	}
+}
+
+TaskPriority ConcurrencyLimiter::PriorityOf(EventType packetType)
+{
+	switch (packetType) {
+	case EventType_C2S_Login:
+	case EventType_C2S_Logout:
+	case EventType_C2S_CreateAccount:
+	case EventType_C2S_SavePlayerData:
+		return TaskPriority::CRITICAL;
+	case EventType_C2S_PlayerChat:
+	case EventType_C2S_ShopList:
+	case EventType_C2S_ShopItems:
+	case EventType_C2S_MonsterData:
+	case EventType_C2S_GameServerList:
+		return TaskPriority::LOW;
+	default:
+		return TaskPriority::NORMAL;
+	}
+}
+
+bool ConcurrencyLimiter::IsOverloaded() const
+{
+	return _latency_ewma_us.load() > static_cast<double>(_target_latency.count());
+}
+
+uint32_t ConcurrencyLimiter::AllowedFor(TaskPriority priority, uint32_t limit) const
+{
+	// 평소에도 낮은 순위는 한도 일부만 쓰게 해서 높은 순위가 들어올 자리를 남긴다
+	double share = 1.0;
+	bool overloaded = IsOverloaded();
+	if (priority == TaskPriority::NORMAL) {
+		share = overloaded ? 0.5 : 0.9;
+	}
+	else if (priority == TaskPriority::LOW) {
+		share = overloaded ? 0.0 : 0.7;
+	}
+
+	// 어느 순위든 최소 한 자리는 남긴다. 지연 EWMA는 요청이 끝날 때만 갱신되므로, 과부하 뒤 LOW 요청만 들어오는데
+	// 모두 거절하면 아무것도 끝나지 않아 과부하 상태가 풀리지 않는다 (처리 중인 요청이 없을 때 하나는 통과시켜 지연을 다시 잰다)
+	uint32_t allowed = static_cast<uint32_t>(limit * share);
+	if (allowed == 0) {
+		allowed = 1;
+	}
+	return allowed;
+}
+
+bool ConcurrencyLimiter::TryAcquire(TaskPriority priority)
+{
+	if (!IsEnabled()) {
+		_in_flight.fetch_add(1);
+		return true;
+	}
+
+	uint32_t allowed = AllowedFor(priority, _limit.load());
+	uint32_t current = _in_flight.load();
+	do {
+		if (current >= allowed) {
+			_shed[static_cast<int>(priority)].fetch_add(1);
+			return false;
+		}
+	} while (!_in_flight.compare_exchange_weak(current, current + 1));
+	return true;
+}
+
+void ConcurrencyLimiter::Release(std::chrono::steady_clock::duration latency, bool sampled)
+{
+	uint32_t inFlight = _in_flight.fetch_sub(1);
+	if (!sampled || !IsEnabled()) {
+		return;
+	}
+
+	double latencyUs = static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	double previous = _latency_ewma_us.load();
+	_latency_ewma_us.store(previous == 0.0 ? latencyUs
+		: LIMITER_LATENCY_EWMA_ALPHA * latencyUs + (1.0 - LIMITER_LATENCY_EWMA_ALPHA) * previous);
+
+	auto now = std::chrono::steady_clock::now();
+	if (latencyUs > static_cast<double>(_target_latency.count())) {
+		// 한 번 줄인 효과가 지연에 드러나기 전에 연달아 줄이지 않도록 목표 지연마다 한 번만 줄인다
+		if (now - _last_decrease >= _target_latency) {
+			_limit_value *= LIMITER_BACKOFF_RATIO;
+			if (_limit_value < LIMITER_MIN_LIMIT) {
+				_limit_value = LIMITER_MIN_LIMIT;
+			}
+			_last_decrease = now;
+			_increase_credit = 0.0;
+		}
+	}
+	else if (inFlight * 2 >= static_cast<uint32_t>(_limit_value)) {
+		// 한도를 절반 이상 쓰고 있을 때만 늘린다 (부하가 적을 때 한도만 계속 커지는 것 방지)
+		// 지연이 목표의 절반도 안 되면 완료마다 늘려 한도를 빠르게 키운다 (한도만큼 완료되면 두 배)
+		_increase_credit += latencyUs * 2 < static_cast<double>(_target_latency.count()) ? _limit_value : 1.0;
+		if (_increase_credit >= _limit_value) {
+			_increase_credit = 0.0;
+			_limit_value += 1.0;
+			if (_limit_value > LIMITER_MAX_LIMIT) {
+				_limit_value = LIMITER_MAX_LIMIT;
+			}
+		}
+	}
+	_limit.store(static_cast<uint32_t>(_limit_value));
+}
+
+ConcurrencyLimiterStats ConcurrencyLimiter::GetStats() const
+{
+	ConcurrencyLimiterStats stats;
+	stats.limit = _limit.load();
+	stats.in_flight = _in_flight.load();
+	stats.latency_ms = _latency_ewma_us.load() / 1000.0;
+	for (int i = 0; i < TASK_PRIORITY_COUNT; ++i) {
+		stats.shed[i] = _shed[i].load();
+	}
+	return stats;
+}
@@ -0,0 +1,71 @@
+﻿#pragma once
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <cstdint>
+
+enum EventType : uint8_t;
+
+#define LIMITER_INITIAL_LIMIT 64     // 시작 동시성 한도
+#define LIMITER_MIN_LIMIT 4          // 한도가 이 아래로는 줄지 않음
+#define LIMITER_MAX_LIMIT 4096       // 한도가 이 위로는 늘지 않음
+#define LIMITER_BACKOFF_RATIO 0.9    // 목표 지연을 넘었을 때 한도에 곱하는 비율 (AIMD의 MD)
+#define LIMITER_LATENCY_EWMA_ALPHA 0.2
+
+// 요청 우선순위 (DB가 느려지면 낮은 순위부터 버린다)
+enum class TaskPriority : uint8_t {
+    CRITICAL = 0,  // 로그인/로그아웃/계정 생성/저장 - 한도 전체 사용
+    NORMAL = 1,    // 플레이어/아이템 조회, 거래, 게임 서버 관리
+    LOW = 2        // 채팅, 상점 목록, 몬스터 데이터, 게임 서버 목록 - 과부하 시 먼저 거절
+};
+#define TASK_PRIORITY_COUNT 3
+
+struct ConcurrencyLimiterStats {
+    uint32_t limit;
+    uint32_t in_flight;
+    double latency_ms;                        // 최근 지연 (EWMA)
+    uint64_t shed[TASK_PRIORITY_COUNT];       // 우선순위별 거절 수
+};
+
+// DB 실행기 앞단의 적응형 동시성 제한기 (AIMD)
+// - 요청 큐에 들어가 DB 처리가 끝날 때까지(대기 + 실행) 동시에 머무는 요청 수를 한도 이하로 유지한다.
+// - 요청마다 큐에 넣은 시점부터 처리 완료까지의 지연을 재서, 목표 이하이고 한도를 충분히 쓰고 있으면
+//   한도만큼 완료될 때마다 1씩 늘리고(AI, 목표의 절반 미만이면 완료마다 1씩), 목표를 넘으면 목표 지연 한 번에
+//   한 번씩 비율로 줄인다(MD).
+// - 우선순위마다 쓸 수 있는 한도 비율이 다르고, 최근 지연이 목표를 넘으면 LOW는 처리 중인 요청이 없을 때 하나만
+//   받고 NORMAL은 일부 거절해 로그인/저장 요청이 쓸 자리를 남긴다.
+// - TryAcquire는 여러 WorkerThread가, Release는 주로 DB 스레드가 호출한다.
+class ConcurrencyLimiter
+{
+private:
+    std::chrono::microseconds _target_latency;  // 0이면 제한하지 않음
+    std::atomic<uint32_t> _limit;
+    std::atomic<uint32_t> _in_flight;
+    std::atomic<double> _latency_ewma_us;
+    std::atomic<uint64_t> _shed[TASK_PRIORITY_COUNT];
+
+    // 한도 갱신용 (Release의 지연 샘플 처리에서만 사용)
+    std::mutex _mutex;
+    double _limit_value;
+    double _increase_credit;
+    std::chrono::steady_clock::time_point _last_decrease;
+
+    bool IsOverloaded() const;
+    uint32_t AllowedFor(TaskPriority priority, uint32_t limit) const;
+
+public:
+    explicit ConcurrencyLimiter(std::chrono::milliseconds targetLatency);
+
+    ConcurrencyLimiter(const ConcurrencyLimiter&) = delete;
+    ConcurrencyLimiter& operator=(const ConcurrencyLimiter&) = delete;
+
+    static TaskPriority PriorityOf(EventType packetType);
+
+    // 자리가 있으면 차지하고 true, 없으면 거절 수를 올리고 false
+    bool TryAcquire(TaskPriority priority);
+    // 처리 완료 (latency는 TryAcquire부터 완료까지, sampled가 false면 한도 계산에 쓰지 않음 - 큐에 넣지 못한 경우 등)
+    void Release(std::chrono::steady_clock::duration latency, bool sampled = true);
+
+    bool IsEnabled() const { return _target_latency.count() > 0; }
+    ConcurrencyLimiterStats GetStats() const;
+};
@@ -0,0 +1,241 @@
+﻿#include "ConnectionSlab.h"
+
+ConnectionSlab::ConnectionSlab(uint32_t capacity)
+	: _capacity(capacity), _free_head(0), _free_count(capacity), _used(0)
+{
+	if (_capacity > CONNECTION_INDEX_MASK + 1) {
+		_capacity = CONNECTION_INDEX_MASK + 1;
+		_free_count = _capacity;
+	}
+
+	_slots.reset(new Slot[_capacity]);
+	_free_ring.resize(_capacity);
+	for (uint32_t i = 0; i < _capacity; ++i) {
+		_slots[i].handle.store(INVALID_CONNECTION_HANDLE);
+		_slots[i].worker.store(nullptr);
+		_slots[i].node = nullptr;
+		_slots[i].generation = 1;
+		_slots[i].in_flight.store(CounterWord(INVALID_CONNECTION_HANDLE, 0));
+		_slots[i].db_pending.store(CounterWord(INVALID_CONNECTION_HANDLE, 0));
+		_slots[i].completed_request.store(CounterWord(INVALID_CONNECTION_HANDLE, 0));
+		_free_ring[i] = i;
+	}
+}
+
+ConnectionHandle ConnectionSlab::Allocate(WorkerThread* worker, SocketNode* node)
+{
+	std::lock_guard<std::mutex> lock(_free_mutex);
+	if (_free_count == 0) {
+		return INVALID_CONNECTION_HANDLE;
+	}
+
+	uint32_t index = _free_ring[_free_head];
+	_free_head = (_free_head + 1) % _capacity;
+	--_free_count;
+
+	Slot& slot = _slots[index];
+	ConnectionHandle handle = (slot.generation << CONNECTION_INDEX_BITS) | index;
+	slot.node = node;
+	slot.worker.store(worker, std::memory_order_relaxed);
+	// 카운터는 새 핸들로 0부터 시작 (이전 연결의 핸들로 오는 늦은 증감은 이후 모두 실패)
+	slot.in_flight.store(CounterWord(handle, 0));
+	slot.db_pending.store(CounterWord(handle, 0));
+	slot.completed_request.store(CounterWord(handle, 0));
+
+	// 노드/워커를 채운 뒤 핸들을 공개
+	slot.handle.store(handle, std::memory_order_release);
+	_used.fetch_add(1);
+	return handle;
+}
+
+bool ConnectionSlab::Release(ConnectionHandle handle)
+{
+	uint32_t index = IndexOf(handle);
+	if (handle == INVALID_CONNECTION_HANDLE || index >= _capacity) {
+		return false;
+	}
+
+	std::lock_guard<std::mutex> lock(_free_mutex);
+	Slot& slot = _slots[index];
+	if (slot.handle.load(std::memory_order_relaxed) != handle) {
+		return false;
+	}
+
+	// 핸들부터 무효화해서 이후 조회가 바로 실패하도록 함
+	slot.handle.store(INVALID_CONNECTION_HANDLE, std::memory_order_release);
+	slot.worker.store(nullptr, std::memory_order_relaxed);
+	slot.node = nullptr;
+	slot.in_flight.store(CounterWord(INVALID_CONNECTION_HANDLE, 0));
+	slot.db_pending.store(CounterWord(INVALID_CONNECTION_HANDLE, 0));
+	slot.completed_request.store(CounterWord(INVALID_CONNECTION_HANDLE, 0));
+
+	// 세대는 1..CONNECTION_GENERATION_MASK 범위에서 순환 (0이면 핸들이 0이 될 수 있음)
+	slot.generation = (slot.generation & CONNECTION_GENERATION_MASK) + 1;
+	if (slot.generation > CONNECTION_GENERATION_MASK) {
+		slot.generation = 1;
+	}
+
+	_free_ring[(_free_head + _free_count) % _capacity] = index;
+	++_free_count;
+	_used.fetch_sub(1);
+	return true;
+}
+
+bool ConnectionSlab::IsLive(ConnectionHandle handle) const
+{
+	uint32_t index = IndexOf(handle);
+	if (handle == INVALID_CONNECTION_HANDLE || index >= _capacity) {
+		return false;
+	}
+	return _slots[index].handle.load(std::memory_order_acquire) == handle;
+}
+
+WorkerThread* ConnectionSlab::FindWorker(ConnectionHandle handle) const
+{
+	if (!IsLive(handle)) {
+		return nullptr;
+	}
+
+	const Slot& slot = _slots[IndexOf(handle)];
+	WorkerThread* worker = slot.worker.load(std::memory_order_acquire);
+
+	// 읽는 사이에 반납/재사용되었으면 다른 연결의 워커일 수 있으므로 다시 확인
+	if (slot.handle.load(std::memory_order_acquire) != handle) {
+		return nullptr;
+	}
+	return worker;
+}
+
+SocketNode* ConnectionSlab::FindNode(ConnectionHandle handle, const WorkerThread* owner) const
+{
+	// 슬롯은 소유 워커만 반납하므로 owner 스레드에서 확인한 결과는 그대로 유효하다
+	if (!IsLive(handle)) {
+		return nullptr;
+	}
+
+	const Slot& slot = _slots[IndexOf(handle)];
+	if (slot.worker.load(std::memory_order_relaxed) != owner) {
+		return nullptr;
+	}
+	return slot.node;
+}
+
+bool ConnectionSlab::AddToCounter(std::atomic<uint64_t>& counter, ConnectionHandle handle, uint32_t count, uint32_t& result)
+{
+	uint64_t current = counter.load();
+	do {
+		if (handle == INVALID_CONNECTION_HANDLE || static_cast<ConnectionHandle>(current >> 32) != handle) {
+			return false;
+		}
+		result = static_cast<uint32_t>(current) + count;
+	} while (!counter.compare_exchange_weak(current, CounterWord(handle, result)));
+	return true;
+}
+
+bool ConnectionSlab::SubtractFromCounter(std::atomic<uint64_t>& counter, ConnectionHandle handle, uint32_t count, uint32_t& result)
+{
+	uint64_t current = counter.load();
+	do {
+		uint32_t value = static_cast<uint32_t>(current);
+		if (handle == INVALID_CONNECTION_HANDLE || static_cast<ConnectionHandle>(current >> 32) != handle || value == 0) {
+			return false;
+		}
+		result = value > count ? value - count : 0;
+	} while (!counter.compare_exchange_weak(current, CounterWord(handle, result)));
+	return true;
+}
+
+uint32_t ConnectionSlab::ReadCounter(const std::atomic<uint64_t>& counter, ConnectionHandle handle)
+{
+	uint64_t current = counter.load();
+	if (handle == INVALID_CONNECTION_HANDLE || static_cast<ConnectionHandle>(current >> 32) != handle) {
+		return 0;
+	}
+	return static_cast<uint32_t>(current);
+}
+
+uint32_t ConnectionSlab::AcquireInFlight(ConnectionHandle handle)
+{
+	uint32_t index = IndexOf(handle);
+	uint32_t result = 0;
+	if (index >= _capacity || !AddToCounter(_slots[index].in_flight, handle, 1, result)) {
+		return 0;
+	}
+	return result;
+}
+
+bool ConnectionSlab::ReleaseInFlight(ConnectionHandle handle, uint32_t& remaining)
+{
+	uint32_t index = IndexOf(handle);
+	return index < _capacity && SubtractFromCounter(_slots[index].in_flight, handle, 1, remaining);
+}
+
+uint32_t ConnectionSlab::GetInFlight(ConnectionHandle handle) const
+{
+	uint32_t index = IndexOf(handle);
+	return index < _capacity ? ReadCounter(_slots[index].in_flight, handle) : 0;
+}
+
+void ConnectionSlab::AcquireDbPending(ConnectionHandle handle, uint32_t count)
+{
+	uint32_t index = IndexOf(handle);
+	uint32_t result = 0;
+	if (count == 0 || index >= _capacity) {
+		return;
+	}
+	AddToCounter(_slots[index].db_pending, handle, count, result);
+}
+
+void ConnectionSlab::ReleaseDbPending(ConnectionHandle handle, uint32_t count)
+{
+	uint32_t index = IndexOf(handle);
+	uint32_t result = 0;
+	if (count == 0 || index >= _capacity) {
+		return;
+	}
+	SubtractFromCounter(_slots[index].db_pending, handle, count, result);
+}
+
+bool ConnectionSlab::IsDbIdle(ConnectionHandle handle) const
+{
+	uint32_t index = IndexOf(handle);
+	if (handle == INVALID_CONNECTION_HANDLE || index >= _capacity) {
+		return false;
+	}
+	return _slots[index].db_pending.load() == CounterWord(handle, 0);
+}
+
+void ConnectionSlab::CompleteRequest(ConnectionHandle handle, uint32_t requestId)
+{
+	uint32_t index = IndexOf(handle);
+	if (requestId == 0 || handle == INVALID_CONNECTION_HANDLE || index >= _capacity) {
+		return;
+	}
+
+	std::atomic<uint64_t>& completed = _slots[index].completed_request;
+	uint64_t current = completed.load();
+	do {
+		if (static_cast<ConnectionHandle>(current >> 32) != handle) {
+			return;
+		}
+	} while (!completed.compare_exchange_weak(current, CounterWord(handle, requestId)));
+}
+
+uint32_t ConnectionSlab::GetCompletedRequest(ConnectionHandle handle) const
+{
+	uint32_t index = IndexOf(handle);
+	return index < _capacity ? ReadCounter(_slots[index].completed_request, handle) : 0;
+}
+
+std::vector<SocketNode*> ConnectionSlab::CollectNodes(const WorkerThread* owner) const
+{
+	std::vector<SocketNode*> nodes;
+	for (uint32_t i = 0; i < _capacity; ++i) {
+		const Slot& slot = _slots[i];
+		if (slot.handle.load(std::memory_order_acquire) != INVALID_CONNECTION_HANDLE &&
+			slot.worker.load(std::memory_order_relaxed) == owner) {
+			nodes.push_back(slot.node);
+		}
+	}
+	return nodes;
+}
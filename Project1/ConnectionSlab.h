@@ -0,0 +1,102 @@
+﻿#pragma once
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <cstdint>
+#include "Packet.h"
+
+class WorkerThread;
+struct SocketNode;
+
+#define CONNECTION_INDEX_BITS 20                                        // 슬롯 번호 비트 수 (최대 약 100만 연결)
+#define CONNECTION_INDEX_MASK ((1u << CONNECTION_INDEX_BITS) - 1)
+#define CONNECTION_GENERATION_MASK ((1u << (32 - CONNECTION_INDEX_BITS)) - 1)
+
+// 연결 슬랩 (서버 시작 시 고정 개수 미리 할당)
+// - 핸들 = (세대 << CONNECTION_INDEX_BITS) | 슬롯 번호, 세대는 1부터 시작하므로 0은 항상 무효 핸들이다.
+// - 슬롯을 반납하면 세대가 올라가므로 끊긴 연결로 가는 늦은 응답은 핸들 비교로 걸러진다.
+//   (소켓 번호는 OS가 바로 재사용하지만 핸들은 같은 슬롯이 세대 수만큼 다시 쓰여야 같아짐)
+// - 반납된 슬롯은 FIFO로 재사용해 같은 핸들이 다시 나오기까지의 간격을 최대한 벌린다.
+// - Allocate/Release는 잠금을 잡지만 조회는 잠금 없이 슬롯 번호로 바로 접근한다.
+// - 연결별 카운터(in_flight, db_pending)는 핸들과 값을 한 64비트 워드에 함께 두고 한 번의 CAS로 핸들 확인과
+//   증감을 한다. 따로 확인하면 그 사이 슬롯이 재사용되어 끊긴 연결의 늦은 완료가 새 연결의 값을 줄일 수 있다.
+class ConnectionSlab
+{
+private:
+    struct alignas(64) Slot {
+        std::atomic<ConnectionHandle> handle;  // 사용 중인 핸들 (비어 있으면 INVALID_CONNECTION_HANDLE)
+        std::atomic<WorkerThread*> worker;     // 연결을 소유한 워커
+        SocketNode* node;                      // 소유 워커 스레드에서만 역참조
+        uint32_t generation;                   // 다음에 쓸 세대 (_free_mutex로 보호)
+        std::atomic<uint64_t> in_flight;       // DB 스레드로 넘어가 아직 처리가 끝나지 않은 요청 수 (카운터 워드)
+        std::atomic<uint64_t> db_pending;      // 요청 큐에 들어가 아직 완료 알림이 오지 않은 Task 수 (카운터 워드, 샤드 이동 판단용)
+        std::atomic<uint64_t> completed_request; // 마지막으로 처리가 끝난 요청 번호 (카운터 워드, 거절 응답 순서용)
+    };
+
+    std::unique_ptr<Slot[]> _slots;
+    uint32_t _capacity;
+
+    std::mutex _free_mutex;
+    std::vector<uint32_t> _free_ring;  // 빈 슬롯 번호 원형 큐
+    size_t _free_head;
+    size_t _free_count;
+
+    std::atomic<uint32_t> _used;
+
+    static uint32_t IndexOf(ConnectionHandle handle) {
+        return handle & CONNECTION_INDEX_MASK;
+    }
+
+    // 카운터 워드 = (값을 쓰는 연결의 핸들 << 32) | 값
+    static uint64_t CounterWord(ConnectionHandle handle, uint32_t value) {
+        return (static_cast<uint64_t>(handle) << 32) | value;
+    }
+    // 핸들이 맞을 때만 더하거나(0 아래로는 내려가지 않게) 빼고 바뀐 값을 돌려줌 (핸들이 다르거나 뺄 값이 없으면 false)
+    static bool AddToCounter(std::atomic<uint64_t>& counter, ConnectionHandle handle, uint32_t count, uint32_t& result);
+    static bool SubtractFromCounter(std::atomic<uint64_t>& counter, ConnectionHandle handle, uint32_t count, uint32_t& result);
+    static uint32_t ReadCounter(const std::atomic<uint64_t>& counter, ConnectionHandle handle);
+
+public:
+    explicit ConnectionSlab(uint32_t capacity);
+
+    // 빈 슬롯에 연결 등록 (가득 차면 INVALID_CONNECTION_HANDLE)
+    ConnectionHandle Allocate(WorkerThread* worker, SocketNode* node);
+    // 슬롯 반납 (소켓을 닫기 전에 호출, 핸들이 이미 바뀌었으면 무시)
+    bool Release(ConnectionHandle handle);
+
+    // 살아있는 핸들인지 확인 (어느 스레드에서나 호출 가능)
+    bool IsLive(ConnectionHandle handle) const;
+    // 핸들의 소유 워커 (어느 스레드에서나 호출 가능, 경합 시 지난 값일 수 있으므로 워커가 FindNode로 다시 확인)
+    WorkerThread* FindWorker(ConnectionHandle handle) const;
+    // owner가 소유한 살아있는 연결의 노드 (owner 스레드에서만 호출)
+    SocketNode* FindNode(ConnectionHandle handle, const WorkerThread* owner) const;
+    // owner가 소유한 모든 노드 (owner 종료 시 정리용)
+    std::vector<SocketNode*> CollectNodes(const WorkerThread* owner) const;
+
+    // 처리 중인 요청 수 증가 후 값 (죽은 핸들이면 0, 소유 워커 스레드에서 호출)
+    uint32_t AcquireInFlight(ConnectionHandle handle);
+    // 처리 중인 요청 수 감소 (죽은 핸들이거나 이미 0이면 false, 어느 스레드에서나 호출 가능)
+    bool ReleaseInFlight(ConnectionHandle handle, uint32_t& remaining);
+    uint32_t GetInFlight(ConnectionHandle handle) const;
+
+    // 요청 큐에 넣을 Task 수만큼 증가 (넣기 전에 호출, 죽은 핸들이면 무시)
+    void AcquireDbPending(ConnectionHandle handle, uint32_t count);
+    // 완료되었거나 큐에 넣지 못한 Task 수만큼 감소 (0 아래로는 내려가지 않음, 어느 스레드에서나 호출 가능)
+    void ReleaseDbPending(ConnectionHandle handle, uint32_t count);
+    // 살아 있는 연결이고 완료 알림을 기다리는 Task가 없는지 (한 번의 읽기로 확인)
+    // 반납된 핸들은 카운터가 더 이상 맞지 않으므로 false - 끊긴 연결은 샤드를 옮기지 않는다
+    bool IsDbIdle(ConnectionHandle handle) const;
+
+    // DB 스레드가 요청 하나를 끝냄 (한 연결의 요청은 요청 큐 순서대로 끝나므로 마지막 번호만 기록)
+    void CompleteRequest(ConnectionHandle handle, uint32_t requestId);
+    // 마지막으로 끝난 요청 번호 (죽은 핸들이면 0)
+    uint32_t GetCompletedRequest(ConnectionHandle handle) const;
+    // 요청 번호 a가 b보다 앞인지 (32비트가 한 바퀴 돌아도 비교되도록 차이로 판단)
+    static bool IsEarlierRequest(uint32_t a, uint32_t b) {
+        return static_cast<int32_t>(a - b) < 0;
+    }
+
+    uint32_t GetCapacity() const { return _capacity; }
+    uint32_t GetUsed() const { return _used.load(); }
+};
@@ -0,0 +1,120 @@
+﻿#include "DatabasePool.h"
+#include <iostream>
+
+DatabasePool::DatabasePool(size_t executorCount, size_t queueCapacity,
+	const ResponseDispatcher& dispatchResponse, const TaskCompletionHandler& completeTask)
+	: _started(false), _deferred_disconnects(0)
+{
+	if (executorCount == 0) {
+		executorCount = 1;
+	}
+
+	for (size_t i = 0; i < executorCount; ++i) {
+		_queues.push_back(std::make_unique<TaskQueue>(queueCapacity));
+		_executors.push_back(std::make_unique<DatabaseThread>(_queues.back().get(),
+			dispatchResponse, completeTask, static_cast<int>(i)));
+	}
+}
+
+DatabasePool::~DatabasePool()
+{
+	Stop();
+}
+
+bool DatabasePool::Start()
+{
+	for (size_t i = 0; i < _executors.size(); ++i) {
+		if (!_executors[i]->ConnectDB() && i == 0) {
+			return false;
+		}
+	}
+
+	// 사용자 세션 테이블 확인 및 초기화 (실행기 스레드를 시작하기 전에 한 번만)
+	if (!_executors[0]->InitializeUserSessions()) {
+		std::cerr << "[DatabasePool] 사용자 세션 초기화 실패" << std::endl;
+		return false;
+	}
+
+	for (auto& executor : _executors) {
+		executor->Start();
+	}
+	_started = true;
+
+	std::cout << "[DatabasePool] DB 실행기 " << _executors.size() << "개 시작" << std::endl;
+	return true;
+}
+
+void DatabasePool::Stop()
+{
+	for (auto& executor : _executors) {
+		executor->Stop();
+	}
+	for (auto& executor : _executors) {
+		executor->Join();
+	}
+
+	// 스레드가 모두 멈췄으므로 첫 번째 실행기의 연결로 정리
+	// (요청 큐에 남은 연결 해제와 워커가 넘긴 연결 해제도 모든 세션을 오프라인으로 돌리는 여기서 함께 처리된다)
+	if (_started) {
+		_started = false;
+		uint64_t deferred = _deferred_disconnects.exchange(0);
+		if (deferred > 0) {
+			std::cout << "[DatabasePool] 요청 큐에 넣지 못한 연결 해제 " << deferred << "건을 종료 정리로 처리" << std::endl;
+		}
+		_executors[0]->DisconnectAllUsers();
+	}
+}
+
+void DatabasePool::DeferDisconnect(ConnectionHandle handle)
+{
+	_deferred_disconnects.fetch_add(1);
+	std::cout << "[DatabasePool] 연결 해제를 종료 정리로 넘김 - 핸들: " << handle << std::endl;
+}
+
+size_t DatabasePool::GetQueueDepth() const
+{
+	size_t depth = 0;
+	for (auto& queue : _queues) {
+		depth += queue->size();
+	}
+	return depth;
+}
+
+std::vector<size_t> DatabasePool::GetQueueDepths() const
+{
+	std::vector<size_t> depths;
+	depths.reserve(_queues.size());
+	for (auto& queue : _queues) {
+		depths.push_back(queue->size());
+	}
+	return depths;
+}
+
+size_t DatabasePool::GetQueueCapacity() const
+{
+	size_t capacity = 0;
+	for (auto& queue : _queues) {
+		capacity += queue->capacity();
+	}
+	return capacity;
+}
+
+size_t DatabasePool::GetConnectedCount() const
+{
+	size_t connected = 0;
+	for (auto& executor : _executors) {
+		if (executor->IsDBConnected()) {
+			++connected;
+		}
+	}
+	return connected;
+}
+
+uint64_t DatabasePool::GetReconnects() const
+{
+	uint64_t reconnects = 0;
+	for (auto& executor : _executors) {
+		reconnects += executor->GetReconnects();
+	}
+	return reconnects;
+}
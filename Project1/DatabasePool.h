@@ -0,0 +1,54 @@
+﻿#pragma once
+#include <memory>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include "Packet.h"  // ConnectionHandle
+#include "TaskQueue.h"
+#include "DatabaseThread.h"
+
+#define DB_POOL_DEFAULT_SIZE 4  // 기본 DB 실행기 수
+
+// DB 실행기 풀
+// - 실행기마다 자신의 요청 큐와 MYSQL 연결을 가지므로 느린 쿼리 하나가 다른 실행기의 요청을 막지 않는다.
+// - 요청은 샤드 키(로그인 후에는 user_id, 그 전에는 연결 핸들)로 실행기를 고르므로
+//   한 사용자의 요청(구매 -> 아이템 조회, 저장 -> 연결 해제)은 한 실행기에서 차례로 처리되고
+//   다른 사용자의 요청은 서로 다른 실행기에서 동시에 처리된다.
+// - 서버 전체 세션 초기화/정리는 실행기 스레드가 돌지 않을 때 첫 번째 실행기의 연결로 한 번만 한다.
+class DatabasePool
+{
+private:
+    std::vector<std::unique_ptr<TaskQueue>> _queues;
+    std::vector<std::unique_ptr<DatabaseThread>> _executors;
+    bool _started;
+    std::atomic<uint64_t> _deferred_disconnects;  // 요청 큐에 넣지 못한 채 종료 정리로 넘어온 연결 해제 수
+
+public:
+    DatabasePool(size_t executorCount, size_t queueCapacity,
+        const ResponseDispatcher& dispatchResponse, const TaskCompletionHandler& completeTask);
+    ~DatabasePool();
+
+    DatabasePool(const DatabasePool&) = delete;
+    DatabasePool& operator=(const DatabasePool&) = delete;
+
+    // 모든 실행기를 DB에 연결하고 세션을 초기화한 뒤 스레드 시작
+    // 첫 번째 실행기가 연결하지 못하면 false, 나머지는 실패해도 실행 중에 백오프를 두고 다시 연결한다
+    bool Start();
+    // 실행기를 모두 멈추고 기다린 뒤 남은 사용자 세션과 게임 서버를 정리 (여러 번 호출해도 한 번만 정리)
+    void Stop();
+    // 워커가 종료하면서 요청 큐에 넣지 못한 연결 해제를 넘김 (Stop의 전체 세션 정리에서 함께 처리, Stop 전에 호출)
+    void DeferDisconnect(ConnectionHandle handle);
+
+    // 샤드 키(user_id 또는 연결 핸들)의 요청을 넣을 요청 큐
+    TaskQueue* QueueFor(uint32_t shardKey) const {
+        return _queues[shardKey % _queues.size()].get();
+    }
+
+    size_t GetExecutorCount() const { return _executors.size(); }
+    size_t GetQueueDepth() const;
+    // 실행기(샤드)별 요청 큐 깊이 (한 실행기에만 몰리는 사용자를 찾는 용도)
+    std::vector<size_t> GetQueueDepths() const;
+    size_t GetQueueCapacity() const;
+    size_t GetConnectedCount() const;
+    uint64_t GetReconnects() const;
+};
@@ -1,9 +1,10 @@
 ﻿#define NOMINMAX
 
 #include "DatabaseThread.h"
-#include "LockFreeQueue.h"
+#include "TaskQueue.h"
 #include "Packet.h"
 #include "MySqlConnector.h"
+#include "RowReader.h"
 #include "ServerPacketManager.h"
 #include "UserEvent_generated.h"
 
@@ -11,8 +12,147 @@
 #include <sstream>
 #include <iomanip>
 
-DatabaseThread::DatabaseThread(LockFreeQueue<Task>* InRecvQueue, LockFreeQueue<DBResponse>* InSendQueue)
-	: RecvQueue(InRecvQueue), SendQueue(InSendQueue), _is_running(false), _port(3306)
+// === 준비된 문장 (연결마다 한 번 준비, 배열 주소로 캐시를 찾으므로 같은 SQL은 반드시 이 상수로 사용) ===
+
+// 세션
+static const char SQL_SESSION_ONLINE[] =
+	"INSERT INTO user_sessions (user_id, is_online, login_time, last_activity, client_socket) "
+	"VALUES (?, 1, NOW(), NOW(), ?) "
+	"ON DUPLICATE KEY UPDATE is_online = 1, login_time = NOW(), last_activity = NOW(), client_socket = VALUES(client_socket)";
+static const char SQL_SESSION_OFFLINE[] =
+	"UPDATE user_sessions SET is_online = 0, last_activity = NOW(), client_socket = 0 WHERE user_id = ?";
+static const char SQL_SESSION_FORCE_LOGOUT[] =
+	"UPDATE user_sessions SET is_online = FALSE, client_socket = 0, last_activity = NOW() "
+	"WHERE user_id = ? AND is_online = TRUE";
+static const char SQL_SESSION_CLEANUP_BY_SOCKET[] =
+	"UPDATE user_sessions SET is_online = FALSE, client_socket = 0, last_activity = NOW() "
+	"WHERE client_socket = ? AND is_online = TRUE";
+static const char SQL_SESSION_INSERT_DEFAULT[] =
+	"INSERT INTO user_sessions (user_id, is_online, login_time, last_activity, client_socket) "
+	"VALUES (?, FALSE, NOW(), NOW(), 0)";
+
+// 로그인/계정
+static const char SQL_LOGIN[] =
+	"SELECT u.user_id, u.nickname, COALESCE(p.level, 1) as level, COALESCE(s.is_online, 0) as is_online "
+	"FROM users u "
+	"LEFT JOIN player_data p ON u.user_id = p.user_id "
+	"LEFT JOIN user_sessions s ON u.user_id = s.user_id "
+	"WHERE u.username = ? AND u.password = ? AND u.is_active = 1";
+static const char SQL_ACCOUNT_CREATE[] =
+	"INSERT INTO users (username, password, nickname, created_at) "
+	"SELECT ?, ?, ?, NOW() "
+	"WHERE NOT EXISTS (SELECT 1 FROM users WHERE username = ?)";
+
+// 플레이어 데이터
+static const char SQL_PLAYER_SELECT[] =
+	"SELECT u.username, u.nickname, p.level, p.exp, p.hp, p.mp, p.attack, p.defense, p.gold, p.map_id, p.pos_x, p.pos_y "
+	"FROM users u JOIN player_data p ON u.user_id = p.user_id "
+	"WHERE u.user_id = ? AND u.is_active = 1";
+static const char SQL_PLAYER_UPDATE[] =
+	"UPDATE player_data SET level = ?, exp = ?, hp = ?, mp = ?, pos_x = ?, pos_y = ?, updated_at = NOW() "
+	"WHERE user_id = ?";
+static const char SQL_PLAYER_SAVE[] =
+	"UPDATE player_data SET level = ?, exp = ?, hp = ?, mp = ?, gold = ?, pos_x = ?, pos_y = ?, updated_at = NOW() "
+	"WHERE user_id = ?";
+static const char SQL_PLAYER_INSERT_DEFAULT[] =
+	"INSERT INTO player_data (user_id, level, exp, hp, mp, attack, defense, gold, map_id, pos_x, pos_y) "
+	"VALUES (?, 1, 0, 100, 50, 10, 5, 1000, 1, 0.0, 0.0)";
+static const char SQL_GOLD_SELECT[] =
+	"SELECT gold FROM player_data WHERE user_id = ?";
+static const char SQL_GOLD_SUBTRACT[] =
+	"UPDATE player_data SET gold = gold - ? WHERE user_id = ?";
+static const char SQL_GOLD_ADD[] =
+	"UPDATE player_data SET gold = gold + ? WHERE user_id = ?";
+
+// 인벤토리/아이템
+static const char SQL_INVENTORY_SELECT[] =
+	"SELECT i.item_id, m.item_name, i.item_count, m.item_type, m.base_price, "
+	"m.attack_bonus, m.defense_bonus, m.hp_bonus, m.mp_bonus, m.description, p.gold "
+	"FROM player_inventory i "
+	"JOIN item_master m ON i.item_id = m.item_id "
+	"JOIN player_data p ON i.user_id = p.user_id "
+	"WHERE i.user_id = ? ORDER BY i.item_id";
+static const char SQL_ITEM_MASTER_SELECT[] =
+	"SELECT item_id, item_name, 0 as item_count, item_type, base_price, "
+	"attack_bonus, defense_bonus, hp_bonus, mp_bonus, description "
+	"FROM item_master WHERE item_id = ?";
+static const char SQL_INVENTORY_ADD[] =
+	"INSERT INTO player_inventory (user_id, item_id, item_count, acquired_at) VALUES (?, ?, ?, NOW()) "
+	"ON DUPLICATE KEY UPDATE item_count = item_count + VALUES(item_count)";
+static const char SQL_INVENTORY_REMOVE[] =
+	"UPDATE player_inventory SET item_count = GREATEST(0, item_count - ?) WHERE user_id = ? AND item_id = ?";
+static const char SQL_INVENTORY_SUBTRACT[] =
+	"UPDATE player_inventory SET item_count = item_count - ? WHERE user_id = ? AND item_id = ?";
+static const char SQL_INVENTORY_DELETE_EMPTY[] =
+	"DELETE FROM player_inventory WHERE user_id = ? AND item_id = ? AND item_count <= 0";
+static const char SQL_INVENTORY_INSERT_DEFAULT[] =
+	"INSERT INTO player_inventory (user_id, item_id, item_count, acquired_at) VALUES "
+	"(?, 1, 1, NOW()), (?, 3, 1, NOW())";
+
+// 몬스터/채팅
+static const char SQL_MONSTER_SELECT[] =
+	"SELECT monster_id, monster_name, level, hp, attack, defense, exp_reward, gold_reward "
+	"FROM monster_master ORDER BY level, monster_id";
+static const char SQL_CHAT_SELECT[] =
+	"SELECT c.chat_id, c.sender_id, u.nickname, c.message, c.chat_type, UNIX_TIMESTAMP(c.timestamp) "
+	"FROM chat_logs c JOIN users u ON c.sender_id = u.user_id "
+	"WHERE c.chat_type = ? ORDER BY c.timestamp DESC LIMIT 50";
+static const char SQL_CHAT_SELECT_WITH[] =
+	"SELECT c.chat_id, c.sender_id, u.nickname, c.message, c.chat_type, UNIX_TIMESTAMP(c.timestamp) "
+	"FROM chat_logs c JOIN users u ON c.sender_id = u.user_id "
+	"WHERE c.chat_type = ? AND (c.receiver_id = ? OR c.sender_id = ?) ORDER BY c.timestamp DESC LIMIT 50";
+static const char SQL_CHAT_INSERT[] =
+	"INSERT INTO chat_logs (sender_id, receiver_id, message, chat_type, timestamp) VALUES (?, ?, ?, ?, NOW())";
+
+// 상점
+static const char SQL_SHOP_LIST[] =
+	"SELECT shop_id, shop_name, shop_type, map_id, pos_x, pos_y "
+	"FROM shop_master WHERE is_active = 1 ORDER BY shop_id";
+static const char SQL_SHOP_LIST_BY_MAP[] =
+	"SELECT shop_id, shop_name, shop_type, map_id, pos_x, pos_y "
+	"FROM shop_master WHERE is_active = 1 AND map_id = ? ORDER BY shop_id";
+static const char SQL_SHOP_ITEMS[] =
+	"SELECT i.item_id, i.item_name, i.item_type, i.base_price, "
+	"i.attack_bonus, i.defense_bonus, i.hp_bonus, i.mp_bonus, i.description "
+	"FROM shop_items s JOIN item_master i ON s.item_id = i.item_id "
+	"WHERE s.shop_id = ? ORDER BY i.item_id";
+static const char SQL_SHOP_PURCHASE_CHECK[] =
+	"SELECT i.base_price, p.gold FROM item_master i, player_data p WHERE i.item_id = ? AND p.user_id = ?";
+static const char SQL_SHOP_SELL_CHECK[] =
+	"SELECT i.item_count, m.base_price FROM player_inventory i "
+	"JOIN item_master m ON i.item_id = m.item_id WHERE i.user_id = ? AND i.item_id = ?";
+
+// 게임 서버
+static const char SQL_GAME_SERVER_CREATE[] =
+	"INSERT INTO game_servers (server_name, server_password, server_ip, server_port, "
+	"owner_user_id, owner_nickname, owner_socket, max_players) "
+	"SELECT ?, ?, ?, ?, ?, (SELECT nickname FROM users WHERE user_id = ?), ?, ? "
+	"WHERE NOT EXISTS (SELECT 1 FROM game_servers WHERE server_name = ? AND is_active = 1)";
+static const char SQL_GAME_SERVER_LIST[] =
+	"SELECT server_id, server_name, server_ip, server_port, owner_user_id, owner_nickname, "
+	"current_players, max_players, CASE WHEN server_password = '' THEN 0 ELSE 1 END as has_password "
+	"FROM game_servers "
+	"WHERE is_active = 1 "
+	"OR owner_user_id = (SELECT user_id FROM user_sessions WHERE client_socket = ? AND is_online = TRUE) "
+	"ORDER BY is_active DESC, created_at DESC";
+static const char SQL_GAME_SERVER_SELECT[] =
+	"SELECT server_name, server_password, server_ip, server_port, current_players, max_players, "
+	"owner_user_id, owner_socket, created_at, is_active "
+	"FROM game_servers WHERE server_id = ?";
+static const char SQL_GAME_SERVER_REACTIVATE[] =
+	"UPDATE game_servers SET is_active = TRUE, owner_socket = ? WHERE server_id = ?";
+static const char SQL_GAME_SERVER_CLOSE[] =
+	"UPDATE game_servers SET is_active = 0 WHERE server_id = ? AND owner_user_id = ? AND is_active = 1";
+static const char SQL_GAME_SERVER_CLOSE_BY_OWNER[] =
+	"UPDATE game_servers SET is_active = FALSE WHERE owner_user_id = ? AND is_active = TRUE";
+static const char SQL_GAME_SERVER_CLOSE_BY_SOCKET[] =
+	"UPDATE game_servers SET is_active = FALSE WHERE owner_socket = ? AND is_active = TRUE";
+
+DatabaseThread::DatabaseThread(TaskQueue* InRecvQueue, ResponseDispatcher dispatchResponse, TaskCompletionHandler completeTask, int index)
+	: _is_running(false), _index(index), RecvQueue(InRecvQueue), _dispatch_response(std::move(dispatchResponse)),
+	_complete_task(std::move(completeTask)), _port(3306),
+	_next_reconnect_at(std::chrono::steady_clock::now()), _last_db_activity(std::chrono::steady_clock::now()),
+	_reconnect_backoff_ms(DB_RECONNECT_BACKOFF_MIN_MS), _db_connected(false), _reconnects(0)
 {
 	_sql_connector = std::make_unique<MySqlConnector>();
 	_packet_manager = std::make_unique<ServerPacketManager>();
@@ -27,9 +167,7 @@ DatabaseThread::DatabaseThread(LockFreeQueue<Task>* InRecvQueue, LockFreeQueue<D
 DatabaseThread::~DatabaseThread()
 {
 	Stop();
-	if (_db_thread.joinable()) {
-		_db_thread.join();
-	}
+	Join();
 }
 
 void DatabaseThread::SetConnectionInfo(const std::string& host, const std::string& user,
@@ -45,30 +183,14 @@ void DatabaseThread::SetConnectionInfo(const std::string& host, const std::strin
 bool DatabaseThread::ConnectDB()
 {
 	try {
-		std::cout << "[DatabaseThread] 데이터베이스 연결 시도중..." << std::endl;
+		std::cout << "[DatabaseThread " << _index << "] 데이터베이스 연결 시도중..." << std::endl;
 
-		bool result = _sql_connector->Init();
-		if (result) {
-			result = _sql_connector->Connect(_host, _user, _password, _port, _database);
-		}
-
-		if (result) {
-			std::cout << "[DatabaseThread] 데이터베이스 연결 성공!" << std::endl;
-
-			// 사용자 세션 테이블 확인 및 초기화
-			if (!InitializeUserSessions()) {
-				std::cerr << "[DatabaseThread] 사용자 세션 초기화 실패" << std::endl;
-				return false;
-			}
-			// 연결 성공 시 스레드 시작
-			_is_running = true;
-			_db_thread = std::thread(&DatabaseThread::Run, this);
+		if (OpenConnection()) {
+			std::cout << "[DatabaseThread " << _index << "] 데이터베이스 연결 성공!" << std::endl;
 			return true;
 		}
-		else {
-			std::cerr << "[DatabaseThread] 데이터베이스 연결 실패!" << std::endl;
-			return false;
-		}
+		std::cerr << "[DatabaseThread " << _index << "] 데이터베이스 연결 실패!" << std::endl;
+		return false;
 	}
 	catch (const std::exception& e) {
 		std::cerr << "[DatabaseThread] 예외 발생: " << e.what() << std::endl;
@@ -76,11 +198,27 @@ bool DatabaseThread::ConnectDB()
 	}
 }
 
+void DatabaseThread::Start()
+{
+	_is_running = true;
+	_db_thread = std::thread(&DatabaseThread::Run, this);
+}
+
 void DatabaseThread::Stop()
 {
-	std::cout << "[DatabaseThread] 정지 신호 전송..." << std::endl;
-	DisconnectAllUsers();
-	_is_running.store(false);
+	if (!_is_running.exchange(false)) {
+		return;
+	}
+	std::cout << "[DatabaseThread " << _index << "] 정지 신호 전송..." << std::endl;
+	// 빈 큐에서 대기 중이면 바로 깨워 종료
+	RecvQueue->wake_all();
+}
+
+void DatabaseThread::Join()
+{
+	if (_db_thread.joinable()) {
+		_db_thread.join();
+	}
 }
 
 bool DatabaseThread::CheckDBConnection()
@@ -88,30 +226,72 @@ bool DatabaseThread::CheckDBConnection()
 	return _sql_connector && _sql_connector->IsConnected();
 }
 
+bool DatabaseThread::OpenConnection()
+{
+	// 끊긴 MYSQL 핸들은 재사용하지 않고 새로 만든다
+	_sql_connector = std::make_unique<MySqlConnector>();
+
+	auto now = std::chrono::steady_clock::now();
+	bool connected = _sql_connector->Init() &&
+		_sql_connector->Connect(_host, _user, _password, _port, _database);
+
+	if (connected) {
+		_reconnect_backoff_ms = DB_RECONNECT_BACKOFF_MIN_MS;
+		_last_db_activity = now;
+	}
+	else {
+		// 실패할 때마다 대기 시간을 두 배로 늘려 DB가 복구되는 동안 연결 시도가 몰리지 않게 함
+		_next_reconnect_at = now + std::chrono::milliseconds(_reconnect_backoff_ms);
+		_reconnect_backoff_ms = _reconnect_backoff_ms * 2 > DB_RECONNECT_BACKOFF_MAX_MS
+			? DB_RECONNECT_BACKOFF_MAX_MS : _reconnect_backoff_ms * 2;
+	}
+	_db_connected.store(connected);
+	return connected;
+}
+
 bool DatabaseThread::ReconnectIfNeeded()
 {
-	if (!CheckDBConnection()) {
-		std::cout << "[DatabaseThread] DB 연결 끊어짐, 재연결 시도..." << std::endl;
+	if (CheckDBConnection()) {
+		return true;
+	}
+	_db_connected.store(false);
 
-		_sql_connector.reset();
-		_sql_connector = std::make_unique<MySqlConnector>();
+	// 백오프 대기 중이면 기다리지 않고 바로 실패 (요청은 실패 응답을 받는다)
+	if (std::chrono::steady_clock::now() < _next_reconnect_at) {
+		return false;
+	}
 
-		if (_sql_connector->Init() &&
-			_sql_connector->Connect(_host, _user, _password, _port, _database)) {
-			std::cout << "[DatabaseThread] DB 재연결 성공!" << std::endl;
-			return true;
-		}
-		else {
-			std::cerr << "[DatabaseThread] DB 재연결 실패!" << std::endl;
-			return false;
+	std::cout << "[DatabaseThread " << _index << "] DB 연결 끊어짐, 재연결 시도..." << std::endl;
+	if (OpenConnection()) {
+		_reconnects.fetch_add(1);
+		std::cout << "[DatabaseThread " << _index << "] DB 재연결 성공!" << std::endl;
+		return true;
+	}
+
+	std::cerr << "[DatabaseThread " << _index << "] DB 재연결 실패! " << _reconnect_backoff_ms / 2 << "ms 후 다시 시도" << std::endl;
+	return false;
+}
+
+void DatabaseThread::CheckHealth()
+{
+	auto now = std::chrono::steady_clock::now();
+	if (now - _last_db_activity < std::chrono::seconds(DB_HEALTH_CHECK_INTERVAL_SEC)) {
+		return;
+	}
+
+	if (CheckDBConnection()) {
+		_last_db_activity = now;
+		if (_sql_connector->Ping()) {
+			return;
 		}
+		std::cerr << "[DatabaseThread " << _index << "] DB 헬스 체크 실패" << std::endl;
 	}
-	return true;
+	ReconnectIfNeeded();
 }
 
 bool DatabaseThread::IsDBConnected() const
 {
-	return _sql_connector && _sql_connector->IsConnected();
+	return _db_connected.load();
 }
 
 std::string DatabaseThread::GetStatus() const
@@ -147,66 +327,52 @@ bool DatabaseThread::InitializeUserSessions()
 	return false;
 }
 
-bool DatabaseThread::SetUserOnlineStatus(uint32_t user_id, bool is_online, uintptr_t client_socket)
+bool DatabaseThread::SetUserOnlineStatus(uint32_t user_id, bool is_online, ConnectionHandle client_socket)
 {
 	if (!CheckDBConnection()) {
 		return false;
 	}
 
-	try {
-		std::stringstream query;
-		if (is_online) {
-			query << "INSERT INTO user_sessions (user_id, is_online, login_time, last_activity, client_socket) "
-				<< "VALUES (" << user_id << ", 1, NOW(), NOW(), " << client_socket << ") "
-				<< "ON DUPLICATE KEY UPDATE is_online = 1, login_time = NOW(), last_activity = NOW(), client_socket = " << client_socket;
-		}
-		else {
-			query << "UPDATE user_sessions SET is_online = 0, last_activity = NOW(), client_socket = 0 "
-				<< "WHERE user_id = " << user_id;
-		}
+	PreparedStatement* stmt = _sql_connector->GetStatement(is_online ? SQL_SESSION_ONLINE : SQL_SESSION_OFFLINE);
+	if (!stmt) {
+		return false;
+	}
 
-		return _sql_connector->ExecuteQuery(query.str());
+	if (is_online) {
+		stmt->BindUInt(0, user_id);
+		stmt->BindUInt(1, client_socket);
 	}
-	catch (const std::exception& e) {
-		std::cerr << "[DatabaseThread] SetUserOnlineStatus 예외: " << e.what() << std::endl;
-		return false;
+	else {
+		stmt->BindUInt(0, user_id);
 	}
+	return _sql_connector->Execute(stmt);
 }
 
 bool DatabaseThread::ForceLogoutExistingSession(uint32_t user_id)
 {
-	try {
-		std::cout << "[DatabaseThread] 기존 세션 강제 종료 처리: 사용자 ID " << user_id << std::endl;
+	std::cout << "[DatabaseThread] 기존 세션 강제 종료 처리: 사용자 ID " << user_id << std::endl;
 
-		// 단순히 DB에서 해당 사용자를 오프라인으로 설정
-		std::stringstream logoutQuery;
-		logoutQuery << "UPDATE user_sessions SET "
-			<< "is_online = FALSE, "
-			<< "client_socket = 0, "
-			<< "last_activity = NOW() "
-			<< "WHERE user_id = " << user_id << " AND is_online = TRUE";
+	// 단순히 DB에서 해당 사용자를 오프라인으로 설정
+	PreparedStatement* stmt = _sql_connector->GetStatement(SQL_SESSION_FORCE_LOGOUT);
+	if (!stmt) {
+		std::cerr << "[DatabaseThread] 기존 세션 강제 종료 쿼리 준비 실패" << std::endl;
+		return false;
+	}
 
-		if (_sql_connector->ExecuteQuery(logoutQuery.str())) {
-			int affected_rows = _sql_connector->GetAffectedRows();
+	stmt->BindUInt(0, user_id);
+	if (!_sql_connector->Execute(stmt)) {
+		std::cerr << "[DatabaseThread] 기존 세션 강제 종료 쿼리 실패" << std::endl;
+		return false;
+	}
 
-			if (affected_rows > 0) {
-				std::cout << "[DatabaseThread] 기존 세션 강제 종료 성공: " << affected_rows << "개 세션 처리" << std::endl;
-				return true;
-			}
-			else {
-				std::cout << "[DatabaseThread] 처리할 활성 세션 없음: 사용자 ID " << user_id << std::endl;
-				return true; // 이미 오프라인이므로 성공으로 처리
-			}
-		}
-		else {
-			std::cerr << "[DatabaseThread] 기존 세션 강제 종료 쿼리 실패" << std::endl;
-			return false;
-		}
+	uint64_t affected_rows = stmt->GetAffectedRows();
+	if (affected_rows > 0) {
+		std::cout << "[DatabaseThread] 기존 세션 강제 종료 성공: " << affected_rows << "개 세션 처리" << std::endl;
 	}
-	catch (const std::exception& e) {
-		std::cerr << "[DatabaseThread] 기존 세션 강제 종료 중 예외: " << e.what() << std::endl;
-		return false;
+	else {
+		std::cout << "[DatabaseThread] 처리할 활성 세션 없음: 사용자 ID " << user_id << std::endl;
 	}
+	return true; // 이미 오프라인이어도 성공으로 처리
 }
 
 void DatabaseThread::DisconnectAllUsers()
@@ -246,121 +412,202 @@ void DatabaseThread::DisconnectUser(uint32_t user_id)
 
 void DatabaseThread::Run()
 {
-	std::cout << "[DatabaseThread] DB 처리 스레드 시작" << std::endl;
+	std::cout << "[DatabaseThread " << _index << "] DB 처리 스레드 시작" << std::endl;
+	mysql_thread_init();
+
+	// 큐가 비어 있으면 잠들되, 헬스 체크와 종료 신호 확인을 위해 주기적으로 깨어남
+	const int queue_wait_ms = 100;
 
-	auto last_connection_check = std::chrono::steady_clock::now();
-	const auto connection_check_interval = std::chrono::seconds(30);
+	_batch.resize(DB_TASK_BATCH_SIZE);
+	_batch_types.resize(DB_TASK_BATCH_SIZE);
+	_batch_completions.resize(DB_TASK_BATCH_SIZE);
 
 	while (_is_running.load()) {
-		// 주기적으로 DB 연결 상태 체크
-		auto now = std::chrono::steady_clock::now();
-		if (now - last_connection_check >= connection_check_interval) {
-			if (!ReconnectIfNeeded()) {
-				std::this_thread::sleep_for(std::chrono::seconds(5));
-				continue;
-			}
-			last_connection_check = now;
+		// 한동안 요청이 없었으면 연결 확인 (끊겨 있으면 백오프에 맞춰 재연결, 스레드는 재우지 않음)
+		CheckHealth();
+
+		// 큐에서 태스크를 최대 DB_TASK_BATCH_SIZE개씩 꺼내 처리 (비어 있으면 enqueue 통지나 타임아웃까지 대기)
+		size_t count = RecvQueue->wait_dequeue_bulk(_batch.data(), _batch.size(), queue_wait_ms);
+		if (count > 0) {
+			ProcessBatch(count);
+		}
+	}
+
+	mysql_thread_end();
+	std::cout << "[DatabaseThread " << _index << "] DB 처리 스레드 종료" << std::endl;
+}
+
+void DatabaseThread::ProcessBatch(size_t count)
+{
+	// 처리할 태스크만 앞쪽으로 모으면서 EventType을 구함 (DB 연결은 배치마다 한 번만 확인)
+	size_t kept = 0;
+	size_t skippedByDB = 0;
+	bool dbChecked = false;
+	bool dbReady = false;
+
+	// 앞으로 모으면서 순서가 바뀌므로 완료 알림 대상은 먼저 기록 (연결 해제 알림은 요청이 아님)
+	for (size_t i = 0; i < count; ++i) {
+		_batch_completions[i].client_handle = _batch[i].type == TaskType::CLIENT_DISCONNECTED
+			? INVALID_CONNECTION_HANDLE : _batch[i].client_handle;
+		_batch_completions[i].task_id = _batch[i].id;
+		_batch_completions[i].admitted_at = _batch[i].admitted_at;
+	}
+
+	for (size_t i = 0; i < count; ++i) {
+		EventType packetType = EventType_NONE;
+		if (!ClassifyTask(_batch[i], packetType)) {
+			continue;
 		}
 
-		// 큐에서 태스크 처리
-		Task task;
-		if (RecvQueue->dequeue(task)) {
-			try {
-				ProcessTask(task);
+		if (_batch[i].type != TaskType::CLIENT_DISCONNECTED) {
+			if (!dbChecked) {
+				dbReady = CheckDBConnection() || ReconnectIfNeeded();
+				dbChecked = true;
 			}
-			catch (const std::exception& e) {
-				std::cerr << "[DatabaseThread] 태스크 처리 중 예외 발생: " << e.what() << std::endl;
-				SendErrorResponse(task, EventType_NONE, ResultCode_FAIL);
+			if (!dbReady) {
+				// 재연결될 때까지 기다리게 하지 않고 바로 실패 응답
+				SendErrorResponse(_batch[i], _packet_manager->GetResponseType(packetType), ResultCode_FAIL);
+				++skippedByDB;
+				continue;
 			}
 		}
-		else {
-			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+		if (kept != i) {
+			_batch[kept] = std::move(_batch[i]);
+		}
+		_batch_types[kept] = packetType;
+		++kept;
+	}
+
+	if (skippedByDB > 0) {
+		std::cerr << "[DatabaseThread " << _index << "] DB 연결 실패, 태스크 " << skippedByDB << "개 실패 응답" << std::endl;
+	}
+	else if (kept > 0) {
+		_last_db_activity = std::chrono::steady_clock::now();
+	}
+
+	// 종류(TaskType, EventType)가 같은 연속 구간 단위로 처리
+	// 연결별 요청 순서가 바뀌지 않도록 배치 전체를 종류별로 다시 모으지는 않는다
+	size_t runStart = 0;
+	while (runStart < kept) {
+		size_t runEnd = runStart + 1;
+		while (runEnd < kept
+			&& _batch[runEnd].type == _batch[runStart].type
+			&& _batch_types[runEnd] == _batch_types[runStart]) {
+			++runEnd;
 		}
+		ProcessTaskRun(_batch_types[runStart], &_batch[runStart], runEnd - runStart);
+		runStart = runEnd;
 	}
 
-	std::cout << "[DatabaseThread] DB 처리 스레드 종료" << std::endl;
+	// 요청별 처리 완료를 알리고(연결당 처리 중인 요청 수 감소, 동시성 제한기 지연 측정) 다 쓴 프레임 버퍼를 바로 풀에 돌려줌
+	for (size_t i = 0; i < count; ++i) {
+		if (_batch_completions[i].client_handle != INVALID_CONNECTION_HANDLE && _complete_task) {
+			_complete_task(_batch_completions[i]);
+		}
+		_batch[i] = Task();
+	}
 }
 
-void DatabaseThread::ProcessTask(const Task& task)
+bool DatabaseThread::ClassifyTask(const Task& task, EventType& packetType)
 {
 	// TaskType이 CLIENT_DISCONNECTED인 경우 처리
 	if (task.type == TaskType::CLIENT_DISCONNECTED) {
-		HandleClientDisconnected(task);
-		return;
+		packetType = EventType_NONE;
+		return true;
 	}
 
 	if (!task.query.empty() && task.query.find("FORCE_LOGOUT:") == 0) {
-		return;
+		return false;
 	}
 
 	if (task.flatbuffer_data.empty()) {
 		std::cerr << "[DatabaseThread] 빈 FlatBuffer 데이터" << std::endl;
-		return;
+		return false;
 	}
 
-	if (!CheckDBConnection() && !ReconnectIfNeeded()) {
-		std::cerr << "[DatabaseThread] DB 연결 실패, 태스크 스킵" << std::endl;
-		return;
+	// WorkerThread가 이미 검증하고 종류를 실어 보낸 프레임은 다시 검증하지 않는다
+	if (task.event_type != EventType_NONE) {
+		packetType = task.event_type;
+		return true;
 	}
 
 	if (!_packet_manager->IsValidPacket(task.flatbuffer_data.data(), task.flatbuffer_data.size())) {
 		std::cerr << "[DatabaseThread] 잘못된 패킷: " << _packet_manager->GetLastError() << std::endl;
-		return;
+		return false;
+	}
+
+	packetType = _packet_manager->GetPacketType(task.flatbuffer_data.data(), task.flatbuffer_data.size());
+	return true;
+}
+
+void DatabaseThread::ProcessTaskRun(EventType packetType, const Task* tasks, size_t count)
+{
+	TaskHandler handler = nullptr;
+	if (tasks[0].type == TaskType::CLIENT_DISCONNECTED) {
+		handler = &DatabaseThread::HandleClientDisconnected;
+	}
+	else {
+		std::cout << "[DatabaseThread] 처리 중인 패킷: " << _packet_manager->GetPacketTypeName(packetType);
+		if (count > 1) {
+			std::cout << " x" << count;
+		}
+		std::cout << std::endl;
+
+		handler = GetTaskHandler(packetType);
+		if (handler == nullptr) {
+			std::cout << "[DatabaseThread] 처리되지 않은 패킷 타입: " << static_cast<int>(packetType) << std::endl;
+			return;
+		}
 	}
 
-	EventType packetType = _packet_manager->GetPacketType(task.flatbuffer_data.data(), task.flatbuffer_data.size());
-	std::cout << "[DatabaseThread] 처리 중인 패킷: " << _packet_manager->GetPacketTypeName(packetType) << std::endl;
+	for (size_t i = 0; i < count; ++i) {
+		try {
+			(this->*handler)(tasks[i]);
+		}
+		catch (const std::exception& e) {
+			std::cerr << "[DatabaseThread] 태스크 처리 중 예외 발생: " << e.what() << std::endl;
+			SendErrorResponse(tasks[i], EventType_NONE, ResultCode_FAIL);
+		}
+	}
+}
 
+DatabaseThread::TaskHandler DatabaseThread::GetTaskHandler(EventType packetType) const
+{
 	switch (packetType) {
 	case EventType_C2S_Login:
-		HandleLoginRequest(task);
-		break;
+		return &DatabaseThread::HandleLoginRequest;
 	case EventType_C2S_Logout:
-		HandleLogoutRequest(task);
-		break;
+		return &DatabaseThread::HandleLogoutRequest;
 	case EventType_C2S_CreateAccount:
-		HandleCreateAccountRequest(task);
-		break;
+		return &DatabaseThread::HandleCreateAccountRequest;
 	case EventType_C2S_PlayerData:
-		HandlePlayerDataRequest(task);
-		break;
+		return &DatabaseThread::HandlePlayerDataRequest;
 	case EventType_C2S_ItemData:
-		HandleItemDataRequest(task);
-		break;
+		return &DatabaseThread::HandleItemDataRequest;
 	case EventType_C2S_MonsterData:
-		HandleMonsterDataRequest(task);
-		break;
+		return &DatabaseThread::HandleMonsterDataRequest;
 	case EventType_C2S_PlayerChat:
-		HandlePlayerChatRequest(task);
-		break;
+		return &DatabaseThread::HandlePlayerChatRequest;
 	case EventType_C2S_ShopList:
-		HandleShopListRequest(task);
-		break;
+		return &DatabaseThread::HandleShopListRequest;
 	case EventType_C2S_ShopItems:
-		HandleShopItemsRequest(task);
-		break;
+		return &DatabaseThread::HandleShopItemsRequest;
 	case EventType_C2S_ShopTransaction:
-		HandleShopTransactionRequest(task);
-		break;
+		return &DatabaseThread::HandleShopTransactionRequest;
 		// === 게임 서버 관련 케이스들 ===
 	case EventType_C2S_CreateGameServer:
-		HandleCreateGameServerRequest(task);
-		break;
+		return &DatabaseThread::HandleCreateGameServerRequest;
 	case EventType_C2S_GameServerList:
-		HandleGameServerListRequest(task);
-		break;
+		return &DatabaseThread::HandleGameServerListRequest;
 	case EventType_C2S_JoinGameServer:
-		HandleJoinGameServerRequest(task);
-		break;
+		return &DatabaseThread::HandleJoinGameServerRequest;
 	case EventType_C2S_CloseGameServer:
-		HandleCloseGameServerRequest(task);
-		break;
+		return &DatabaseThread::HandleCloseGameServerRequest;
 	case EventType_C2S_SavePlayerData:
-		HandleSavePlayerDataRequest(task);
-		break;
+		return &DatabaseThread::HandleSavePlayerDataRequest;
 	default:
-		std::cout << "[DatabaseThread] 처리되지 않은 패킷 타입: " << static_cast<int>(packetType) << std::endl;
-		break;
+		return nullptr;
 	}
 }
 
@@ -379,42 +626,33 @@ void DatabaseThread::HandleLoginRequest(const Task& task)
 	std::cout << "[DatabaseThread] 로그인 요청 처리: " << loginReq->username()->c_str() << std::endl;
 
 	// 간소화된 로그인 처리: 인증과 중복 로그인 체크를 한 번에
-	std::stringstream query;
-	query << "SELECT u.user_id, u.nickname, COALESCE(p.level, 1) as level, "
-		<< "COALESCE(s.is_online, 0) as is_online "
-		<< "FROM users u "
-		<< "LEFT JOIN player_data p ON u.user_id = p.user_id "
-		<< "LEFT JOIN user_sessions s ON u.user_id = s.user_id "
-		<< "WHERE u.username = '" << loginReq->username()->c_str()
-		<< "' AND u.password = '" << loginReq->password()->c_str()
-		<< "' AND u.is_active = 1";
-
-	if (!_sql_connector->ExecuteQuery(query.str())) {
-		std::cerr << "[DatabaseThread] 로그인 쿼리 실행 실패" << std::endl;
+	PreparedStatement* stmt = _sql_connector->GetStatement(SQL_LOGIN);
+	if (!stmt) {
 		SendErrorResponse(task, EventType_S2C_Login, ResultCode_FAIL);
 		return;
 	}
 
-	MYSQL_RES* result = _sql_connector->GetResult();
-	if (!result) {
+	stmt->BindString(0, loginReq->username()->c_str(), loginReq->username()->size());
+	stmt->BindString(1, loginReq->password()->c_str(), loginReq->password()->size());
+	if (!_sql_connector->Execute(stmt)) {
+		std::cerr << "[DatabaseThread] 로그인 쿼리 실행 실패" << std::endl;
 		SendErrorResponse(task, EventType_S2C_Login, ResultCode_FAIL);
 		return;
 	}
 
-	MYSQL_ROW row = mysql_fetch_row(result);
-	if (!row) {
-		_sql_connector->FreeResult(result);
+	if (!stmt->Fetch()) {
+		stmt->FreeResult();
 		std::cout << "[DatabaseThread] 잘못된 사용자명 또는 비밀번호" << std::endl;
 		SendErrorResponse(task, EventType_S2C_Login, ResultCode_INVALID_USER);
 		return;
 	}
 
-	uint32_t user_id = std::stoul(row[0]);
-	std::string nickname = row[1] ? row[1] : "";
-	uint32_t level = std::stoul(row[2]);
-	bool is_online = row[3] && std::string(row[3]) == "1";
+	uint32_t user_id = stmt->GetUInt(0);
+	std::string nickname(stmt->GetString(1));
+	uint32_t level = stmt->GetUInt(2);
+	bool is_online = stmt->GetUInt(3) == 1;
 
-	_sql_connector->FreeResult(result);
+	stmt->FreeResult();
 
 	// 중복 로그인 시 기존 세션 강제 종료 + 새 로그인 차단
 	if (is_online) {
@@ -432,18 +670,18 @@ void DatabaseThread::HandleLoginRequest(const Task& task)
 
 		// 새 로그인 시도를 차단
 		auto responsePacket = _packet_manager->CreateLoginErrorResponse(
-			ResultCode_FAIL, task.client_socket);
-		SendResponse(task, responsePacket);
+			ResultCode_FAIL, task.client_handle);
+		SendResponse(task, std::move(responsePacket));
 
 		std::cout << "[DatabaseThread] 중복 로그인 차단 완료: " << loginReq->username()->c_str() << std::endl;
 		return;
 	}
 
 	// 새로운 로그인 처리 (간소화됨)
-	if (SetUserOnlineStatus(user_id, true, task.client_socket)) {
+	if (SetUserOnlineStatus(user_id, true, task.client_handle)) {
 		auto responsePacket = _packet_manager->CreateLoginResponse(
-			ResultCode_SUCCESS, user_id, loginReq->username()->str(), nickname, level, task.client_socket);
-		SendResponse(task, responsePacket);
+			ResultCode_SUCCESS, user_id, loginReq->username()->str(), nickname, level, task.client_handle);
+		SendResponse(task, std::move(responsePacket));
 
 		std::cout << "[DatabaseThread] 로그인 성공: " << loginReq->username()->c_str() << std::endl;
 	}
@@ -467,33 +705,28 @@ void DatabaseThread::HandleLogoutRequest(const Task& task)
 
 	uint32_t user_id = logoutReq->user_id();
 	std::cout << "[DatabaseThread] 로그아웃 요청 처리: 사용자 ID " << user_id << std::endl;
-	std::cout << "[DatabaseThread] 클라이언트 소켓: " << task.client_socket << std::endl;
+	std::cout << "[DatabaseThread] 클라이언트 소켓: " << task.client_handle << std::endl;
 
 	// ========== 추가: 게임 서버 정리 (소켓 연결은 유지) ==========
 	// 해당 사용자가 소유한 게임 서버들을 비활성화
-	try {
-		std::cout << "[DatabaseThread] 사용자 ID " << user_id << "의 게임 서버 정리 시작..." << std::endl;
-
-		std::stringstream query;
-		query << "UPDATE game_servers SET is_active = FALSE "
-			<< "WHERE owner_user_id = " << user_id << " AND is_active = TRUE";
+	std::cout << "[DatabaseThread] 사용자 ID " << user_id << "의 게임 서버 정리 시작..." << std::endl;
 
-		if (_sql_connector->ExecuteQuery(query.str())) {
-			int affected_rows = _sql_connector->GetAffectedRows();
-			if (affected_rows > 0) {
-				std::cout << "[DatabaseThread] " << affected_rows << "개의 게임 서버를 비활성화했습니다."
-					<< " (사용자 ID: " << user_id << ")" << std::endl;
-			}
-			else {
-				std::cout << "[DatabaseThread] 사용자 ID " << user_id << "가 소유한 활성 게임 서버 없음" << std::endl;
-			}
+	PreparedStatement* stmt = _sql_connector->GetStatement(SQL_GAME_SERVER_CLOSE_BY_OWNER);
+	if (stmt) {
+		stmt->BindUInt(0, user_id);
+	}
+	if (stmt && _sql_connector->Execute(stmt)) {
+		uint64_t affected_rows = stmt->GetAffectedRows();
+		if (affected_rows > 0) {
+			std::cout << "[DatabaseThread] " << affected_rows << "개의 게임 서버를 비활성화했습니다."
+				<< " (사용자 ID: " << user_id << ")" << std::endl;
 		}
 		else {
-			std::cerr << "[DatabaseThread] 게임 서버 정리 쿼리 실패 (사용자 ID: " << user_id << ")" << std::endl;
+			std::cout << "[DatabaseThread] 사용자 ID " << user_id << "가 소유한 활성 게임 서버 없음" << std::endl;
 		}
 	}
-	catch (const std::exception& e) {
-		std::cerr << "[DatabaseThread] 게임 서버 정리 중 예외: " << e.what() << std::endl;
+	else {
+		std::cerr << "[DatabaseThread] 게임 서버 정리 쿼리 실패 (사용자 ID: " << user_id << ")" << std::endl;
 	}
 	// =========================================================
 
@@ -504,7 +737,7 @@ void DatabaseThread::HandleLogoutRequest(const Task& task)
 	// 로그아웃 성공 응답 생성
 	std::cout << "[DatabaseThread] 로그아웃 응답 패킷 생성 중..." << std::endl;
 	auto responsePacket = _packet_manager->CreateLogoutResponse(
-		ResultCode_SUCCESS, "로그아웃 완료", task.client_socket);
+		ResultCode_SUCCESS, "로그아웃 완료", task.client_handle);
 
 	if (responsePacket.empty()) {
 		std::cerr << "[DatabaseThread] 로그아웃 응답 패킷 생성 실패!" << std::endl;
@@ -515,7 +748,7 @@ void DatabaseThread::HandleLogoutRequest(const Task& task)
 	std::cout << "[DatabaseThread] 로그아웃 응답 패킷 크기: " << responsePacket.size() << " bytes" << std::endl;
 
 	// 응답 전송 (소켓 연결 유지)
-	SendResponse(task, responsePacket);
+	SendResponse(task, std::move(responsePacket));
 
 	std::cout << "[DatabaseThread] 로그아웃 처리 완료: 사용자 ID " << user_id << std::endl;
 	std::cout << "[DatabaseThread] → 게임 서버 비활성화됨, 소켓 연결 유지됨" << std::endl;
@@ -534,65 +767,55 @@ void DatabaseThread::HandleCreateAccountRequest(const Task& task)
 	std::cout << "[DatabaseThread] 계정 생성 요청 처리: " << accountReq->username()->c_str() << std::endl;
 
 	// 중복 사용자명 확인과 계정 생성을 한 번에 처리
-	std::stringstream query;
-	query << "INSERT INTO users (username, password, nickname, created_at) "
-		<< "SELECT '" << accountReq->username()->c_str() << "', '"
-		<< accountReq->password()->c_str() << "', '"
-		<< accountReq->nickname()->c_str() << "', NOW() "
-		<< "WHERE NOT EXISTS (SELECT 1 FROM users WHERE username = '" << accountReq->username()->c_str() << "')";
-
-	if (_sql_connector->ExecuteQuery(query.str()) && _sql_connector->GetAffectedRows() > 0) {
-		// 생성된 user_id 가져오기
-		std::string getIdQuery = "SELECT LAST_INSERT_ID()";
-		if (_sql_connector->ExecuteQuery(getIdQuery)) {
-			MYSQL_RES* result = _sql_connector->GetResult();
-			if (result) {
-				MYSQL_ROW row = mysql_fetch_row(result);
-				if (row) {
-					uint32_t new_user_id = std::stoul(row[0]);
-					_sql_connector->FreeResult(result);
-
-					// 기본 플레이어 데이터 생성
-					CreateDefaultPlayerData(new_user_id);
-
-					auto responsePacket = _packet_manager->CreateAccountResponse(
-						ResultCode_SUCCESS, new_user_id, "계정 생성 성공", task.client_socket);
-					SendResponse(task, responsePacket);
-
-					std::cout << "[DatabaseThread] 계정 생성 성공: " << accountReq->username()->c_str()
-						<< " (ID: " << new_user_id << ")" << std::endl;
-					return;
-				}
-				_sql_connector->FreeResult(result);
-			}
-		}
+	PreparedStatement* stmt = _sql_connector->GetStatement(SQL_ACCOUNT_CREATE);
+	if (stmt) {
+		stmt->BindString(0, accountReq->username()->c_str(), accountReq->username()->size());
+		stmt->BindString(1, accountReq->password()->c_str(), accountReq->password()->size());
+		stmt->BindString(2, accountReq->nickname()->c_str(), accountReq->nickname()->size());
+		stmt->BindString(3, accountReq->username()->c_str(), accountReq->username()->size());
+	}
+
+	if (stmt && _sql_connector->Execute(stmt) && stmt->GetAffectedRows() > 0) {
+		// 생성된 user_id는 실행 결과에 함께 오므로 LAST_INSERT_ID()를 따로 조회하지 않는다
+		uint32_t new_user_id = static_cast<uint32_t>(stmt->GetInsertId());
+
+		// 기본 플레이어 데이터 생성
+		CreateDefaultPlayerData(new_user_id);
+
+		auto responsePacket = _packet_manager->CreateAccountResponse(
+			ResultCode_SUCCESS, new_user_id, "계정 생성 성공", task.client_handle);
+		SendResponse(task, std::move(responsePacket));
+
+		std::cout << "[DatabaseThread] 계정 생성 성공: " << accountReq->username()->c_str()
+			<< " (ID: " << new_user_id << ")" << std::endl;
+		return;
 	}
 
 	auto responsePacket = _packet_manager->CreateAccountErrorResponse(
-		ResultCode_FAIL, "이미 존재하는 사용자명이거나 계정 생성에 실패했습니다", task.client_socket);
-	SendResponse(task, responsePacket);
+		ResultCode_FAIL, "이미 존재하는 사용자명이거나 계정 생성에 실패했습니다", task.client_handle);
+	SendResponse(task, std::move(responsePacket));
 }
 
 void DatabaseThread::CreateDefaultPlayerData(uint32_t user_id)
 {
 	// 기본 플레이어 데이터 생성
-	std::stringstream playerInsert;
-	playerInsert << "INSERT INTO player_data (user_id, level, exp, hp, mp, attack, defense, gold, map_id, pos_x, pos_y) "
-		<< "VALUES (" << user_id << ", 1, 0, 100, 50, 10, 5, 1000, 1, 0.0, 0.0)";
-	_sql_connector->ExecuteQuery(playerInsert.str());
+	if (PreparedStatement* stmt = _sql_connector->GetStatement(SQL_PLAYER_INSERT_DEFAULT)) {
+		stmt->BindUInt(0, user_id);
+		_sql_connector->Execute(stmt);
+	}
 
 	// 기본 아이템 지급
-	std::stringstream itemInsert;
-	itemInsert << "INSERT INTO player_inventory (user_id, item_id, item_count, acquired_at) VALUES "
-		<< "(" << user_id << ", 1, 1, NOW()), "
-		<< "(" << user_id << ", 3, 1, NOW())";
-	_sql_connector->ExecuteQuery(itemInsert.str());
+	if (PreparedStatement* stmt = _sql_connector->GetStatement(SQL_INVENTORY_INSERT_DEFAULT)) {
+		stmt->BindUInt(0, user_id);
+		stmt->BindUInt(1, user_id);
+		_sql_connector->Execute(stmt);
+	}
 
 	// 사용자 세션 초기 생성
-	std::stringstream sessionInsert;
-	sessionInsert << "INSERT INTO user_sessions (user_id, is_online, login_time, last_activity, client_socket) "
-		<< "VALUES (" << user_id << ", FALSE, NOW(), NOW(), 0)";
-	_sql_connector->ExecuteQuery(sessionInsert.str());
+	if (PreparedStatement* stmt = _sql_connector->GetStatement(SQL_SESSION_INSERT_DEFAULT)) {
+		stmt->BindUInt(0, user_id);
+		_sql_connector->Execute(stmt);
+	}
 }
 
 void DatabaseThread::HandlePlayerDataRequest(const Task& task)
@@ -606,16 +829,12 @@ void DatabaseThread::HandlePlayerDataRequest(const Task& task)
 
 	if (playerReq->request_type() == 0) {
 		// 조회
-		std::stringstream query;
-		query << "SELECT u.username, u.nickname, p.level, p.exp, p.hp, p.mp, p.attack, p.defense, p.gold, p.map_id, p.pos_x, p.pos_y "
-			<< "FROM users u JOIN player_data p ON u.user_id = p.user_id "
-			<< "WHERE u.user_id = " << playerReq->user_id() << " AND u.is_active = 1";
-
-		if (_sql_connector->ExecuteQuery(query.str())) {
-			MYSQL_RES* result = _sql_connector->GetResult();
-			if (result) {
-				auto responsePacket = _packet_manager->CreatePlayerDataResponseFromDB(result, playerReq->user_id(), task.client_socket);
-				SendResponse(task, responsePacket);
+		PreparedStatement* stmt = _sql_connector->GetStatement(SQL_PLAYER_SELECT);
+		if (stmt) {
+			stmt->BindUInt(0, playerReq->user_id());
+			if (_sql_connector->Execute(stmt)) {
+				auto responsePacket = _packet_manager->CreatePlayerDataResponseFromDB(stmt, playerReq->user_id(), task.client_handle);
+				SendResponse(task, std::move(responsePacket));
 				return;
 			}
 		}
@@ -623,24 +842,24 @@ void DatabaseThread::HandlePlayerDataRequest(const Task& task)
 	}
 	else if (playerReq->request_type() == 1) {
 		// 업데이트
-		std::stringstream query;
-		query << "UPDATE player_data SET "
-			<< "level = " << playerReq->level() << ", "
-			<< "exp = " << playerReq->exp() << ", "
-			<< "hp = " << playerReq->hp() << ", "
-			<< "mp = " << playerReq->mp() << ", "
-			<< "pos_x = " << playerReq->pos_x() << ", "
-			<< "pos_y = " << playerReq->pos_y() << ", "
-			<< "updated_at = NOW() "
-			<< "WHERE user_id = " << playerReq->user_id();
-
-		if (_sql_connector->ExecuteQuery(query.str())) {
+		PreparedStatement* stmt = _sql_connector->GetStatement(SQL_PLAYER_UPDATE);
+		if (stmt) {
+			stmt->BindUInt(0, playerReq->level());
+			stmt->BindUInt(1, playerReq->exp());
+			stmt->BindUInt(2, playerReq->hp());
+			stmt->BindUInt(3, playerReq->mp());
+			stmt->BindFloat(4, playerReq->pos_x());
+			stmt->BindFloat(5, playerReq->pos_y());
+			stmt->BindUInt(6, playerReq->user_id());
+		}
+
+		if (stmt && _sql_connector->Execute(stmt)) {
 			auto responsePacket = _packet_manager->CreatePlayerDataResponse(
 				ResultCode_SUCCESS, playerReq->user_id(), "", "",
 				playerReq->level(), playerReq->exp(), playerReq->hp(),
 				playerReq->mp(), 0, 0, 0, 0, playerReq->pos_x(),
-				playerReq->pos_y(), task.client_socket);
-			SendResponse(task, responsePacket);
+				playerReq->pos_y(), task.client_handle);
+			SendResponse(task, std::move(responsePacket));
 			std::cout << "[DatabaseThread] 플레이어 데이터 업데이트 완료: 사용자 ID " << playerReq->user_id() << std::endl;
 		}
 		else {
@@ -660,39 +879,28 @@ void DatabaseThread::HandleItemDataRequest(const Task& task)
 
 	if (itemReq->request_type() == 0) {
 		// 인벤토리 조회
-		std::stringstream query;
-		query << "SELECT i.item_id, m.item_name, i.item_count, m.item_type, m.base_price, "
-			<< "m.attack_bonus, m.defense_bonus, m.hp_bonus, m.mp_bonus, m.description, p.gold "
-			<< "FROM player_inventory i "
-			<< "JOIN item_master m ON i.item_id = m.item_id "
-			<< "JOIN player_data p ON i.user_id = p.user_id "
-			<< "WHERE i.user_id = " << itemReq->user_id()
-			<< " ORDER BY i.item_id";
-
-		if (_sql_connector->ExecuteQuery(query.str())) {
-			MYSQL_RES* result = _sql_connector->GetResult();
-			if (result) {
-				auto responsePacket = _packet_manager->CreateItemDataResponseFromDB(result, itemReq->user_id(), task.client_socket);
-				SendResponse(task, responsePacket);
+		PreparedStatement* stmt = _sql_connector->GetStatement(SQL_INVENTORY_SELECT);
+		if (stmt) {
+			stmt->BindUInt(0, itemReq->user_id());
+			// 인벤토리는 길어질 수 있으므로 읽는 대로 조각으로 나눠 바로 보낸다
+			if (_sql_connector->ExecuteStreaming(stmt)) {
+				_packet_manager->CreateItemDataResponseFromDB(stmt, itemReq->user_id(),
+					[this, &task](PacketBuffer&& chunk) { SendResponse(task, std::move(chunk)); }, task.client_handle);
 				return;
 			}
 		}
 		// 인벤토리가 비어있는 경우
-		auto responsePacket = _packet_manager->CreateItemDataResponse(ResultCode_SUCCESS, itemReq->user_id(), 0, task.client_socket);
-		SendResponse(task, responsePacket);
+		auto responsePacket = _packet_manager->CreateItemDataResponse(ResultCode_SUCCESS, itemReq->user_id(), 0, task.client_handle);
+		SendResponse(task, std::move(responsePacket));
 	}
 	else if (itemReq->request_type() == 3) {  // 새로 추가
 		// 특정 아이템 정보 조회
-		std::stringstream query;
-		query << "SELECT item_id, item_name, 0 as item_count, item_type, base_price, "
-			<< "attack_bonus, defense_bonus, hp_bonus, mp_bonus, description "
-			<< "FROM item_master WHERE item_id = " << itemReq->item_id();
-
-		if (_sql_connector->ExecuteQuery(query.str())) {
-			MYSQL_RES* result = _sql_connector->GetResult();
-			if (result) {
-				auto responsePacket = _packet_manager->CreateItemDataResponseFromDB(result, 0, task.client_socket);
-				SendResponse(task, responsePacket);
+		PreparedStatement* stmt = _sql_connector->GetStatement(SQL_ITEM_MASTER_SELECT);
+		if (stmt) {
+			stmt->BindUInt(0, itemReq->item_id());
+			if (_sql_connector->Execute(stmt)) {
+				_packet_manager->CreateItemDataResponseFromDB(stmt, 0,
+					[this, &task](PacketBuffer&& chunk) { SendResponse(task, std::move(chunk)); }, task.client_handle);
 				return;
 			}
 		}
@@ -706,28 +914,40 @@ void DatabaseThread::HandleItemDataRequest(const Task& task)
 
 void DatabaseThread::HandleItemModification(const Task& task, const C2S_ItemData* itemReq)
 {
-	std::stringstream query;
+	bool success = false;
 
 	if (itemReq->request_type() == 1) {
 		// 아이템 추가
-		query << "INSERT INTO player_inventory (user_id, item_id, item_count, acquired_at) VALUES ("
-			<< itemReq->user_id() << ", " << itemReq->item_id() << ", "
-			<< itemReq->item_count() << ", NOW()) "
-			<< "ON DUPLICATE KEY UPDATE item_count = item_count + " << itemReq->item_count();
+		PreparedStatement* stmt = _sql_connector->GetStatement(SQL_INVENTORY_ADD);
+		if (stmt) {
+			stmt->BindUInt(0, itemReq->user_id());
+			stmt->BindUInt(1, itemReq->item_id());
+			stmt->BindUInt(2, itemReq->item_count());
+			success = _sql_connector->Execute(stmt);
+		}
 	}
 	else if (itemReq->request_type() == 2) {
-		// 아이템 제거
-		query << "START TRANSACTION; "
-			<< "UPDATE player_inventory SET item_count = GREATEST(0, item_count - " << itemReq->item_count() << ") "
-			<< "WHERE user_id = " << itemReq->user_id() << " AND item_id = " << itemReq->item_id() << "; "
-			<< "DELETE FROM player_inventory WHERE user_id = " << itemReq->user_id()
-			<< " AND item_id = " << itemReq->item_id() << " AND item_count <= 0; "
-			<< "COMMIT;";
-	}
-
-	if (_sql_connector->ExecuteQuery(query.str())) {
-		auto responsePacket = _packet_manager->CreateItemDataResponse(ResultCode_SUCCESS, itemReq->user_id(), 0, task.client_socket);
-		SendResponse(task, responsePacket);
+		// 아이템 제거 (수량 감소와 0개 삭제를 한 트랜잭션으로)
+		PreparedStatement* removeStmt = _sql_connector->GetStatement(SQL_INVENTORY_REMOVE);
+		PreparedStatement* deleteStmt = _sql_connector->GetStatement(SQL_INVENTORY_DELETE_EMPTY);
+		if (removeStmt && deleteStmt && _sql_connector->ExecuteQuery("START TRANSACTION")) {
+			removeStmt->BindUInt(0, itemReq->item_count());
+			removeStmt->BindUInt(1, itemReq->user_id());
+			removeStmt->BindUInt(2, itemReq->item_id());
+			deleteStmt->BindUInt(0, itemReq->user_id());
+			deleteStmt->BindUInt(1, itemReq->item_id());
+
+			success = _sql_connector->Execute(removeStmt) && _sql_connector->Execute(deleteStmt)
+				&& _sql_connector->ExecuteQuery("COMMIT");
+			if (!success) {
+				_sql_connector->ExecuteQuery("ROLLBACK");
+			}
+		}
+	}
+
+	if (success) {
+		auto responsePacket = _packet_manager->CreateItemDataResponse(ResultCode_SUCCESS, itemReq->user_id(), 0, task.client_handle);
+		SendResponse(task, std::move(responsePacket));
 		std::cout << "[DatabaseThread] 아이템 수정 완료: 사용자 ID " << itemReq->user_id() << " Request Type : " << itemReq->request_type() << std::endl;
 	}
 	else {
@@ -745,16 +965,11 @@ void DatabaseThread::HandleMonsterDataRequest(const Task& task)
 	}
 
 	if (monsterReq->request_type() == 0) {
-		std::string query = "SELECT monster_id, monster_name, level, hp, attack, defense, exp_reward, gold_reward "
-			"FROM monster_master ORDER BY level, monster_id";
-
-		if (_sql_connector->ExecuteQuery(query)) {
-			MYSQL_RES* result = _sql_connector->GetResult();
-			if (result) {
-				auto responsePacket = _packet_manager->CreateMonsterDataResponseFromDB(result, task.client_socket);
-				SendResponse(task, responsePacket);
-				return;
-			}
+		PreparedStatement* stmt = _sql_connector->GetStatement(SQL_MONSTER_SELECT);
+		if (stmt && _sql_connector->Execute(stmt)) {
+			auto responsePacket = _packet_manager->CreateMonsterDataResponseFromDB(stmt, task.client_handle);
+			SendResponse(task, std::move(responsePacket));
+			return;
 		}
 	}
 	SendErrorResponse(task, EventType_S2C_MonsterData, ResultCode_FAIL);
@@ -770,57 +985,48 @@ void DatabaseThread::HandlePlayerChatRequest(const Task& task)
 	}
 
 	if (chatReq->request_type() == 0) {
-		// 채팅 로그 조회
-		std::stringstream query;
-		query << "SELECT c.chat_id, c.sender_id, u.nickname, c.message, c.chat_type, UNIX_TIMESTAMP(c.timestamp) "
-			<< "FROM chat_logs c "
-			<< "JOIN users u ON c.sender_id = u.user_id "
-			<< "WHERE c.chat_type = " << chatReq->chat_type();
-
-		if (chatReq->receiver_id() != 0) {
-			query << " AND (c.receiver_id = " << chatReq->receiver_id()
-				<< " OR c.sender_id = " << chatReq->receiver_id() << ")";
-		}
-
-		query << " ORDER BY c.timestamp DESC LIMIT 50";
+		// 채팅 로그 조회 (상대가 지정되면 그 상대와 주고받은 것만)
+		PreparedStatement* stmt = _sql_connector->GetStatement(
+			chatReq->receiver_id() != 0 ? SQL_CHAT_SELECT_WITH : SQL_CHAT_SELECT);
+		if (stmt) {
+			stmt->BindUInt(0, chatReq->chat_type());
+			if (chatReq->receiver_id() != 0) {
+				stmt->BindUInt(1, chatReq->receiver_id());
+				stmt->BindUInt(2, chatReq->receiver_id());
+			}
 
-		if (_sql_connector->ExecuteQuery(query.str())) {
-			MYSQL_RES* result = _sql_connector->GetResult();
-			if (result) {
-				auto responsePacket = _packet_manager->CreatePlayerChatResponseFromDB(result, task.client_socket);
-				SendResponse(task, responsePacket);
+			if (_sql_connector->ExecuteStreaming(stmt)) {
+				_packet_manager->CreatePlayerChatResponseFromDB(stmt,
+					[this, &task](PacketBuffer&& chunk) { SendResponse(task, std::move(chunk)); }, task.client_handle);
 				return;
 			}
 		}
 	}
 	else if (chatReq->request_type() == 1) {
-		// 채팅 메시지 저장
-		std::stringstream insertQuery;
-		insertQuery << "INSERT INTO chat_logs (sender_id, receiver_id, message, chat_type, timestamp) VALUES ("
-			<< chatReq->sender_id() << ", ";
-
-		if (chatReq->receiver_id() == 0) {
-			insertQuery << "NULL, ";
-		}
-		else {
-			insertQuery << chatReq->receiver_id() << ", ";
-		}
-
-		// 간단한 이스케이프 처리
-		std::string escaped_message = chatReq->message()->str();
-		size_t pos = 0;
-		while ((pos = escaped_message.find("'", pos)) != std::string::npos) {
-			escaped_message.replace(pos, 1, "\\'");
-			pos += 2;
-		}
-
-		insertQuery << "'" << escaped_message << "', " << chatReq->chat_type() << ", NOW())";
+		// 채팅 메시지 저장 (메시지는 파라미터로 보내므로 이스케이프하지 않는다)
+		PreparedStatement* stmt = _sql_connector->GetStatement(SQL_CHAT_INSERT);
+		if (stmt) {
+			stmt->BindUInt(0, chatReq->sender_id());
+			if (chatReq->receiver_id() == 0) {
+				stmt->BindNull(1);
+			}
+			else {
+				stmt->BindUInt(1, chatReq->receiver_id());
+			}
+			if (chatReq->message()) {
+				stmt->BindString(2, chatReq->message()->c_str(), chatReq->message()->size());
+			}
+			else {
+				stmt->BindString(2, "", 0);
+			}
+			stmt->BindUInt(3, chatReq->chat_type());
 
-		if (_sql_connector->ExecuteQuery(insertQuery.str())) {
-			auto responsePacket = _packet_manager->CreatePlayerChatResponse(ResultCode_SUCCESS, task.client_socket);
-			SendResponse(task, responsePacket);
-			std::cout << "[DatabaseThread] 채팅 메시지 저장 완료 - 발신자: " << chatReq->sender_id() << std::endl;
-			return;
+			if (_sql_connector->Execute(stmt)) {
+				auto responsePacket = _packet_manager->CreatePlayerChatResponse(ResultCode_SUCCESS, task.client_handle);
+				SendResponse(task, std::move(responsePacket));
+				std::cout << "[DatabaseThread] 채팅 메시지 저장 완료 - 발신자: " << chatReq->sender_id() << std::endl;
+				return;
+			}
 		}
 	}
 	SendErrorResponse(task, EventType_S2C_PlayerChat, ResultCode_FAIL);
@@ -835,21 +1041,16 @@ void DatabaseThread::HandleShopListRequest(const Task& task)
 		return;
 	}
 
-	std::stringstream query;
-	query << "SELECT shop_id, shop_name, shop_type, map_id, pos_x, pos_y "
-		<< "FROM shop_master WHERE is_active = 1";
-
-	if (shopReq->map_id() != 0) {
-		query << " AND map_id = " << shopReq->map_id();
-	}
-
-	query << " ORDER BY shop_id";
+	PreparedStatement* stmt = _sql_connector->GetStatement(
+		shopReq->map_id() != 0 ? SQL_SHOP_LIST_BY_MAP : SQL_SHOP_LIST);
+	if (stmt) {
+		if (shopReq->map_id() != 0) {
+			stmt->BindUInt(0, shopReq->map_id());
+		}
 
-	if (_sql_connector->ExecuteQuery(query.str())) {
-		MYSQL_RES* result = _sql_connector->GetResult();
-		if (result) {
-			auto responsePacket = _packet_manager->CreateShopListResponseFromDB(result, task.client_socket);
-			SendResponse(task, responsePacket);
+		if (_sql_connector->Execute(stmt)) {
+			auto responsePacket = _packet_manager->CreateShopListResponseFromDB(stmt, task.client_handle);
+			SendResponse(task, std::move(responsePacket));
 			return;
 		}
 	}
@@ -865,19 +1066,12 @@ void DatabaseThread::HandleShopItemsRequest(const Task& task)
 		return;
 	}
 
-	std::stringstream query;
-	query << "SELECT i.item_id, i.item_name, i.item_type, i.base_price, "
-		<< "i.attack_bonus, i.defense_bonus, i.hp_bonus, i.mp_bonus, i.description "
-		<< "FROM shop_items s "
-		<< "JOIN item_master i ON s.item_id = i.item_id "
-		<< "WHERE s.shop_id = " << shopItemsReq->shop_id()
-		<< " ORDER BY i.item_id";
-
-	if (_sql_connector->ExecuteQuery(query.str())) {
-		MYSQL_RES* result = _sql_connector->GetResult();
-		if (result) {
-			auto responsePacket = _packet_manager->CreateShopItemsResponseFromDB(result, shopItemsReq->shop_id(), task.client_socket);
-			SendResponse(task, responsePacket);
+	PreparedStatement* stmt = _sql_connector->GetStatement(SQL_SHOP_ITEMS);
+	if (stmt) {
+		stmt->BindUInt(0, shopItemsReq->shop_id());
+		if (_sql_connector->Execute(stmt)) {
+			auto responsePacket = _packet_manager->CreateShopItemsResponseFromDB(stmt, shopItemsReq->shop_id(), task.client_handle);
+			SendResponse(task, std::move(responsePacket));
 			return;
 		}
 	}
@@ -913,47 +1107,34 @@ void DatabaseThread::HandleCreateGameServerRequest(const Task& task)
 	std::cout << "[DatabaseThread] 게임 서버 생성 요청 처리: " << createReq->server_name()->c_str() << std::endl;
 
 	// 서버명 중복 체크와 생성을 한 번에 처리
-	std::stringstream query;
-	query << "INSERT INTO game_servers (server_name, server_password, server_ip, server_port, "
-		<< "owner_user_id, owner_nickname, owner_socket, max_players) "
-		<< "SELECT '" << createReq->server_name()->c_str() << "', '"
-		<< createReq->server_password()->c_str() << "', '"
-		<< createReq->server_ip()->c_str() << "', "
-		<< createReq->server_port() << ", "
-		<< createReq->user_id() << ", "
-		<< "(SELECT nickname FROM users WHERE user_id = " << createReq->user_id() << "), "
-		<< task.client_socket << ", "
-		<< createReq->max_players() << " "
-		<< "WHERE NOT EXISTS (SELECT 1 FROM game_servers WHERE server_name = '"
-		<< createReq->server_name()->c_str() << "' AND is_active = 1)";
-
-	if (_sql_connector->ExecuteQuery(query.str()) && _sql_connector->GetAffectedRows() > 0) {
-		// 생성된 server_id 가져오기
-		std::string getIdQuery = "SELECT LAST_INSERT_ID()";
-		if (_sql_connector->ExecuteQuery(getIdQuery)) {
-			MYSQL_RES* result = _sql_connector->GetResult();
-			if (result) {
-				MYSQL_ROW row = mysql_fetch_row(result);
-				if (row) {
-					uint32_t new_server_id = std::stoul(row[0]);
-					_sql_connector->FreeResult(result);
-
-					auto responsePacket = _packet_manager->CreateGameServerResponse(
-						ResultCode_SUCCESS, new_server_id, "게임 서버 생성 성공", task.client_socket);
-					SendResponse(task, responsePacket);
-
-					std::cout << "[DatabaseThread] 게임 서버 생성 성공: " << createReq->server_name()->c_str()
-						<< " (ID: " << new_server_id << ")" << std::endl;
-					return;
-				}
-				_sql_connector->FreeResult(result);
-			}
-		}
+	PreparedStatement* stmt = _sql_connector->GetStatement(SQL_GAME_SERVER_CREATE);
+	if (stmt) {
+		stmt->BindString(0, createReq->server_name()->c_str(), createReq->server_name()->size());
+		stmt->BindString(1, createReq->server_password()->c_str(), createReq->server_password()->size());
+		stmt->BindString(2, createReq->server_ip()->c_str(), createReq->server_ip()->size());
+		stmt->BindUInt(3, createReq->server_port());
+		stmt->BindUInt(4, createReq->user_id());
+		stmt->BindUInt(5, createReq->user_id());
+		stmt->BindUInt(6, task.client_handle);
+		stmt->BindUInt(7, createReq->max_players());
+		stmt->BindString(8, createReq->server_name()->c_str(), createReq->server_name()->size());
+	}
+
+	if (stmt && _sql_connector->Execute(stmt) && stmt->GetAffectedRows() > 0) {
+		uint32_t new_server_id = static_cast<uint32_t>(stmt->GetInsertId());
+
+		auto responsePacket = _packet_manager->CreateGameServerResponse(
+			ResultCode_SUCCESS, new_server_id, "게임 서버 생성 성공", task.client_handle);
+		SendResponse(task, std::move(responsePacket));
+
+		std::cout << "[DatabaseThread] 게임 서버 생성 성공: " << createReq->server_name()->c_str()
+			<< " (ID: " << new_server_id << ")" << std::endl;
+		return;
 	}
 
 	auto responsePacket = _packet_manager->CreateGameServerErrorResponse(
-		ResultCode_SERVER_NAME_DUPLICATE, "이미 존재하는 서버명이거나 서버 생성에 실패했습니다", task.client_socket);
-	SendResponse(task, responsePacket);
+		ResultCode_SERVER_NAME_DUPLICATE, "이미 존재하는 서버명이거나 서버 생성에 실패했습니다", task.client_handle);
+	SendResponse(task, std::move(responsePacket));
 }
 
 void DatabaseThread::HandleGameServerListRequest(const Task& task)
@@ -966,26 +1147,15 @@ void DatabaseThread::HandleGameServerListRequest(const Task& task)
 		return;
 	}
 
-	std::cout << "[DatabaseThread] 게임 서버 목록 요청 처리: 클라이언트 소켓 " << task.client_socket << std::endl;
+	std::cout << "[DatabaseThread] 게임 서버 목록 요청 처리: 클라이언트 소켓 " << task.client_handle << std::endl;
 
 	// 활성화된 모든 서버 + 요청한 클라이언트의 비활성화된 서버를 한 번에 조회
-	std::stringstream query;
-	query << "SELECT server_id, server_name, server_ip, server_port, owner_user_id, owner_nickname, "
-		<< "current_players, max_players, "
-		<< "CASE WHEN server_password = '' THEN 0 ELSE 1 END as has_password "
-		<< "FROM game_servers "
-		<< "WHERE is_active = 1 "  // 모든 활성 서버
-		<< "OR owner_user_id = ("  // 또는 요청한 클라이언트의 서버 (활성+비활성)
-		<< "    SELECT user_id FROM user_sessions "
-		<< "    WHERE client_socket = " << task.client_socket << " AND is_online = TRUE"
-		<< ") "
-		<< "ORDER BY is_active DESC, created_at DESC";
-
-	if (_sql_connector->ExecuteQuery(query.str())) {
-		MYSQL_RES* result = _sql_connector->GetResult();
-		if (result) {
-			auto responsePacket = _packet_manager->CreateGameServerListResponseFromDB(result, task.client_socket);
-			SendResponse(task, responsePacket);
+	PreparedStatement* stmt = _sql_connector->GetStatement(SQL_GAME_SERVER_LIST);
+	if (stmt) {
+		stmt->BindUInt(0, task.client_handle);
+		if (_sql_connector->ExecuteStreaming(stmt)) {
+			_packet_manager->CreateGameServerListResponseFromDB(stmt,
+				[this, &task](PacketBuffer&& chunk) { SendResponse(task, std::move(chunk)); }, task.client_handle);
 			std::cout << "[DatabaseThread] 통합 게임 서버 목록 전송 완료" << std::endl;
 			return;
 		}
@@ -1008,45 +1178,39 @@ void DatabaseThread::HandleJoinGameServerRequest(const Task& task)
 		<< ", 사용자 ID: " << joinReq->user_id() << std::endl;
 
 	// 1. 서버 정보 조회 (활성/비활성 상관없이)
-	std::stringstream query;
-	query << "SELECT server_name, server_password, server_ip, server_port, current_players, max_players, "
-		<< "owner_user_id, owner_socket, created_at, is_active "
-		<< "FROM game_servers "
-		<< "WHERE server_id = " << joinReq->server_id();
-
-	if (!_sql_connector->ExecuteQuery(query.str())) {
+	PreparedStatement* stmt = _sql_connector->GetStatement(SQL_GAME_SERVER_SELECT);
+	if (!stmt) {
 		SendErrorResponse(task, EventType_S2C_JoinGameServer, ResultCode_FAIL);
 		return;
 	}
 
-	MYSQL_RES* result = _sql_connector->GetResult();
-	if (!result) {
+	stmt->BindUInt(0, joinReq->server_id());
+	if (!_sql_connector->Execute(stmt)) {
 		SendErrorResponse(task, EventType_S2C_JoinGameServer, ResultCode_FAIL);
 		return;
 	}
 
-	MYSQL_ROW row = mysql_fetch_row(result);
-	if (!row) {
-		_sql_connector->FreeResult(result);
+	if (!stmt->Fetch()) {
+		stmt->FreeResult();
 		auto responsePacket = _packet_manager->CreateJoinGameServerErrorResponse(
-			ResultCode_SERVER_NOT_FOUND, "존재하지 않는 게임 서버입니다", task.client_socket);
-		SendResponse(task, responsePacket);
+			ResultCode_SERVER_NOT_FOUND, "존재하지 않는 게임 서버입니다", task.client_handle);
+		SendResponse(task, std::move(responsePacket));
 		return;
 	}
 
 	// 2. 테이블 구조에 맞게 데이터 추출
-	std::string server_name = _packet_manager->GetStringFromRow(row, 0);        // server_name
-	std::string server_password = _packet_manager->GetStringFromRow(row, 1);    // server_password
-	std::string server_ip = _packet_manager->GetStringFromRow(row, 2);          // server_ip
-	uint32_t server_port = _packet_manager->GetUintFromRow(row, 3);             // server_port
-	uint32_t current_players = _packet_manager->GetUintFromRow(row, 4);         // current_players
-	uint32_t max_players = _packet_manager->GetUintFromRow(row, 5);             // max_players
-	uint32_t owner_user_id = _packet_manager->GetUintFromRow(row, 6);           // owner_user_id
-	// row[7] = owner_socket (필요시 사용)
-	// row[8] = created_at (필요시 사용)
-	bool is_active = (_packet_manager->GetUintFromRow(row, 9) == 1);            // is_active
-
-	_sql_connector->FreeResult(result);
+	std::string server_name(stmt->GetString(0));         // server_name
+	std::string server_password(stmt->GetString(1));     // server_password
+	std::string server_ip(stmt->GetString(2));           // server_ip
+	uint32_t server_port = stmt->GetUInt(3);              // server_port
+	uint32_t current_players = stmt->GetUInt(4);          // current_players
+	uint32_t max_players = stmt->GetUInt(5);              // max_players
+	uint32_t owner_user_id = stmt->GetUInt(6);            // owner_user_id
+	// 7: owner_socket (필요시 사용)
+	// 8: created_at (필요시 사용)
+	bool is_active = (stmt->GetUInt(9) == 1);             // is_active
+
+	stmt->FreeResult();
 
 	// 3. 서버 소유자인지 확인
 	bool is_owner = (joinReq->user_id() == owner_user_id);
@@ -1054,18 +1218,20 @@ void DatabaseThread::HandleJoinGameServerRequest(const Task& task)
 	// 4. 서버가 비활성화되어 있고 소유자가 아닌 경우 접속 거부
 	if (!is_active && !is_owner) {
 		auto responsePacket = _packet_manager->CreateJoinGameServerErrorResponse(
-			ResultCode_SERVER_NOT_FOUND, "서버가 비활성화되어 있습니다", task.client_socket);
-		SendResponse(task, responsePacket);
+			ResultCode_SERVER_NOT_FOUND, "서버가 비활성화되어 있습니다", task.client_handle);
+		SendResponse(task, std::move(responsePacket));
 		return;
 	}
 
 	// 5. 서버가 비활성화되어 있고 소유자인 경우 → 서버 재활성화
 	if (!is_active && is_owner) {
-		std::stringstream reactivateQuery;
-		reactivateQuery << "UPDATE game_servers SET is_active = TRUE, owner_socket = "
-			<< task.client_socket << " WHERE server_id = " << joinReq->server_id();
+		PreparedStatement* reactivateStmt = _sql_connector->GetStatement(SQL_GAME_SERVER_REACTIVATE);
+		if (reactivateStmt) {
+			reactivateStmt->BindUInt(0, task.client_handle);
+			reactivateStmt->BindUInt(1, joinReq->server_id());
+		}
 
-		if (_sql_connector->ExecuteQuery(reactivateQuery.str())) {
+		if (reactivateStmt && _sql_connector->Execute(reactivateStmt)) {
 			std::cout << "[DatabaseThread] 서버 재활성화 성공: " << server_name
 				<< " (소유자: " << joinReq->user_id() << ")" << std::endl;
 		}
@@ -1079,16 +1245,16 @@ void DatabaseThread::HandleJoinGameServerRequest(const Task& task)
 	// 6. 일반 사용자의 경우 서버 정원 확인 (소유자는 정원 제한 없음)
 	if (!is_owner && current_players >= max_players) {
 		auto responsePacket = _packet_manager->CreateJoinGameServerErrorResponse(
-			ResultCode_SERVER_FULL, "서버가 가득 찼습니다", task.client_socket);
-		SendResponse(task, responsePacket);
+			ResultCode_SERVER_FULL, "서버가 가득 찼습니다", task.client_handle);
+		SendResponse(task, std::move(responsePacket));
 		return;
 	}
 
 	// 7. 패스워드 확인 (소유자는 패스워드 체크 생략)
 	if (!is_owner && !server_password.empty() && server_password != joinReq->server_password()->str()) {
 		auto responsePacket = _packet_manager->CreateJoinGameServerErrorResponse(
-			ResultCode_SERVER_PASSWORD_WRONG, "서버 패스워드가 틀렸습니다", task.client_socket);
-		SendResponse(task, responsePacket);
+			ResultCode_SERVER_PASSWORD_WRONG, "서버 패스워드가 틀렸습니다", task.client_handle);
+		SendResponse(task, std::move(responsePacket));
 		return;
 	}
 
@@ -1097,8 +1263,8 @@ void DatabaseThread::HandleJoinGameServerRequest(const Task& task)
 		"서버가 재활성화되어 접속되었습니다" : "서버 접속 정보";
 
 	auto responsePacket = _packet_manager->CreateJoinGameServerResponse(
-		ResultCode_SUCCESS, server_ip, server_port, success_message, task.client_socket);
-	SendResponse(task, responsePacket);
+		ResultCode_SUCCESS, server_ip, server_port, success_message, task.client_handle);
+	SendResponse(task, std::move(responsePacket));
 
 	std::cout << "[DatabaseThread] 게임 서버 접속 승인: " << server_name
 		<< " (" << server_ip << ":" << server_port << ")"
@@ -1120,24 +1286,24 @@ void DatabaseThread::HandleCloseGameServerRequest(const Task& task)
 		<< ", 서버 ID " << closeReq->server_id() << std::endl;
 
 	// 서버 소유자 확인 및 서버 비활성화
-	std::stringstream query;
-	query << "UPDATE game_servers SET is_active = 0 "
-		<< "WHERE server_id = " << closeReq->server_id()
-		<< " AND owner_user_id = " << closeReq->user_id()
-		<< " AND is_active = 1";
+	PreparedStatement* stmt = _sql_connector->GetStatement(SQL_GAME_SERVER_CLOSE);
+	if (stmt) {
+		stmt->BindUInt(0, closeReq->server_id());
+		stmt->BindUInt(1, closeReq->user_id());
+	}
 
-	if (_sql_connector->ExecuteQuery(query.str()) && _sql_connector->GetAffectedRows() > 0) {
+	if (stmt && _sql_connector->Execute(stmt) && stmt->GetAffectedRows() > 0) {
 		auto responsePacket = _packet_manager->CreateCloseGameServerResponse(
-			ResultCode_SUCCESS, "게임 서버가 종료되었습니다", task.client_socket);
-		SendResponse(task, responsePacket);
+			ResultCode_SUCCESS, "게임 서버가 종료되었습니다", task.client_handle);
+		SendResponse(task, std::move(responsePacket));
 
 		std::cout << "[DatabaseThread] 게임 서버 종료 완료: 서버 ID " << closeReq->server_id() << std::endl;
 	}
 	else {
 		// 서버를 찾을 수 없거나 소유자가 아님
 		auto responsePacket = _packet_manager->CreateCloseGameServerErrorResponse(
-			ResultCode_NOT_SERVER_OWNER, "서버 소유자가 아니거나 존재하지 않는 서버입니다", task.client_socket);
-		SendResponse(task, responsePacket);
+			ResultCode_NOT_SERVER_OWNER, "서버 소유자가 아니거나 존재하지 않는 서버입니다", task.client_handle);
+		SendResponse(task, std::move(responsePacket));
 	}
 }
 
@@ -1154,35 +1320,35 @@ void DatabaseThread::HandleSavePlayerDataRequest(const Task& task)
 	std::cout << "[DatabaseThread] 플레이어 데이터 저장 요청 처리: 사용자 ID " << saveReq->user_id() << std::endl;
 
 	// 플레이어 데이터 업데이트
-	std::stringstream query;
-	query << "UPDATE player_data SET "
-		<< "level = " << saveReq->level() << ", "
-		<< "exp = " << saveReq->exp() << ", "
-		<< "hp = " << saveReq->hp() << ", "
-		<< "mp = " << saveReq->mp() << ", "
-		<< "gold = " << saveReq->gold() << ", "
-		<< "pos_x = " << saveReq->pos_x() << ", "
-		<< "pos_y = " << saveReq->pos_y() << ", "
-		<< "updated_at = NOW() "
-		<< "WHERE user_id = " << saveReq->user_id();
-
-	if (_sql_connector->ExecuteQuery(query.str()) && _sql_connector->GetAffectedRows() > 0) {
+	PreparedStatement* stmt = _sql_connector->GetStatement(SQL_PLAYER_SAVE);
+	if (stmt) {
+		stmt->BindUInt(0, saveReq->level());
+		stmt->BindUInt(1, saveReq->exp());
+		stmt->BindUInt(2, saveReq->hp());
+		stmt->BindUInt(3, saveReq->mp());
+		stmt->BindUInt(4, saveReq->gold());
+		stmt->BindFloat(5, saveReq->pos_x());
+		stmt->BindFloat(6, saveReq->pos_y());
+		stmt->BindUInt(7, saveReq->user_id());
+	}
+
+	if (stmt && _sql_connector->Execute(stmt) && stmt->GetAffectedRows() > 0) {
 		auto responsePacket = _packet_manager->CreateSavePlayerDataResponse(
-			ResultCode_SUCCESS, "플레이어 데이터 저장 완료", task.client_socket);
-		SendResponse(task, responsePacket);
+			ResultCode_SUCCESS, "플레이어 데이터 저장 완료", task.client_handle);
+		SendResponse(task, std::move(responsePacket));
 
 		std::cout << "[DatabaseThread] 플레이어 데이터 저장 완료: 사용자 ID " << saveReq->user_id() << std::endl;
 	}
 	else {
 		auto responsePacket = _packet_manager->CreateSavePlayerDataErrorResponse(
-			ResultCode_USER_NOT_FOUND, "플레이어 데이터를 찾을 수 없습니다", task.client_socket);
-		SendResponse(task, responsePacket);
+			ResultCode_USER_NOT_FOUND, "플레이어 데이터를 찾을 수 없습니다", task.client_handle);
+		SendResponse(task, std::move(responsePacket));
 	}
 }
 
 void DatabaseThread::HandleClientDisconnected(const Task& task)
 {
-	uintptr_t client_socket = static_cast<uintptr_t>(task.client_socket);  // SOCKET을 uintptr_t로 캐스팅
+	ConnectionHandle client_socket = task.client_handle;  // DB의 client_socket/owner_socket 컬럼에는 연결 핸들을 저장
 
 	std::cout << "[DatabaseThread] 클라이언트 연결 해제 처리: 소켓 " << client_socket << std::endl;
 
@@ -1198,18 +1364,19 @@ void DatabaseThread::HandleClientDisconnected(const Task& task)
 	CleanupUserSessionBySocket(client_socket);
 }
 
-void DatabaseThread::CleanupGameServerBySocket(uintptr_t client_socket)
+void DatabaseThread::CleanupGameServerBySocket(ConnectionHandle client_socket)
 {
 	try {
 		std::cout << "[DatabaseThread] 소켓 " << client_socket << "의 게임 서버 정리 시작..." << std::endl;
 
 		// 해당 소켓으로 생성된 게임 서버들을 비활성화
-		std::stringstream query;
-		query << "UPDATE game_servers SET is_active = FALSE "
-			<< "WHERE owner_socket = " << client_socket << " AND is_active = TRUE";
+		PreparedStatement* stmt = _sql_connector->GetStatement(SQL_GAME_SERVER_CLOSE_BY_SOCKET);
+		if (stmt) {
+			stmt->BindUInt(0, client_socket);
+		}
 
-		if (_sql_connector->ExecuteQuery(query.str())) {
-			int affected_rows = _sql_connector->GetAffectedRows();
+		if (stmt && _sql_connector->Execute(stmt)) {
+			uint64_t affected_rows = stmt->GetAffectedRows();
 			if (affected_rows > 0) {
 				std::cout << "[DatabaseThread] " << affected_rows << "개의 게임 서버를 비활성화했습니다. (소켓: "
 					<< client_socket << ")" << std::endl;
@@ -1230,57 +1397,61 @@ void DatabaseThread::CleanupGameServerBySocket(uintptr_t client_socket)
 void DatabaseThread::HandleShopPurchase(const Task& task, const C2S_ShopTransaction* transReq)
 {
 	// 아이템 가격과 플레이어 골드를 한 번에 조회
-	std::stringstream query;
-	query << "SELECT i.base_price, p.gold FROM item_master i, player_data p "
-		<< "WHERE i.item_id = " << transReq->item_id()
-		<< " AND p.user_id = " << transReq->user_id();
-
-	if (!_sql_connector->ExecuteQuery(query.str())) {
+	PreparedStatement* stmt = _sql_connector->GetStatement(SQL_SHOP_PURCHASE_CHECK);
+	if (!stmt) {
 		SendErrorResponse(task, EventType_S2C_ShopTransaction, ResultCode_FAIL);
 		return;
 	}
 
-	MYSQL_RES* result = _sql_connector->GetResult();
-	if (!result) {
-		SendErrorResponse(task, EventType_S2C_ShopTransaction, ResultCode_ITEM_NOT_FOUND);
+	stmt->BindUInt(0, transReq->item_id());
+	stmt->BindUInt(1, transReq->user_id());
+	if (!_sql_connector->Execute(stmt)) {
+		SendErrorResponse(task, EventType_S2C_ShopTransaction, ResultCode_FAIL);
 		return;
 	}
 
-	MYSQL_ROW row = mysql_fetch_row(result);
-	if (!row) {
-		_sql_connector->FreeResult(result);
+	if (!stmt->Fetch()) {
+		stmt->FreeResult();
 		SendErrorResponse(task, EventType_S2C_ShopTransaction, ResultCode_ITEM_NOT_FOUND);
 		return;
 	}
 
-	uint32_t item_price = std::stoul(row[0]);
-	uint32_t current_gold = std::stoul(row[1]);
+	uint32_t item_price = stmt->GetUInt(0);
+	uint32_t current_gold = stmt->GetUInt(1);
 	uint32_t total_price = item_price * transReq->item_count();
 
-	_sql_connector->FreeResult(result);
+	stmt->FreeResult();
 
 	if (current_gold < total_price) {
 		auto responsePacket = _packet_manager->CreateShopTransactionErrorResponse(
-			ResultCode_INSUFFICIENT_GOLD, "골드가 부족합니다", task.client_socket);
-		SendResponse(task, responsePacket);
+			ResultCode_INSUFFICIENT_GOLD, "골드가 부족합니다", task.client_handle);
+		SendResponse(task, std::move(responsePacket));
 		return;
 	}
 
 	// 트랜잭션으로 골드 차감과 아이템 추가를 한 번에 처리
-	std::stringstream transactionQuery;
-	transactionQuery << "START TRANSACTION; "
-		<< "UPDATE player_data SET gold = gold - " << total_price << " WHERE user_id = " << transReq->user_id() << "; "
-		<< "INSERT INTO player_inventory (user_id, item_id, item_count, acquired_at) VALUES ("
-		<< transReq->user_id() << ", " << transReq->item_id() << ", "
-		<< transReq->item_count() << ", NOW()) "
-		<< "ON DUPLICATE KEY UPDATE item_count = item_count + " << transReq->item_count() << "; "
-		<< "COMMIT;";
-
-	if (_sql_connector->ExecuteQuery(transactionQuery.str())) {
+	PreparedStatement* goldStmt = _sql_connector->GetStatement(SQL_GOLD_SUBTRACT);
+	PreparedStatement* itemStmt = _sql_connector->GetStatement(SQL_INVENTORY_ADD);
+	bool success = false;
+	if (goldStmt && itemStmt && _sql_connector->ExecuteQuery("START TRANSACTION")) {
+		goldStmt->BindUInt(0, total_price);
+		goldStmt->BindUInt(1, transReq->user_id());
+		itemStmt->BindUInt(0, transReq->user_id());
+		itemStmt->BindUInt(1, transReq->item_id());
+		itemStmt->BindUInt(2, transReq->item_count());
+
+		success = _sql_connector->Execute(goldStmt) && _sql_connector->Execute(itemStmt)
+			&& _sql_connector->ExecuteQuery("COMMIT");
+		if (!success) {
+			_sql_connector->ExecuteQuery("ROLLBACK");
+		}
+	}
+
+	if (success) {
 		uint32_t new_gold = current_gold - total_price;
 		auto responsePacket = _packet_manager->CreateShopTransactionResponse(
-			ResultCode_SUCCESS, "구매 완료", new_gold, task.client_socket);
-		SendResponse(task, responsePacket);
+			ResultCode_SUCCESS, "구매 완료", new_gold, task.client_handle);
+		SendResponse(task, std::move(responsePacket));
 		std::cout << "[DatabaseThread] 아이템 구매 완료: 사용자 ID " << transReq->user_id() << std::endl;
 	}
 	else {
@@ -1291,109 +1462,87 @@ void DatabaseThread::HandleShopPurchase(const Task& task, const C2S_ShopTransact
 void DatabaseThread::HandleShopSell(const Task& task, const C2S_ShopTransaction* transReq)
 {
 	// 플레이어가 보유한 아이템 수량과 아이템 가격을 한 번에 조회
-	std::stringstream query;
-	query << "SELECT i.item_count, m.base_price FROM player_inventory i "
-		<< "JOIN item_master m ON i.item_id = m.item_id "
-		<< "WHERE i.user_id = " << transReq->user_id()
-		<< " AND i.item_id = " << transReq->item_id();
-
-	if (!_sql_connector->ExecuteQuery(query.str())) {
+	PreparedStatement* stmt = _sql_connector->GetStatement(SQL_SHOP_SELL_CHECK);
+	if (!stmt) {
 		SendErrorResponse(task, EventType_S2C_ShopTransaction, ResultCode_FAIL);
 		return;
 	}
 
-	MYSQL_RES* result = _sql_connector->GetResult();
-	if (!result) {
-		auto responsePacket = _packet_manager->CreateShopTransactionErrorResponse(
-			ResultCode_ITEM_NOT_FOUND, "아이템을 보유하고 있지 않습니다", task.client_socket);
-		SendResponse(task, responsePacket);
+	stmt->BindUInt(0, transReq->user_id());
+	stmt->BindUInt(1, transReq->item_id());
+	if (!_sql_connector->Execute(stmt)) {
+		SendErrorResponse(task, EventType_S2C_ShopTransaction, ResultCode_FAIL);
 		return;
 	}
 
-	MYSQL_ROW row = mysql_fetch_row(result);
-	if (!row) {
-		_sql_connector->FreeResult(result);
+	if (!stmt->Fetch()) {
+		stmt->FreeResult();
 		auto responsePacket = _packet_manager->CreateShopTransactionErrorResponse(
-			ResultCode_ITEM_NOT_FOUND, "아이템을 보유하고 있지 않습니다", task.client_socket);
-		SendResponse(task, responsePacket);
+			ResultCode_ITEM_NOT_FOUND, "아이템을 보유하고 있지 않습니다", task.client_handle);
+		SendResponse(task, std::move(responsePacket));
 		return;
 	}
 
-	uint32_t owned_count = std::stoul(row[0]);
-	uint32_t item_price = std::stoul(row[1]);
+	uint32_t owned_count = stmt->GetUInt(0);
+	uint32_t item_price = stmt->GetUInt(1);
 	uint32_t sell_price = (item_price / 2) * transReq->item_count();
-	_sql_connector->FreeResult(result);
+	stmt->FreeResult();
 
 	if (owned_count < transReq->item_count()) {
 		auto responsePacket = _packet_manager->CreateShopTransactionErrorResponse(
-			ResultCode_ITEM_NOT_FOUND, "보유 아이템이 부족합니다", task.client_socket);
-		SendResponse(task, responsePacket);
+			ResultCode_ITEM_NOT_FOUND, "보유 아이템이 부족합니다", task.client_handle);
+		SendResponse(task, std::move(responsePacket));
 		return;
 	}
 
-	// 트랜잭션을 개별 쿼리로 분리하여 실행
-	bool success = true;
+	PreparedStatement* subtractStmt = _sql_connector->GetStatement(SQL_INVENTORY_SUBTRACT);
+	PreparedStatement* deleteStmt = _sql_connector->GetStatement(SQL_INVENTORY_DELETE_EMPTY);
+	PreparedStatement* goldAddStmt = _sql_connector->GetStatement(SQL_GOLD_ADD);
+	PreparedStatement* goldStmt = _sql_connector->GetStatement(SQL_GOLD_SELECT);
+	if (!subtractStmt || !deleteStmt || !goldAddStmt || !goldStmt) {
+		SendErrorResponse(task, EventType_S2C_ShopTransaction, ResultCode_FAIL);
+		return;
+	}
 
 	// 트랜잭션 시작
 	if (!_sql_connector->ExecuteQuery("START TRANSACTION")) {
 		SendErrorResponse(task, EventType_S2C_ShopTransaction, ResultCode_FAIL);
 		return;
 	}
-	// 아이템 수량 감소
-	// 수량 감소 (이미 위에서 owned_count >= transReq->item_count() 검증했으므로 안전)
-	std::stringstream updateQuery;
-	updateQuery << "UPDATE player_inventory SET item_count = item_count - " << transReq->item_count()
-		<< " WHERE user_id = " << transReq->user_id()
-		<< " AND item_id = " << transReq->item_id();
 
-	if (!_sql_connector->ExecuteQuery(updateQuery.str())) {
-		success = false;
-	}
+	// 수량 감소 (이미 위에서 owned_count >= transReq->item_count() 검증했으므로 안전)
+	subtractStmt->BindUInt(0, transReq->item_count());
+	subtractStmt->BindUInt(1, transReq->user_id());
+	subtractStmt->BindUInt(2, transReq->item_id());
+	bool success = _sql_connector->Execute(subtractStmt);
 
 	// 0개가 된 아이템 삭제
 	if (success) {
-		std::stringstream deleteQuery;
-		deleteQuery << "DELETE FROM player_inventory WHERE user_id = " << transReq->user_id()
-			<< " AND item_id = " << transReq->item_id() << " AND item_count = 0";
-
-		if (!_sql_connector->ExecuteQuery(deleteQuery.str())) {
-			success = false;
-		}
+		deleteStmt->BindUInt(0, transReq->user_id());
+		deleteStmt->BindUInt(1, transReq->item_id());
+		success = _sql_connector->Execute(deleteStmt);
 	}
 
 	// 골드 추가
 	if (success) {
-		std::stringstream goldUpdateQuery;
-		goldUpdateQuery << "UPDATE player_data SET gold = gold + " << sell_price
-			<< " WHERE user_id = " << transReq->user_id();
-
-		if (!_sql_connector->ExecuteQuery(goldUpdateQuery.str())) {
-			success = false;
-		}
-	}
-
-	if (success) {
-		// 트랜잭션 커밋
-		if (_sql_connector->ExecuteQuery("COMMIT")) {
-			// 현재 골드 조회
-			std::string goldQuery = "SELECT gold FROM player_data WHERE user_id = " + std::to_string(transReq->user_id());
-			if (_sql_connector->ExecuteQuery(goldQuery)) {
-				MYSQL_RES* goldResult = _sql_connector->GetResult();
-				if (goldResult) {
-					MYSQL_ROW goldRow = mysql_fetch_row(goldResult);
-					if (goldRow) {
-						uint32_t current_gold = std::stoul(goldRow[0]);
-						_sql_connector->FreeResult(goldResult);
-						auto responsePacket = _packet_manager->CreateShopTransactionResponse(
-							ResultCode_SUCCESS, "판매 완료", current_gold, task.client_socket);
-						SendResponse(task, responsePacket);
-						std::cout << "[DatabaseThread] 아이템 판매 완료: 사용자 ID " << transReq->user_id() << std::endl;
-						return;
-					}
-					_sql_connector->FreeResult(goldResult);
-				}
-			}
+		goldAddStmt->BindUInt(0, sell_price);
+		goldAddStmt->BindUInt(1, transReq->user_id());
+		success = _sql_connector->Execute(goldAddStmt);
+	}
+
+	// 트랜잭션 커밋 후 현재 골드 조회
+	if (success && _sql_connector->ExecuteQuery("COMMIT")) {
+		goldStmt->BindUInt(0, transReq->user_id());
+		if (_sql_connector->Execute(goldStmt) && goldStmt->Fetch()) {
+			uint32_t current_gold = goldStmt->GetUInt(0);
+			goldStmt->FreeResult();
+			auto responsePacket = _packet_manager->CreateShopTransactionResponse(
+				ResultCode_SUCCESS, "판매 완료", current_gold, task.client_handle);
+			SendResponse(task, std::move(responsePacket));
+			std::cout << "[DatabaseThread] 아이템 판매 완료: 사용자 ID " << transReq->user_id() << std::endl;
+			return;
 		}
+		goldStmt->FreeResult();
 	}
 
 	// 실패 시 롤백
@@ -1401,7 +1550,7 @@ void DatabaseThread::HandleShopSell(const Task& task, const C2S_ShopTransaction*
 	SendErrorResponse(task, EventType_S2C_ShopTransaction, ResultCode_FAIL);
 }
 
-void DatabaseThread::SendResponse(const Task& task, const std::vector<uint8_t>& responsePacket)
+void DatabaseThread::SendResponse(const Task& task, PacketBuffer&& responsePacket)
 {
 	if (responsePacket.empty()) {
 		std::cerr << "[DatabaseThread] 빈 응답 패킷" << std::endl;
@@ -1409,31 +1558,32 @@ void DatabaseThread::SendResponse(const Task& task, const std::vector<uint8_t>&
 	}
 
 	DBResponse response;
-	response.client_socket = task.client_socket;
+	response.client_handle = task.client_handle;
 	response.worker_thread_id = task.worker_thread_id;
 	response.task_id = task.id;
 	response.success = true;
-	response.response_data = responsePacket;
+	response.response_data = std::move(responsePacket);
+	size_t packetSize = response.response_data.size();
 
-	SendQueue->enqueue(response);
-	std::cout << "[DatabaseThread] 응답 전송 완료 - 클라이언트: " << task.client_socket
-		<< ", 패킷 크기: " << responsePacket.size() << " bytes" << std::endl;
+	_dispatch_response(std::move(response));
+	std::cout << "[DatabaseThread] 응답 전송 완료 - 클라이언트: " << task.client_handle
+		<< ", 패킷 크기: " << packetSize << " bytes" << std::endl;
 }
 
 void DatabaseThread::SendErrorResponse(const Task& task, EventType responseType, ResultCode errorCode)
 {
-	auto errorPacket = _packet_manager->CreateGenericErrorResponse(responseType, errorCode, task.client_socket);
+	auto errorPacket = _packet_manager->CreateGenericErrorResponse(responseType, errorCode, task.client_handle);
 
 	DBResponse response;
-	response.client_socket = task.client_socket;
+	response.client_handle = task.client_handle;
 	response.worker_thread_id = task.worker_thread_id;
 	response.task_id = task.id;
 	response.success = false;
 	response.error_message = _packet_manager->GetResultCodeName(errorCode);
-	response.response_data = errorPacket;
+	response.response_data = std::move(errorPacket);
 
-	SendQueue->enqueue(response);
-	std::cout << "[DatabaseThread] 에러 응답 전송 - 클라이언트: " << task.client_socket
+	_dispatch_response(std::move(response));
+	std::cout << "[DatabaseThread] 에러 응답 전송 - 클라이언트: " << task.client_handle
 		<< ", 에러 코드: " << _packet_manager->GetResultCodeName(errorCode) << std::endl;
 }
 
@@ -1451,20 +1601,22 @@ void DatabaseThread::ShowSessionDebugInfo()
 		)";
 
 		if (_sql_connector->ExecuteQuery(query)) {
-			MYSQL_RES* result = _sql_connector->GetResult();
-			if (result) {
+			// 출력만 하므로 받아 두지 않고 읽는 대로 찍는다
+			std::unique_ptr<ResultRowReader> rows = _sql_connector->UseResult();
+			if (rows) {
 				std::cout << "\n[DEBUG] 최근 세션 상태 (최대 10개):" << std::endl;
 				std::cout << "UserID | Username | Online | LoginTime | LastActivity" << std::endl;
 				std::cout << "-------|----------|--------|-----------|-------------" << std::endl;
 
-				MYSQL_ROW row;
-				while ((row = mysql_fetch_row(result))) {
-					std::cout << row[0] << " | " << row[1] << " | "
-						<< (std::string(row[2]) == "1" ? "Y" : "N") << " | "
-						<< (row[3] ? row[3] : "NULL") << " | "
-						<< (row[4] ? row[4] : "NULL") << std::endl;
+				while (rows->Fetch()) {
+					std::cout << rows->GetUInt(0) << " | " << rows->GetString(1) << " | "
+						<< (rows->GetUInt(2) == 1 ? "Y" : "N") << " | "
+						<< (rows->IsNull(3) ? "NULL" : rows->GetString(3)) << " | "
+						<< (rows->IsNull(4) ? "NULL" : rows->GetString(4)) << std::endl;
+				}
+				if (rows->HasFetchError()) {
+					std::cerr << "[DatabaseThread] 세션 상태 읽기 중단" << std::endl;
 				}
-				_sql_connector->FreeResult(result);
 			}
 		}
 	}
@@ -1474,21 +1626,19 @@ void DatabaseThread::ShowSessionDebugInfo()
 }
 
 
-void DatabaseThread::CleanupUserSessionBySocket(uintptr_t client_socket)
+void DatabaseThread::CleanupUserSessionBySocket(ConnectionHandle client_socket)
 {
 	try {
 		std::cout << "[DatabaseThread] 소켓 " << client_socket << "의 사용자 세션 정리 시작..." << std::endl;
 
 		// 해당 소켓의 사용자를 오프라인으로 설정
-		std::stringstream query;
-		query << "UPDATE user_sessions SET "
-			<< "is_online = FALSE, "
-			<< "client_socket = 0, "
-			<< "last_activity = NOW() "
-			<< "WHERE client_socket = " << client_socket << " AND is_online = TRUE";
-
-		if (_sql_connector->ExecuteQuery(query.str())) {
-			int affected_rows = _sql_connector->GetAffectedRows();
+		PreparedStatement* stmt = _sql_connector->GetStatement(SQL_SESSION_CLEANUP_BY_SOCKET);
+		if (stmt) {
+			stmt->BindUInt(0, client_socket);
+		}
+
+		if (stmt && _sql_connector->Execute(stmt)) {
+			uint64_t affected_rows = stmt->GetAffectedRows();
 			if (affected_rows > 0) {
 				std::cout << "[DatabaseThread] " << affected_rows << "명의 사용자를 오프라인으로 설정했습니다. (소켓: "
 					<< client_socket << ")" << std::endl;
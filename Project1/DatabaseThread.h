@@ -8,12 +8,12 @@
 #include <string>
 #include <chrono>
 #include <iostream>
-#include <cstdint>  // uintptr_t를 위해 추가
+#include <functional>
+#include <cstdint>
+#include "Packet.h"  // ConnectionHandle
+#include "TaskQueue.h"
 
 // 전방 선언으로 헤더 중복 방지
-template<typename T>
-class LockFreeQueue;
-
 struct Task;
 struct DBResponse;
 class MySqlConnector;
@@ -27,15 +27,34 @@ struct C2S_ShopTransaction;
 enum EventType : uint8_t;
 enum ResultCode : int8_t;
 
+#define DB_TASK_BATCH_SIZE 64  // 한 번 깨어날 때 요청 큐에서 꺼내는 최대 태스크 수
+#define DB_HEALTH_CHECK_INTERVAL_SEC 30      // 이 시간 동안 DB를 쓰지 않았으면 ping으로 연결 확인
+#define DB_RECONNECT_BACKOFF_MIN_MS 500      // 재연결 실패 후 첫 대기 시간
+#define DB_RECONNECT_BACKOFF_MAX_MS 30000    // 재연결 대기 시간 상한 (실패할 때마다 두 배)
+
+// 처리 결과를 연결을 소유한 WorkerThread로 바로 넘기는 함수 (DB 스레드에서 호출됨)
+typedef std::function<void(DBResponse&&)> ResponseDispatcher;
+// 연결에서 온 요청 하나의 처리 완료 정보
+struct TaskCompletion {
+    ConnectionHandle client_handle;
+    uint32_t task_id;  // 연결별 요청 번호 (Task.id)
+    std::chrono::steady_clock::time_point admitted_at;  // 요청 큐에 들어간 시각
+};
+// 요청 하나의 처리가 끝났음을 알리는 함수 (응답 여부와 관계없이 요청마다 한 번, DB 스레드에서 호출됨)
+typedef std::function<void(const TaskCompletion&)> TaskCompletionHandler;
+
+// DB 실행기 스레드 하나 (자신의 요청 큐와 MYSQL 연결을 가짐, DatabasePool이 여러 개를 운영)
 class DatabaseThread
 {
 private:
     std::atomic<bool> _is_running;
     std::thread _db_thread;
+    int _index;  // 풀 안에서의 번호 (로그용)
 
     // 큐 포인터들
-    LockFreeQueue<Task>* RecvQueue;
-    LockFreeQueue<DBResponse>* SendQueue;
+    TaskQueue* RecvQueue;
+    ResponseDispatcher _dispatch_response;
+    TaskCompletionHandler _complete_task;
 
     // 주요 컴포넌트들
     std::unique_ptr<MySqlConnector> _sql_connector;
@@ -48,11 +67,30 @@ private:
     std::string _password;
     std::string _database;
 
+    // 재연결 백오프와 헬스 체크 (DB 스레드 전용, 시작 전에는 ConnectDB를 호출한 스레드)
+    std::chrono::steady_clock::time_point _next_reconnect_at;
+    std::chrono::steady_clock::time_point _last_db_activity;
+    uint32_t _reconnect_backoff_ms;
+    std::atomic<bool> _db_connected;      // 다른 스레드에서 읽는 연결 상태 (통계용)
+    std::atomic<uint64_t> _reconnects;    // 재연결에 성공한 횟수
+
+    // 요청 큐에서 한 번에 꺼낸 태스크와 태스크별 EventType, 완료 알림 정보 (DB 스레드 전용)
+    std::vector<Task> _batch;
+    std::vector<EventType> _batch_types;
+    std::vector<TaskCompletion> _batch_completions;
+
+    // 태스크 하나를 처리하는 핸들러
+    typedef void (DatabaseThread::*TaskHandler)(const Task& task);
+
     // 스레드 실행 함수
     void Run();
 
     // 태스크 처리 함수들
-    void ProcessTask(const Task& task);
+    // 꺼낸 태스크를 검증/분류한 뒤 같은 종류가 연속된 구간 단위로 핸들러에 넘김 (순서 유지)
+    void ProcessBatch(size_t count);
+    bool ClassifyTask(const Task& task, EventType& packetType);
+    void ProcessTaskRun(EventType packetType, const Task* tasks, size_t count);
+    TaskHandler GetTaskHandler(EventType packetType) const;
     void HandleLoginRequest(const Task& task);
     void HandleLogoutRequest(const Task& task);
     void HandleCreateAccountRequest(const Task& task);
@@ -80,43 +118,54 @@ private:
     void HandleShopPurchase(const Task& task, const C2S_ShopTransaction* transReq);
     void HandleShopSell(const Task& task, const C2S_ShopTransaction* transReq);
 
-    // 내부에서만 사용하는 소켓별 정리 함수들 (uintptr_t로 변경)
-    void CleanupGameServerBySocket(uintptr_t client_socket);
-    void CleanupUserSessionBySocket(uintptr_t client_socket);
+    // 내부에서만 사용하는 연결별 정리 함수들 (client_socket/owner_socket 컬럼에는 연결 핸들이 저장됨)
+    void CleanupGameServerBySocket(ConnectionHandle client_socket);
+    void CleanupUserSessionBySocket(ConnectionHandle client_socket);
 
     // 응답 전송 헬퍼 함수들
-    void SendResponse(const Task& task, const std::vector<uint8_t>& responsePacket);
+    // 응답 버퍼 핸들을 그대로 소유 워커로 넘긴다 (바이트 복사 없음)
+    void SendResponse(const Task& task, PacketBuffer&& responsePacket);
     void SendErrorResponse(const Task& task, EventType responseType, ResultCode errorCode);
 
     // DB 연결 상태 체크
     bool CheckDBConnection();
+    // 끊겨 있으면 새 연결을 만듦 (백오프 대기 중이면 시도하지 않고 바로 false - 스레드를 재우지 않는다)
     bool ReconnectIfNeeded();
+    bool OpenConnection();
+    // 한동안 DB를 쓰지 않았으면 ping으로 확인하고, 끊겨 있으면 재연결 시도
+    void CheckHealth();
 
     // 간소화된 세션 관리 함수들
-    bool InitializeUserSessions();              // 서버 시작 시 세션 초기화
-    bool SetUserOnlineStatus(uint32_t user_id, bool is_online, uintptr_t client_socket = 0);  // 온라인 상태 설정
+    bool SetUserOnlineStatus(uint32_t user_id, bool is_online, ConnectionHandle client_socket = INVALID_CONNECTION_HANDLE);  // 온라인 상태 설정
 
     bool ForceLogoutExistingSession(uint32_t user_id);
 
 public:
-    DatabaseThread(LockFreeQueue<Task>* RecvQueue, LockFreeQueue<DBResponse>* SendQueue);
+    DatabaseThread(TaskQueue* RecvQueue, ResponseDispatcher dispatchResponse, TaskCompletionHandler completeTask, int index = 0);
     ~DatabaseThread();
 
     // DB 설정 함수들
     void SetConnectionInfo(const std::string& host, const std::string& user,
         const std::string& password, const std::string& database, int port = 3306);
 
+    // DB에 연결만 함 (실패해도 Start 후 백오프를 두고 다시 시도한다)
     bool ConnectDB();
+    // 실행기 스레드 시작
+    void Start();
+    // 종료 신호만 보냄 (Join으로 스레드 종료 대기)
     void Stop();
+    void Join();
 
     // 상태 확인 함수들
     bool IsRunning() const { return _is_running.load(); }
     bool IsDBConnected() const;
+    uint64_t GetReconnects() const { return _reconnects.load(); }
 
     // 디버그 정보
     std::string GetStatus() const;
 
-    // 공개 사용자 관리 함수들
+    // 공개 사용자 관리 함수들 (실행기 스레드가 돌지 않을 때만 호출 - 연결을 스레드와 공유하지 않음)
+    bool InitializeUserSessions();              // 서버 시작 시 세션 초기화
     void DisconnectAllUsers();                  // 모든 사용자 오프라인 처리 (서버 종료 시)
     void DisconnectUser(uint32_t user_id);      // 특정 사용자 연결 해제
     void ShowSessionDebugInfo();                // 세션 디버그 정보 출력
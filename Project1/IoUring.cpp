@@ -0,0 +1,235 @@
+﻿#include "IoUring.h"
+
+#ifdef USE_IO_URING
+
+#include <iostream>
+#include <cstring>
+#include <poll.h>
+#include <sys/eventfd.h>
+
+#define IOURING_BUFFER_GROUP 0
+#define IOURING_OP_MASK 0x7ULL
+
+static uint64_t EncodeUserData(void* context, IoUringOp op)
+{
+	return reinterpret_cast<uint64_t>(context) | static_cast<uint64_t>(op);
+}
+
+IoUring::IoUring()
+	: _initialized(false), _buf_ring(nullptr), _buffer_count(0), _buffer_size(0),
+	_wakeup_fd(-1), _submit_calls(0), _completions(0)
+{
+	memset(&_ring, 0, sizeof(_ring));
+}
+
+IoUring::~IoUring()
+{
+	if (_initialized) {
+		if (_buf_ring) {
+			io_uring_free_buf_ring(&_ring, _buf_ring, _buffer_count, IOURING_BUFFER_GROUP);
+		}
+		io_uring_queue_exit(&_ring);
+	}
+	if (_wakeup_fd >= 0) {
+		close(_wakeup_fd);
+	}
+}
+
+bool IoUring::Initialize(unsigned int entries, unsigned int bufferCount, unsigned int bufferSize)
+{
+	io_uring_params params;
+	memset(&params, 0, sizeof(params));
+	// 완료 큐는 multishot 요청이 몰려도 넘치지 않도록 넉넉하게
+	params.flags = IORING_SETUP_CQSIZE;
+	params.cq_entries = entries * 4;
+
+	int result = io_uring_queue_init_params(entries, &_ring, &params);
+	if (result < 0) {
+		std::cerr << "[IoUring] io_uring_queue_init 실패: " << -result << std::endl;
+		return false;
+	}
+	_initialized = true;
+
+	// multishot recv가 사용할 제공 버퍼 링 등록 (bufferCount가 0이면 accept 전용)
+	if (bufferCount > 0) {
+		_buffer_count = bufferCount;
+		_buffer_size = bufferSize;
+		_buffers.resize(static_cast<size_t>(bufferCount) * bufferSize);
+
+		_buf_ring = io_uring_setup_buf_ring(&_ring, bufferCount, IOURING_BUFFER_GROUP, 0, &result);
+		if (_buf_ring == nullptr) {
+			std::cerr << "[IoUring] 제공 버퍼 링 등록 실패: " << -result << std::endl;
+			return false;
+		}
+
+		int mask = io_uring_buf_ring_mask(bufferCount);
+		for (unsigned int i = 0; i < bufferCount; ++i) {
+			io_uring_buf_ring_add(_buf_ring, _buffers.data() + static_cast<size_t>(i) * bufferSize,
+				bufferSize, static_cast<unsigned short>(i), mask, static_cast<int>(i));
+		}
+		io_uring_buf_ring_advance(_buf_ring, static_cast<int>(bufferCount));
+	}
+
+	_wakeup_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (_wakeup_fd < 0) {
+		std::cerr << "[IoUring] eventfd 생성 실패: " << errno << std::endl;
+		return false;
+	}
+	return ArmWakeup();
+}
+
+io_uring_sqe* IoUring::GetSqe()
+{
+	io_uring_sqe* sqe = io_uring_get_sqe(&_ring);
+	if (sqe == nullptr) {
+		// SQ가 가득 차면 먼저 제출해서 자리를 만든다
+		io_uring_submit(&_ring);
+		++_submit_calls;
+		sqe = io_uring_get_sqe(&_ring);
+	}
+	return sqe;
+}
+
+bool IoUring::ArmWakeup()
+{
+	io_uring_sqe* sqe = GetSqe();
+	if (sqe == nullptr) {
+		return false;
+	}
+	io_uring_prep_poll_multishot(sqe, _wakeup_fd, POLLIN);
+	io_uring_sqe_set_data64(sqe, EncodeUserData(nullptr, IOURING_OP_WAKEUP));
+	return true;
+}
+
+bool IoUring::ArmAccept(SOCKET listenSocket, void* context)
+{
+	io_uring_sqe* sqe = GetSqe();
+	if (sqe == nullptr) {
+		return false;
+	}
+	io_uring_prep_multishot_accept(sqe, listenSocket, nullptr, nullptr, 0);
+	io_uring_sqe_set_data64(sqe, EncodeUserData(context, IOURING_OP_ACCEPT));
+	return true;
+}
+
+bool IoUring::ArmRecv(SOCKET sock, void* context)
+{
+	io_uring_sqe* sqe = GetSqe();
+	if (sqe == nullptr) {
+		return false;
+	}
+	io_uring_prep_recv_multishot(sqe, sock, nullptr, 0, 0);
+	sqe->flags |= IOSQE_BUFFER_SELECT;
+	sqe->buf_group = IOURING_BUFFER_GROUP;
+	io_uring_sqe_set_data64(sqe, EncodeUserData(context, IOURING_OP_RECV));
+	return true;
+}
+
+bool IoUring::Send(SOCKET sock, void* context, const void* data, size_t size)
+{
+	io_uring_sqe* sqe = GetSqe();
+	if (sqe == nullptr) {
+		return false;
+	}
+	io_uring_prep_send(sqe, sock, data, size, MSG_NOSIGNAL);
+	io_uring_sqe_set_data64(sqe, EncodeUserData(context, IOURING_OP_SEND));
+	return true;
+}
+
+bool IoUring::Cancel(SOCKET sock)
+{
+	io_uring_sqe* sqe = GetSqe();
+	if (sqe == nullptr) {
+		return false;
+	}
+	io_uring_prep_cancel_fd(sqe, sock, IORING_ASYNC_CANCEL_ALL);
+	io_uring_sqe_set_data64(sqe, EncodeUserData(nullptr, IOURING_OP_CANCEL));
+	return true;
+}
+
+bool IoUring::CancelRecv(void* context)
+{
+	io_uring_sqe* sqe = GetSqe();
+	if (sqe == nullptr) {
+		return false;
+	}
+	io_uring_prep_cancel64(sqe, EncodeUserData(context, IOURING_OP_RECV), 0);
+	io_uring_sqe_set_data64(sqe, EncodeUserData(nullptr, IOURING_OP_CANCEL));
+	return true;
+}
+
+int IoUring::Wait(IoCompletion* completions, int maxCompletions, int timeoutMs)
+{
+	__kernel_timespec timeout;
+	timeout.tv_sec = timeoutMs / 1000;
+	timeout.tv_nsec = static_cast<long long>(timeoutMs % 1000) * 1000000;
+
+	// 쌓인 SQE 제출과 완료 대기를 한 번의 시스템 콜로 처리
+	io_uring_cqe* cqe = nullptr;
+	int result = io_uring_submit_and_wait_timeout(&_ring, &cqe, 1, &timeout, nullptr);
+	++_submit_calls;
+	if (result < 0 && result != -ETIME && result != -EINTR) {
+		errno = -result;
+		return -1;
+	}
+
+	io_uring_cqe* cqes[128];
+	if (maxCompletions > 128) maxCompletions = 128;
+	unsigned int ready = io_uring_peek_batch_cqe(&_ring, cqes, static_cast<unsigned int>(maxCompletions));
+
+	int filled = 0;
+	bool rearmWakeup = false;
+	for (unsigned int i = 0; i < ready; ++i) {
+		uint64_t userData = io_uring_cqe_get_data64(cqes[i]);
+		IoUringOp op = static_cast<IoUringOp>(userData & IOURING_OP_MASK);
+		uint32_t flags = cqes[i]->flags;
+
+		if (op == IOURING_OP_WAKEUP) {
+			// 깨우기 신호 소비
+			uint64_t value;
+			while (read(_wakeup_fd, &value, sizeof(value)) > 0) {}
+			if (!(flags & IORING_CQE_F_MORE)) {
+				rearmWakeup = true;
+			}
+			continue;
+		}
+		if (op == IOURING_OP_CANCEL) {
+			continue;
+		}
+
+		IoCompletion& completion = completions[filled++];
+		completion.context = reinterpret_cast<void*>(userData & ~IOURING_OP_MASK);
+		completion.op = op;
+		completion.result = cqes[i]->res;
+		completion.more = (flags & IORING_CQE_F_MORE) != 0;
+		completion.has_buffer = (flags & IORING_CQE_F_BUFFER) != 0;
+		completion.buffer_id = static_cast<uint16_t>(flags >> IORING_CQE_BUFFER_SHIFT);
+		completion.data = completion.has_buffer
+			? _buffers.data() + static_cast<size_t>(completion.buffer_id) * _buffer_size
+			: nullptr;
+	}
+
+	io_uring_cq_advance(&_ring, ready);
+	_completions += ready;
+
+	if (rearmWakeup) {
+		ArmWakeup();
+	}
+	return filled;
+}
+
+void IoUring::ReleaseBuffer(uint16_t bufferId)
+{
+	io_uring_buf_ring_add(_buf_ring, _buffers.data() + static_cast<size_t>(bufferId) * _buffer_size,
+		_buffer_size, bufferId, io_uring_buf_ring_mask(_buffer_count), 0);
+	io_uring_buf_ring_advance(_buf_ring, 1);
+}
+
+void IoUring::Wakeup()
+{
+	uint64_t one = 1;
+	ssize_t written = write(_wakeup_fd, &one, sizeof(one));
+	(void)written;
+}
+
+#endif
@@ -0,0 +1,81 @@
+﻿#pragma once
+#include "Packet.h"
+
+#ifdef USE_IO_URING
+
+#include <liburing.h>
+#include <vector>
+#include <cstdint>
+
+// user_data 하위 3비트에 넣는 요청 종류 (context 포인터는 8바이트 정렬)
+enum IoUringOp : uint32_t {
+    IOURING_OP_WAKEUP = 0,
+    IOURING_OP_ACCEPT = 1,
+    IOURING_OP_RECV = 2,
+    IOURING_OP_SEND = 3,
+    IOURING_OP_CANCEL = 4
+};
+
+// Wait()가 돌려주는 완료 이벤트
+struct IoCompletion {
+    void* context;         // 요청 시 넘긴 사용자 포인터
+    IoUringOp op;
+    int result;            // 처리한 바이트 수 / accept된 소켓, 실패 시 -errno
+    bool more;             // multishot 요청이 계속 살아있는지 (false면 다시 걸어야 함)
+    bool has_buffer;       // RECV 데이터가 제공 버퍼에 담겨 있는지
+    uint16_t buffer_id;    // 사용 후 ReleaseBuffer()로 돌려줘야 하는 버퍼 번호
+    const uint8_t* data;   // 제공 버퍼 시작 위치
+};
+
+// io_uring 래퍼 (liburing 사용)
+// - recv는 제공 버퍼 링(커널에 등록된 버퍼)을 쓰는 multishot 요청으로 연결당 한 번만 건다.
+// - accept도 multishot으로 걸어 연결마다 요청을 다시 제출하지 않는다.
+// - 준비된 SQE는 Wait()에서 한 번의 시스템 콜로 제출하고 완료를 모아서 받는다.
+// - Wakeup()을 제외한 모든 함수는 소유 스레드 하나에서만 호출한다.
+class IoUring
+{
+private:
+    io_uring _ring;
+    bool _initialized;
+
+    io_uring_buf_ring* _buf_ring;
+    std::vector<uint8_t> _buffers;
+    unsigned int _buffer_count;
+    unsigned int _buffer_size;
+
+    int _wakeup_fd;  // eventfd (multishot poll로 감시)
+
+    uint64_t _submit_calls;  // 제출/대기 시스템 콜 횟수
+    uint64_t _completions;   // 처리한 완료 이벤트 수
+
+    io_uring_sqe* GetSqe();
+    bool ArmWakeup();
+
+public:
+    IoUring();
+    ~IoUring();
+
+    // 실패하면 false (커널 미지원 등) - 호출자는 reactor로 대체한다
+    bool Initialize(unsigned int entries, unsigned int bufferCount, unsigned int bufferSize);
+
+    bool ArmAccept(SOCKET listenSocket, void* context);
+    bool ArmRecv(SOCKET sock, void* context);
+    // data는 완료 이벤트를 받을 때까지 유지되어야 한다
+    bool Send(SOCKET sock, void* context, const void* data, size_t size);
+    // 해당 소켓에 걸린 모든 요청 취소
+    bool Cancel(SOCKET sock);
+    // ArmRecv로 건 multishot recv만 취소 (진행 중인 send는 그대로 둠, 완료 이벤트는 -ECANCELED)
+    bool CancelRecv(void* context);
+
+    // 준비된 요청을 제출하고 완료 이벤트를 최대 maxCompletions개까지 채움 (타임아웃 시 0, 에러 시 -1)
+    int Wait(IoCompletion* completions, int maxCompletions, int timeoutMs);
+    void ReleaseBuffer(uint16_t bufferId);
+
+    // Wait() 중인 스레드를 즉시 깨움 (다른 스레드에서 호출 가능)
+    void Wakeup();
+
+    uint64_t GetSubmitCalls() const { return _submit_calls; }
+    uint64_t GetCompletions() const { return _completions; }
+};
+
+#endif
@@ -1,7 +1,14 @@
 ﻿#include "MySqlConnector.h"
 #include <iostream>
 
-MySqlConnector::MySqlConnector() : _is_init(false), timeout_sec(10)
+// errmsg.h의 클라이언트 에러 코드 (서버와의 연결 자체가 끊김)
+#define DB_ERROR_SERVER_GONE 2006  // CR_SERVER_GONE_ERROR
+#define DB_ERROR_SERVER_LOST 2013  // CR_SERVER_LOST
+// 서버가 준비된 문장을 잊은 경우 (다시 준비하면 됨)
+#define DB_ERROR_UNKNOWN_STMT 1243  // ER_UNKNOWN_STMT_HANDLER
+#define DB_ERROR_NEED_REPREPARE 1615  // ER_NEED_REPREPARE
+
+MySqlConnector::MySqlConnector() : _is_init(false), _connection_lost(false), timeout_sec(5)
 {
     conn = nullptr;
     conn_result = nullptr;
@@ -9,6 +16,7 @@ MySqlConnector::MySqlConnector() : _is_init(false), timeout_sec(10)
 
 MySqlConnector::~MySqlConnector()
 {
+    _statements.clear();
     if (conn) {
         mysql_close(conn);
         conn = nullptr;
@@ -26,7 +34,8 @@ bool MySqlConnector::Init()
         }
 
         mysql_options(conn, MYSQL_OPT_CONNECT_TIMEOUT, &timeout_sec);
-        mysql_options(conn, MYSQL_OPT_RECONNECT, &timeout_sec); // 자동 재연결
+        // 쿼리마다 문자셋을 다시 보내지 않도록 연결 핸드셰이크에서 한 번만 설정
+        mysql_options(conn, MYSQL_SET_CHARSET_NAME, DB_CONNECTION_CHARSET);
         _is_init = true;
         return true;
     }
@@ -41,9 +50,12 @@ bool MySqlConnector::Connect(std::string host, std::string userName, std::string
 {
     try
     {
-        conn_result = mysql_real_connect(conn, host.c_str(), userName.c_str(), pass.c_str(), dbName.c_str(), port, NULL, CLIENT_MULTI_STATEMENTS);
+        conn_result = mysql_real_connect(conn, host.c_str(), userName.c_str(), pass.c_str(), dbName.c_str(), port, NULL, 0);
         
         if (conn_result) {
+            // 세션 상태는 연결마다 한 번만 설정 (트랜잭션이 필요한 곳은 START TRANSACTION으로 명시)
+            mysql_autocommit(conn, 1);
+            _connection_lost = false;
             std::cout << "Success To Connect MySQL Database!" << std::endl;
             return true;
         }
@@ -61,27 +73,110 @@ bool MySqlConnector::Connect(std::string host, std::string userName, std::string
 
 bool MySqlConnector::ExecuteQuery(const std::string& query)
 {
-    mysql_set_character_set(conn, "euckr");
-
-    if (!conn || !_is_init) {
+    if (!IsConnected()) {
         std::cerr << "MySQL not initialized or connected" << std::endl;
         return false;
     }
 
-    int result = mysql_query(conn, query.c_str());
+    int result = mysql_real_query(conn, query.c_str(), static_cast<unsigned long>(query.size()));
     if (result != 0) {
         std::cerr << "Query failed: " << mysql_error(conn) << std::endl;
+        CheckConnectionLost();
+        return false;
+    }
+    return true;
+}
+
+bool MySqlConnector::Ping()
+{
+    if (!IsConnected()) {
+        return false;
+    }
+
+    if (mysql_ping(conn) != 0) {
+        std::cerr << "MySQL ping failed: " << mysql_error(conn) << std::endl;
+        _connection_lost = true;  // ping이 실패하면 에러 코드와 상관없이 다시 연결한다
         return false;
     }
     return true;
 }
 
+PreparedStatement* MySqlConnector::GetStatement(const char* sql)
+{
+    if (!IsConnected()) {
+        return nullptr;
+    }
+
+    auto it = _statements.find(sql);
+    if (it != _statements.end()) {
+        return it->second.get();
+    }
+
+    std::unique_ptr<PreparedStatement> stmt = std::make_unique<PreparedStatement>(conn, sql);
+    if (!stmt->Prepare()) {
+        std::cerr << "Statement prepare failed: " << stmt->GetError() << std::endl;
+        CheckConnectionLost(stmt->GetErrno());
+        return nullptr;
+    }
+
+    PreparedStatement* prepared = stmt.get();
+    _statements.emplace(sql, std::move(stmt));
+    return prepared;
+}
+
+bool MySqlConnector::Execute(PreparedStatement* stmt, bool store_result)
+{
+    if (!stmt || !IsConnected()) {
+        return false;
+    }
+
+    if (stmt->Execute(store_result)) {
+        return true;
+    }
+
+    unsigned int error = stmt->GetErrno();
+    if (error == DB_ERROR_UNKNOWN_STMT || error == DB_ERROR_NEED_REPREPARE) {
+        // 바인딩 값은 문장 객체에 남아 있으므로 다시 준비만 하고 그대로 재실행
+        if (stmt->Prepare() && stmt->Execute(store_result)) {
+            return true;
+        }
+        error = stmt->GetErrno();
+    }
+
+    std::cerr << "Statement failed: " << stmt->GetError() << std::endl;
+    CheckConnectionLost(error);
+    return false;
+}
+
+void MySqlConnector::CheckConnectionLost()
+{
+    CheckConnectionLost(mysql_errno(conn));
+}
+
+void MySqlConnector::CheckConnectionLost(unsigned int error)
+{
+    if (error == DB_ERROR_SERVER_GONE || error == DB_ERROR_SERVER_LOST) {
+        _connection_lost = true;
+    }
+}
+
 MYSQL_RES* MySqlConnector::GetResult()
 {
     if (!conn) return nullptr;
     return mysql_store_result(conn);
 }
 
+std::unique_ptr<ResultRowReader> MySqlConnector::UseResult()
+{
+    if (!conn) return nullptr;
+    MYSQL_RES* result = mysql_use_result(conn);
+    if (!result) {
+        CheckConnectionLost();
+        return nullptr;
+    }
+    return std::make_unique<ResultRowReader>(result, conn);
+}
+
 void MySqlConnector::FreeResult(MYSQL_RES* result)
 {
     if (result) {
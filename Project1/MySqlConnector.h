@@ -1,17 +1,35 @@
 ﻿#pragma once
 #include <string>
 #include <memory>
+#include <unordered_map>
 #include "Packet.h"
+#include "PreparedStatement.h"
 #include <mysql.h>
 
+#define DB_CONNECTION_CHARSET "euckr"  // 연결할 때 한 번만 설정하는 세션 문자셋
+
+// MYSQL 연결 하나 (DB 실행기 스레드마다 하나씩 가지며 스레드 사이에 공유하지 않음)
+// - 문자셋과 autocommit 같은 세션 상태는 연결할 때 한 번만 설정한다.
+// - 자동 재연결은 쓰지 않는다 (몰래 다시 붙으면 세션 상태가 사라짐). 서버와 연결이 끊긴 것을 감지하면
+//   IsConnected()가 false가 되고, 재연결은 소유 실행기가 새 연결을 만들어 처리한다.
+// - 자주 쓰는 쿼리는 GetStatement로 연결마다 한 번만 준비해 두고 재사용한다.
+//   새 연결은 빈 캐시로 시작하므로 재연결 뒤에는 처음 쓸 때 다시 준비된다.
 class MySqlConnector
 {
 private:
     bool _is_init;
+    bool _connection_lost;  // 쿼리/ping 중 서버와 연결이 끊긴 것을 감지함
     MYSQL* conn;
     MYSQL* conn_result;
     unsigned int timeout_sec;
 
+    // SQL 문자열 포인터 -> 준비된 문장 (MYSQL 핸들보다 먼저 닫아야 함)
+    std::unordered_map<const char*, std::unique_ptr<PreparedStatement>> _statements;
+
+    // 연결 자체가 끊겨 실패한 경우인지 확인하고 표시
+    void CheckConnectionLost();
+    void CheckConnectionLost(unsigned int error);
+
 public:
     MySqlConnector();
     ~MySqlConnector();
@@ -22,8 +40,22 @@ public:
     // 쿼리 실행 함수들 추가
     bool ExecuteQuery(const std::string& query);
     MYSQL_RES* GetResult();
+    // 텍스트 쿼리 결과를 받아 두지 않고 한 행씩 읽는 리더 (mysql_use_result, 실패하면 nullptr)
+    // 리더를 다 읽거나 해제하기 전까지 이 연결로 다른 쿼리를 실행할 수 없다.
+    std::unique_ptr<ResultRowReader> UseResult();
     void FreeResult(MYSQL_RES* result);
     int GetAffectedRows();
 
-    bool IsConnected() const { return conn && _is_init; }
+    // 준비된 문장 (sql은 정적 문자열이어야 하며 포인터로 캐시를 찾는다, 준비에 실패하면 nullptr)
+    PreparedStatement* GetStatement(const char* sql);
+    // 준비된 문장 실행 (서버가 문장을 잊었으면 다시 준비해 한 번 재시도, 연결이 끊긴 것도 감지)
+    bool Execute(PreparedStatement* stmt, bool store_result = true);
+    // 결과를 미리 받아 두지 않는 실행 (긴 목록을 읽으면서 바로 조각으로 보낼 때, 다 읽으면 FreeResult)
+    bool ExecuteStreaming(PreparedStatement* stmt) { return Execute(stmt, false); }
+    size_t GetStatementCount() const { return _statements.size(); }
+
+    // 서버에 왕복 요청을 보내 연결이 살아 있는지 확인 (유휴 상태 헬스 체크용)
+    bool Ping();
+
+    bool IsConnected() const { return conn && conn_result && _is_init && !_connection_lost; }
 };
\ No newline at end of file
@@ -0,0 +1,318 @@
+﻿#include "PreparedStatement.h"
+#include <cstring>
+#include <charconv>
+
+PreparedStatement::PreparedStatement(MYSQL* conn, const char* sql)
+	: _stmt(nullptr), _sql(sql), _has_result(false), _fetch_error(false)
+{
+	_stmt = mysql_stmt_init(conn);
+}
+
+PreparedStatement::~PreparedStatement()
+{
+	if (_stmt) {
+		mysql_stmt_close(_stmt);
+		_stmt = nullptr;
+	}
+}
+
+bool PreparedStatement::Prepare()
+{
+	if (!_stmt) {
+		return false;
+	}
+
+	FreeResult();
+	if (mysql_stmt_prepare(_stmt, _sql.c_str(), static_cast<unsigned long>(_sql.size())) != 0) {
+		return false;
+	}
+
+	// 같은 SQL을 다시 준비하는 경우(서버가 문장을 잊음)에는 바인딩해 둔 값을 그대로 둔다
+	unsigned long paramCount = mysql_stmt_param_count(_stmt);
+	if (paramCount != _param_binds.size()) {
+		_param_binds.assign(paramCount, MYSQL_BIND());
+		_params.assign(paramCount, ParamValue());
+		for (MYSQL_BIND& bind : _param_binds) {
+			bind.buffer_type = MYSQL_TYPE_NULL;  // 채우지 않은 자리는 NULL로 보냄
+		}
+	}
+	_column_binds.clear();
+	_columns.clear();
+	return true;
+}
+
+MYSQL_BIND& PreparedStatement::ParamBind(unsigned int index)
+{
+	MYSQL_BIND& bind = _param_binds[index];
+	memset(&bind, 0, sizeof(MYSQL_BIND));
+	_params[index].is_null = 0;
+	return bind;
+}
+
+void PreparedStatement::BindUInt(unsigned int index, uint32_t value)
+{
+	if (index >= _params.size()) return;
+	MYSQL_BIND& bind = ParamBind(index);
+	_params[index].int_value = value;
+	bind.buffer_type = MYSQL_TYPE_LONGLONG;
+	bind.buffer = &_params[index].int_value;
+	bind.is_unsigned = 1;
+}
+
+void PreparedStatement::BindInt(unsigned int index, int64_t value)
+{
+	if (index >= _params.size()) return;
+	MYSQL_BIND& bind = ParamBind(index);
+	_params[index].int_value = value;
+	bind.buffer_type = MYSQL_TYPE_LONGLONG;
+	bind.buffer = &_params[index].int_value;
+}
+
+void PreparedStatement::BindFloat(unsigned int index, float value)
+{
+	if (index >= _params.size()) return;
+	MYSQL_BIND& bind = ParamBind(index);
+	_params[index].double_value = value;
+	bind.buffer_type = MYSQL_TYPE_DOUBLE;
+	bind.buffer = &_params[index].double_value;
+}
+
+void PreparedStatement::BindString(unsigned int index, const char* data, size_t length)
+{
+	if (index >= _params.size()) return;
+	MYSQL_BIND& bind = ParamBind(index);
+	_params[index].length = static_cast<unsigned long>(length);
+	bind.buffer_type = MYSQL_TYPE_STRING;
+	bind.buffer = const_cast<char*>(data ? data : "");
+	bind.buffer_length = static_cast<unsigned long>(length);
+	bind.length = &_params[index].length;
+}
+
+void PreparedStatement::BindNull(unsigned int index)
+{
+	if (index >= _params.size()) return;
+	MYSQL_BIND& bind = ParamBind(index);
+	_params[index].is_null = 1;
+	bind.buffer_type = MYSQL_TYPE_NULL;
+	bind.is_null = &_params[index].is_null;
+}
+
+bool PreparedStatement::Execute(bool store_result)
+{
+	if (!_stmt) {
+		return false;
+	}
+
+	FreeResult();
+	_fetch_error = false;
+	if (!_param_binds.empty() && mysql_stmt_bind_param(_stmt, _param_binds.data())) {
+		return false;
+	}
+	if (mysql_stmt_execute(_stmt) != 0) {
+		return false;
+	}
+	if (!BindResult()) {
+		return false;
+	}
+
+	// 행을 모두 클라이언트로 받아 두어 결과를 읽는 동안 같은 연결로 다른 문장을 실행할 수 있게 함
+	// (스트리밍이면 받아 두지 않고 Fetch마다 한 행씩 읽어 결과 크기와 상관없이 메모리를 일정하게 유지)
+	if (_has_result && store_result && mysql_stmt_store_result(_stmt) != 0) {
+		return false;
+	}
+	return true;
+}
+
+bool PreparedStatement::BindResult()
+{
+	MYSQL_RES* metadata = mysql_stmt_result_metadata(_stmt);
+	if (!metadata) {
+		// INSERT/UPDATE처럼 결과 집합이 없는 문장
+		return mysql_stmt_errno(_stmt) == 0;
+	}
+
+	// 컬럼 구성은 문장마다 고정이므로 처음 실행할 때 한 번만 버퍼를 만든다
+	if (_columns.empty()) {
+		unsigned int fieldCount = mysql_stmt_field_count(_stmt);
+		MYSQL_FIELD* fields = mysql_fetch_fields(metadata);
+		_columns.assign(fieldCount, ColumnValue());
+		_column_binds.assign(fieldCount, MYSQL_BIND());
+
+		for (unsigned int i = 0; i < fieldCount; ++i) {
+			ColumnValue& column = _columns[i];
+			MYSQL_BIND& bind = _column_binds[i];
+			memset(&bind, 0, sizeof(MYSQL_BIND));
+
+			switch (fields[i].type) {
+			case MYSQL_TYPE_TINY:
+			case MYSQL_TYPE_SHORT:
+			case MYSQL_TYPE_INT24:
+			case MYSQL_TYPE_LONG:
+			case MYSQL_TYPE_LONGLONG:
+			case MYSQL_TYPE_YEAR:
+				column.type = MYSQL_TYPE_LONGLONG;
+				bind.buffer = &column.int_value;
+				bind.is_unsigned = (fields[i].flags & UNSIGNED_FLAG) ? 1 : 0;
+				break;
+			case MYSQL_TYPE_FLOAT:
+			case MYSQL_TYPE_DOUBLE:
+			case MYSQL_TYPE_DECIMAL:
+			case MYSQL_TYPE_NEWDECIMAL:
+				column.type = MYSQL_TYPE_DOUBLE;
+				bind.buffer = &column.double_value;
+				break;
+			default:
+				// 문자열/날짜 등은 텍스트로 받음 (NUL을 붙일 자리 하나를 더 둔다)
+				column.type = MYSQL_TYPE_STRING;
+				column.text.resize(fields[i].length > 0 && fields[i].length < STMT_STRING_BUFFER_SIZE
+					? fields[i].length + 1 : STMT_STRING_BUFFER_SIZE);
+				bind.buffer = column.text.data();
+				bind.buffer_length = static_cast<unsigned long>(column.text.size() - 1);
+				break;
+			}
+			bind.buffer_type = column.type;
+			bind.length = &column.length;
+			bind.is_null = &column.is_null;
+			bind.error = &column.error;
+		}
+	}
+	mysql_free_result(metadata);
+
+	_has_result = true;
+	return mysql_stmt_bind_result(_stmt, _column_binds.data()) == 0;
+}
+
+bool PreparedStatement::Fetch()
+{
+	if (!_has_result) {
+		return false;
+	}
+
+	int result = mysql_stmt_fetch(_stmt);
+	if (result == MYSQL_DATA_TRUNCATED) {
+		return RefetchTruncated();
+	}
+	_fetch_error = result != 0 && result != MYSQL_NO_DATA;
+	return result == 0;
+}
+
+bool PreparedStatement::RefetchTruncated()
+{
+	for (unsigned int i = 0; i < _columns.size(); ++i) {
+		ColumnValue& column = _columns[i];
+		if (!column.error || column.type != MYSQL_TYPE_STRING) {
+			continue;
+		}
+
+		// 이 행의 실제 길이만큼 키워 다시 읽고, 다음 행부터는 키운 버퍼를 쓴다
+		column.text.resize(column.length + 1);
+		MYSQL_BIND& bind = _column_binds[i];
+		bind.buffer = column.text.data();
+		bind.buffer_length = column.length;
+		if (mysql_stmt_fetch_column(_stmt, &bind, i, 0) != 0) {
+			_fetch_error = true;
+			return false;
+		}
+		column.error = 0;
+	}
+	if (mysql_stmt_bind_result(_stmt, _column_binds.data()) != 0) {
+		_fetch_error = true;
+		return false;
+	}
+	return true;
+}
+
+std::string_view PreparedStatement::TextOf(const ColumnValue& value)
+{
+	// 다시 읽지 못한 잘린 값이면 버퍼에 들어온 만큼만
+	size_t length = value.length < value.text.size() ? value.length : value.text.size();
+	return std::string_view(value.text.data(), length);
+}
+
+bool PreparedStatement::IsNull(unsigned int column) const
+{
+	return column >= _columns.size() || _columns[column].is_null;
+}
+
+uint64_t PreparedStatement::GetUInt64(unsigned int column) const
+{
+	if (IsNull(column)) {
+		return 0;
+	}
+
+	const ColumnValue& value = _columns[column];
+	switch (value.type) {
+	case MYSQL_TYPE_LONGLONG:
+		return static_cast<uint64_t>(value.int_value);
+	case MYSQL_TYPE_DOUBLE:
+		return value.double_value > 0 ? static_cast<uint64_t>(value.double_value) : 0;
+	default:
+		return ParseUInt(TextOf(value));
+	}
+}
+
+float PreparedStatement::GetFloat(unsigned int column) const
+{
+	if (IsNull(column)) {
+		return 0.0f;
+	}
+
+	const ColumnValue& value = _columns[column];
+	switch (value.type) {
+	case MYSQL_TYPE_LONGLONG:
+		return static_cast<float>(value.int_value);
+	case MYSQL_TYPE_DOUBLE:
+		return static_cast<float>(value.double_value);
+	default:
+		return ParseFloat(TextOf(value));
+	}
+}
+
+std::string_view PreparedStatement::GetString(unsigned int column) const
+{
+	if (IsNull(column)) {
+		return std::string_view();
+	}
+
+	const ColumnValue& value = _columns[column];
+	if (value.type == MYSQL_TYPE_STRING) {
+		return TextOf(value);
+	}
+
+	// 숫자 컬럼은 컬럼마다 둔 자리에 써서 돌려줌 (다음 호출 전까지 유효)
+	char* begin = value.number_text;
+	char* end = value.number_text + sizeof(value.number_text);
+	std::to_chars_result result = value.type == MYSQL_TYPE_LONGLONG
+		? std::to_chars(begin, end, value.int_value)
+		: std::to_chars(begin, end, value.double_value);
+	value.number_length = result.ec == std::errc() ? static_cast<unsigned int>(result.ptr - begin) : 0;
+	return std::string_view(begin, value.number_length);
+}
+
+void PreparedStatement::FreeResult()
+{
+	if (_stmt && _has_result) {
+		mysql_stmt_free_result(_stmt);
+	}
+	_has_result = false;
+}
+
+uint64_t PreparedStatement::GetAffectedRows() const
+{
+	return _stmt ? mysql_stmt_affected_rows(_stmt) : 0;
+}
+
+uint64_t PreparedStatement::GetInsertId() const
+{
+	return _stmt ? mysql_stmt_insert_id(_stmt) : 0;
+}
+
+unsigned int PreparedStatement::GetErrno() const
+{
+	return _stmt ? mysql_stmt_errno(_stmt) : 0;
+}
+
+const char* PreparedStatement::GetError() const
+{
+	return _stmt ? mysql_stmt_error(_stmt) : "statement not initialized";
+}
@@ -0,0 +1,93 @@
+﻿#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <mysql.h>
+#include "RowReader.h"
+
+#define STMT_STRING_BUFFER_SIZE 256  // 문자열 컬럼 초기 버퍼 크기 (넘으면 그 행만 컬럼을 다시 읽어 키운다)
+
+// MYSQL_STMT 하나 (MySqlConnector가 SQL마다 한 번 준비해 두고 재사용)
+// - 파라미터는 ? 자리에 바이너리로 묶어 보내므로 문자열 조립/이스케이프가 필요 없다.
+// - 결과도 바이너리 프로토콜로 받아 정수/실수 컬럼은 문자열 변환 없이 바로 읽는다 (RowReader 구현).
+// - 바인딩한 문자열은 Execute가 끝날 때까지만 살아 있으면 된다 (복사하지 않음).
+// - 결과 행은 FreeResult(또는 다음 Execute) 전까지만 유효하다.
+// - Execute(false)는 결과를 미리 받아 두지 않고 Fetch할 때마다 서버에서 한 행씩 읽는다 (긴 목록용).
+//   이 경우 FreeResult 전까지 같은 연결로 다른 쿼리를 실행할 수 없다.
+class PreparedStatement : public RowReader
+{
+private:
+    // 파라미터 하나의 값 저장소 (MYSQL_BIND가 가리킴)
+    struct ParamValue {
+        int64_t int_value;
+        double double_value;
+        unsigned long length;
+        my_bool is_null;
+    };
+
+    // 결과 컬럼 하나의 버퍼 (MYSQL_BIND가 가리킴)
+    struct ColumnValue {
+        enum_field_types type;  // 바인딩한 버퍼 타입 (LONGLONG, DOUBLE, STRING 중 하나)
+        int64_t int_value;
+        double double_value;
+        std::vector<char> text;
+        unsigned long length;
+        mutable char number_text[32];  // 숫자 컬럼을 문자열로 읽을 때 쓰는 자리
+        mutable unsigned int number_length;
+        my_bool is_null;
+        my_bool error;
+    };
+
+    MYSQL_STMT* _stmt;
+    std::string _sql;
+    std::vector<MYSQL_BIND> _param_binds;
+    std::vector<ParamValue> _params;
+    std::vector<MYSQL_BIND> _column_binds;
+    std::vector<ColumnValue> _columns;
+    bool _has_result;
+    bool _fetch_error;
+
+    MYSQL_BIND& ParamBind(unsigned int index);
+    // 결과 메타데이터로 컬럼 버퍼를 만들어 바인딩 (결과가 없는 문장이면 아무것도 안 함)
+    bool BindResult();
+    // 잘린 문자열 컬럼을 실제 길이로 키워 다시 읽음
+    bool RefetchTruncated();
+    static std::string_view TextOf(const ColumnValue& value);
+
+public:
+    PreparedStatement(MYSQL* conn, const char* sql);
+    ~PreparedStatement() override;
+
+    PreparedStatement(const PreparedStatement&) = delete;
+    PreparedStatement& operator=(const PreparedStatement&) = delete;
+
+    // 서버에 문장을 준비 (실패하면 false, 에러 코드는 GetErrno)
+    bool Prepare();
+    const std::string& GetSql() const { return _sql; }
+
+    // === 파라미터 바인딩 (index는 0부터, Execute 전에 모든 ? 자리를 채운다) ===
+    void BindUInt(unsigned int index, uint32_t value);
+    void BindInt(unsigned int index, int64_t value);
+    void BindFloat(unsigned int index, float value);
+    void BindString(unsigned int index, const char* data, size_t length);
+    void BindString(unsigned int index, const std::string& value) { BindString(index, value.data(), value.size()); }
+    void BindNull(unsigned int index);
+
+    // 실행하고 결과 집합이 있으면 클라이언트로 모두 받아 둔다 (store_result가 false면 스트리밍)
+    bool Execute(bool store_result = true);
+
+    // === 결과 읽기 (RowReader) ===
+    bool Fetch() override;
+    unsigned int GetColumnCount() const override { return static_cast<unsigned int>(_columns.size()); }
+    bool IsNull(unsigned int column) const override;
+    uint64_t GetUInt64(unsigned int column) const override;
+    float GetFloat(unsigned int column) const override;
+    std::string_view GetString(unsigned int column) const override;
+    void FreeResult() override;
+    bool HasFetchError() const override { return _fetch_error; }
+
+    uint64_t GetAffectedRows() const;
+    uint64_t GetInsertId() const;
+    unsigned int GetErrno() const;
+    const char* GetError() const;
+};
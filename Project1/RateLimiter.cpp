@@ -0,0 +1,84 @@
+﻿#include "RateLimiter.h"
+#include "UserEvent_generated.h"
+#include <cstring>
+#include <cstdlib>
+#include <string>
+
+static_assert(EventType_MAX < RATE_LIMIT_EVENT_SLOTS, "RATE_LIMIT_EVENT_SLOTS가 EventType 범위보다 작음");
+
+RateLimitPolicy::RateLimitPolicy(const RateLimit& connectionLimit, const RateLimit* eventLimits, uint32_t violationLimit)
+	: _connection_limit(connectionLimit), _violation_limit(violationLimit)
+{
+	for (int i = 0; i < RATE_LIMIT_EVENT_SLOTS; ++i) {
+		_event_slots[i] = -1;
+		if (eventLimits != nullptr && eventLimits[i].IsEnabled()) {
+			_event_slots[i] = static_cast<int8_t>(_event_limits.size());
+			_event_limits.push_back(eventLimits[i]);
+		}
+	}
+}
+
+bool RateLimitPolicy::AllowEvent(std::vector<TokenBucket>& buckets, EventType packetType, std::chrono::steady_clock::time_point now) const
+{
+	int slot = packetType < RATE_LIMIT_EVENT_SLOTS ? _event_slots[packetType] : -1;
+	if (slot < 0) {
+		return true;
+	}
+	return buckets[slot].TryConsume(_event_limits[slot], now);
+}
+
+void RateLimitPolicy::SetDefaultEventLimits(RateLimit* eventLimits)
+{
+	for (int i = 0; i < RATE_LIMIT_EVENT_SLOTS; ++i) {
+		eventLimits[i] = RateLimit();
+	}
+
+	// 채팅은 저장 쿼리가 따라오고, 목록 조회는 결과가 거의 바뀌지 않으므로 짧게 몰아서만 허용
+	eventLimits[EventType_C2S_PlayerChat] = RateLimit(5, 10);
+	eventLimits[EventType_C2S_GameServerList] = RateLimit(2, 5);
+	eventLimits[EventType_C2S_ShopList] = RateLimit(5, 10);
+	eventLimits[EventType_C2S_ShopItems] = RateLimit(5, 10);
+	eventLimits[EventType_C2S_MonsterData] = RateLimit(5, 10);
+}
+
+bool RateLimitPolicy::ParseRateLimit(const char* text, RateLimit& limit)
+{
+	char* end = nullptr;
+	long rate = strtol(text, &end, 10);
+	if (end == text || rate < 0) {
+		return false;
+	}
+
+	long burst = rate;
+	if (*end == ':') {
+		const char* burstText = end + 1;
+		burst = strtol(burstText, &end, 10);
+		if (end == burstText || burst < 0) {
+			return false;
+		}
+	}
+	if (*end != '\0') {
+		return false;
+	}
+
+	limit = RateLimit(static_cast<uint32_t>(rate), static_cast<uint32_t>(burst));
+	return true;
+}
+
+bool RateLimitPolicy::ParseEventLimit(const char* text, EventType& packetType, RateLimit& limit)
+{
+	const char* separator = strchr(text, '=');
+	if (separator == nullptr) {
+		return false;
+	}
+
+	std::string name(text, separator - text);
+	const char* const* names = EnumNamesEventType();
+	for (int i = EventType_MIN; i <= EventType_MAX; ++i) {
+		if (name == names[i]) {
+			packetType = static_cast<EventType>(i);
+			return ParseRateLimit(separator + 1, limit);
+		}
+	}
+	return false;
+}
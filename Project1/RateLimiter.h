@@ -0,0 +1,92 @@
+﻿#pragma once
+#include <chrono>
+#include <vector>
+#include <cstdint>
+
+enum EventType : uint8_t;
+
+#define RATE_LIMIT_EVENT_SLOTS 32   // EventType 값 범위 (EventType_MAX보다 커야 함)
+
+// 초당 허용 횟수와 한 번에 몰아서 허용할 수 있는 양 (rate가 0이면 제한 없음)
+struct RateLimit {
+    uint32_t rate;
+    uint32_t burst;
+
+    RateLimit(uint32_t r = 0, uint32_t b = 0) : rate(r), burst(b) {}
+    bool IsEnabled() const { return rate > 0; }
+};
+
+// 토큰 버킷 하나 (연결별로 들고 다니므로 한도는 밖에서 넘겨받고 상태만 가진다)
+// - 처음 쓸 때 burst만큼 채워져 있고, 경과 시간 x rate만큼 다시 채워진다.
+// - 동기화하지 않으므로 한 번에 한 스레드만 사용해야 한다.
+class TokenBucket
+{
+private:
+    double _tokens;
+    std::chrono::steady_clock::time_point _last_refill;
+    bool _started;
+
+public:
+    TokenBucket() : _tokens(0.0), _started(false) {}
+
+    bool TryConsume(const RateLimit& limit, std::chrono::steady_clock::time_point now) {
+        if (!limit.IsEnabled()) {
+            return true;
+        }
+
+        double capacity = static_cast<double>(limit.burst > 0 ? limit.burst : 1);
+        if (!_started) {
+            _tokens = capacity;
+            _started = true;
+        }
+        else if (now > _last_refill) {
+            _tokens += std::chrono::duration<double>(now - _last_refill).count() * limit.rate;
+            if (_tokens > capacity) {
+                _tokens = capacity;
+            }
+        }
+        _last_refill = now;
+
+        if (_tokens < 1.0) {
+            return false;
+        }
+        _tokens -= 1.0;
+        return true;
+    }
+};
+
+// 연결당/요청 종류별 속도 제한 정책 (실행 중에는 바뀌지 않으므로 워커마다 복사해 둔다)
+// - 연결 전체 한도는 프레임을 조립한 직후 소유 워커가 검사하고, 넘치는 프레임은 응답 없이 버린다.
+// - 종류별 한도는 검증 후 요청 큐에 넣기 전에 검사하고, 넘치는 요청은 바로 실패 응답을 받는다.
+// - 제한이 걸린 종류만 버킷을 가지므로 연결마다 필요한 버킷 수는 EventBucketCount()개다.
+class RateLimitPolicy
+{
+private:
+    RateLimit _connection_limit;
+    std::vector<RateLimit> _event_limits;           // 제한이 걸린 종류만 (버킷 번호 순)
+    int8_t _event_slots[RATE_LIMIT_EVENT_SLOTS];     // EventType -> 버킷 번호 (-1이면 제한 없음)
+    uint32_t _violation_limit;
+
+public:
+    RateLimitPolicy(const RateLimit& connectionLimit, const RateLimit* eventLimits, uint32_t violationLimit);
+
+    // 연결 전체 프레임 한도 검사
+    bool AllowFrame(TokenBucket& bucket, std::chrono::steady_clock::time_point now) const {
+        return bucket.TryConsume(_connection_limit, now);
+    }
+    bool HasFrameLimit() const { return _connection_limit.IsEnabled(); }
+
+    // 요청 종류별 한도 검사 (buckets는 EventBucketCount()개로 준비된 연결별 버킷)
+    bool AllowEvent(std::vector<TokenBucket>& buckets, EventType packetType, std::chrono::steady_clock::time_point now) const;
+    size_t EventBucketCount() const { return _event_limits.size(); }
+
+    // 한도 위반이 이 횟수에 도달하면 연결을 끊는다 (0이면 끊지 않음)
+    uint32_t GetViolationLimit() const { return _violation_limit; }
+
+    // 종류별 기본 한도 (DB 조회만 하고 남용되기 쉬운 요청)
+    static void SetDefaultEventLimits(RateLimit* eventLimits);
+    // "N" 또는 "N:B" 형식 (초당 N회, 최대 B회 몰아서 허용, B를 생략하면 N)
+    static bool ParseRateLimit(const char* text, RateLimit& limit);
+    // "C2S_PlayerChat=N[:B]" 형식
+    static bool ParseEventLimit(const char* text, EventType& packetType, RateLimit& limit);
+};
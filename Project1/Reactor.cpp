@@ -0,0 +1,287 @@
+﻿#include "Reactor.h"
+#include <iostream>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef REACTOR_USE_EPOLL
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#endif
+
+std::unique_ptr<Reactor> Reactor::Create()
+{
+#ifdef REACTOR_USE_EPOLL
+	return std::make_unique<EpollReactor>();
+#else
+	return std::make_unique<PollReactor>();
+#endif
+}
+
+#ifdef REACTOR_USE_EPOLL
+
+// === EpollReactor ===
+
+EpollReactor::EpollReactor()
+	: _epoll_fd(-1), _wakeup_fd(-1)
+{
+	_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+	if (_epoll_fd < 0) {
+		throw std::runtime_error("epoll_create1 failed");
+	}
+
+	_wakeup_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (_wakeup_fd < 0) {
+		close(_epoll_fd);
+		throw std::runtime_error("eventfd failed");
+	}
+
+	// 깨우기용 eventfd는 context = nullptr 로 등록해 일반 소켓과 구분
+	epoll_event ev;
+	memset(&ev, 0, sizeof(ev));
+	ev.events = EPOLLIN | EPOLLET;
+	ev.data.ptr = nullptr;
+	epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, _wakeup_fd, &ev);
+}
+
+EpollReactor::~EpollReactor()
+{
+	if (_wakeup_fd >= 0) close(_wakeup_fd);
+	if (_epoll_fd >= 0) close(_epoll_fd);
+}
+
+bool EpollReactor::Add(SOCKET sock, void* context)
+{
+	epoll_event ev;
+	memset(&ev, 0, sizeof(ev));
+	ev.events = EPOLLIN | EPOLLRDHUP | EPOLLET;
+	ev.data.ptr = context;
+
+	if (epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, sock, &ev) != 0) {
+		std::cerr << "[Reactor] epoll_ctl ADD 실패: " << errno << std::endl;
+		return false;
+	}
+	return true;
+}
+
+void EpollReactor::Remove(SOCKET sock)
+{
+	epoll_ctl(_epoll_fd, EPOLL_CTL_DEL, sock, nullptr);
+}
+
+bool EpollReactor::Modify(SOCKET sock, void* context, uint32_t interest)
+{
+	epoll_event ev;
+	memset(&ev, 0, sizeof(ev));
+	ev.events = EPOLLRDHUP | EPOLLET;
+	if (interest & REACTOR_READ) ev.events |= EPOLLIN;
+	if (interest & REACTOR_WRITE) ev.events |= EPOLLOUT;
+	ev.data.ptr = context;
+
+	// MOD는 엣지 상태를 다시 평가하므로 이미 쓰기 가능한 소켓이면 곧바로 EPOLLOUT이 보고된다
+	if (epoll_ctl(_epoll_fd, EPOLL_CTL_MOD, sock, &ev) != 0) {
+		std::cerr << "[Reactor] epoll_ctl MOD 실패: " << errno << std::endl;
+		return false;
+	}
+	return true;
+}
+
+int EpollReactor::Wait(ReactorEvent* events, int maxEvents, int timeoutMs)
+{
+	epoll_event readyEvents[128];
+	if (maxEvents > 128) maxEvents = 128;
+
+	int count = epoll_wait(_epoll_fd, readyEvents, maxEvents, timeoutMs);
+	if (count < 0) {
+		return errno == EINTR ? 0 : -1;
+	}
+
+	int filled = 0;
+	for (int i = 0; i < count; ++i) {
+		if (readyEvents[i].data.ptr == nullptr) {
+			// 깨우기 신호 소비
+			uint64_t value;
+			while (read(_wakeup_fd, &value, sizeof(value)) > 0) {}
+			continue;
+		}
+
+		uint32_t flags = 0;
+		if (readyEvents[i].events & EPOLLIN) flags |= REACTOR_READ;
+		if (readyEvents[i].events & EPOLLOUT) flags |= REACTOR_WRITE;
+		if (readyEvents[i].events & (EPOLLERR | EPOLLHUP | EPOLLRDHUP)) flags |= REACTOR_ERROR;
+
+		events[filled].context = readyEvents[i].data.ptr;
+		events[filled].events = flags;
+		++filled;
+	}
+	return filled;
+}
+
+void EpollReactor::Wakeup()
+{
+	uint64_t one = 1;
+	ssize_t written = write(_wakeup_fd, &one, sizeof(one));
+	(void)written;
+}
+
+#endif
+
+// === PollReactor ===
+
+PollReactor::PollReactor()
+	: _wakeup_recv(INVALID_SOCKET), _wakeup_send(INVALID_SOCKET)
+{
+	// 루프백 UDP 소켓 쌍으로 Wait()를 깨운다 (WSAPoll은 소켓만 대기 가능)
+	_wakeup_recv = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	_wakeup_send = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (_wakeup_recv == INVALID_SOCKET || _wakeup_send == INVALID_SOCKET) {
+		throw std::runtime_error("wakeup socket creation failed");
+	}
+
+	sockaddr_in addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	addr.sin_port = 0;
+
+	socklen_t addrLen = sizeof(addr);
+	if (bind(_wakeup_recv, (sockaddr*)&addr, sizeof(addr)) == SOCKET_ERROR ||
+		getsockname(_wakeup_recv, (sockaddr*)&addr, &addrLen) == SOCKET_ERROR ||
+		connect(_wakeup_send, (sockaddr*)&addr, sizeof(addr)) == SOCKET_ERROR) {
+		closesocket(_wakeup_recv);
+		closesocket(_wakeup_send);
+		throw std::runtime_error("wakeup socket setup failed");
+	}
+
+	SetSocketNonBlocking(_wakeup_recv);
+	SetSocketNonBlocking(_wakeup_send);
+
+	_fds.push_back({});
+	_fds[0].fd = _wakeup_recv;
+	_fds[0].events = POLLIN;
+	_contexts.push_back(nullptr);
+}
+
+PollReactor::~PollReactor()
+{
+	if (_wakeup_recv != INVALID_SOCKET) closesocket(_wakeup_recv);
+	if (_wakeup_send != INVALID_SOCKET) closesocket(_wakeup_send);
+}
+
+void PollReactor::PushPendingChange(const PendingChange& change)
+{
+	{
+		std::lock_guard<std::mutex> lock(_pending_mutex);
+		_pending.push_back(change);
+	}
+	Wakeup();
+}
+
+bool PollReactor::Add(SOCKET sock, void* context)
+{
+	PushPendingChange({ sock, context, PENDING_ADD, REACTOR_READ });
+	return true;
+}
+
+void PollReactor::Remove(SOCKET sock)
+{
+	PushPendingChange({ sock, nullptr, PENDING_REMOVE, 0 });
+}
+
+bool PollReactor::Modify(SOCKET sock, void* context, uint32_t interest)
+{
+	PushPendingChange({ sock, context, PENDING_MODIFY, interest });
+	return true;
+}
+
+void PollReactor::ApplyPendingChanges()
+{
+	std::vector<PendingChange> changes;
+	{
+		std::lock_guard<std::mutex> lock(_pending_mutex);
+		changes.swap(_pending);
+	}
+
+	for (const PendingChange& change : changes) {
+		if (change.op == PENDING_ADD) {
+			_fds.push_back({});
+			_fds.back().fd = change.sock;
+			_fds.back().events = POLLIN;
+			_contexts.push_back(change.context);
+			continue;
+		}
+
+		// index 0은 깨우기 소켓이므로 1부터 검색
+		for (size_t i = 1; i < _fds.size(); ++i) {
+			if (_fds[i].fd != change.sock) {
+				continue;
+			}
+
+			if (change.op == PENDING_MODIFY) {
+				_fds[i].events = 0;
+				if (change.interest & REACTOR_READ) _fds[i].events |= POLLIN;
+				if (change.interest & REACTOR_WRITE) _fds[i].events |= POLLOUT;
+				_contexts[i] = change.context;
+			}
+			else {
+				// 마지막 원소와 교체 후 제거
+				_fds[i] = _fds.back();
+				_contexts[i] = _contexts.back();
+				_fds.pop_back();
+				_contexts.pop_back();
+			}
+			break;
+		}
+	}
+}
+
+void PollReactor::DrainWakeup()
+{
+	char buffer[64];
+	while (recv(_wakeup_recv, buffer, sizeof(buffer), 0) > 0) {}
+}
+
+int PollReactor::Wait(ReactorEvent* events, int maxEvents, int timeoutMs)
+{
+	ApplyPendingChanges();
+
+#ifdef _WIN32
+	int count = WSAPoll(_fds.data(), static_cast<ULONG>(_fds.size()), timeoutMs);
+#else
+	int count = poll(_fds.data(), _fds.size(), timeoutMs);
+#endif
+	if (count == SOCKET_ERROR) {
+		return WSAGetLastError() == WSAEINTR ? 0 : -1;
+	}
+
+	int filled = 0;
+	for (size_t i = 0; i < _fds.size() && count > 0; ++i) {
+		short revents = _fds[i].revents;
+		if (revents == 0) continue;
+		--count;
+
+		if (i == 0) {
+			DrainWakeup();
+			continue;
+		}
+		if (filled >= maxEvents) {
+			// 남은 이벤트는 레벨 트리거이므로 다음 Wait()에서 다시 보고된다
+			break;
+		}
+
+		uint32_t flags = 0;
+		if (revents & (POLLIN | POLLRDNORM)) flags |= REACTOR_READ;
+		if (revents & (POLLOUT | POLLWRNORM)) flags |= REACTOR_WRITE;
+		if (revents & (POLLERR | POLLHUP | POLLNVAL)) flags |= REACTOR_ERROR;
+
+		events[filled].context = _contexts[i];
+		events[filled].events = flags;
+		++filled;
+	}
+	return filled;
+}
+
+void PollReactor::Wakeup()
+{
+	char signal = 1;
+	send(_wakeup_send, &signal, 1, 0);
+}
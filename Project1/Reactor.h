@@ -0,0 +1,126 @@
+﻿#pragma once
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <cstdint>
+#include "Packet.h"
+
+#ifndef _WIN32
+#include <poll.h>
+#endif
+
+#ifdef __linux__
+#define REACTOR_USE_EPOLL 1
+#endif
+
+// Reactor 이벤트 플래그
+enum ReactorEventFlag : uint32_t {
+    REACTOR_READ = 1 << 0,   // 읽기 가능
+    REACTOR_WRITE = 1 << 1,  // 쓰기 가능
+    REACTOR_ERROR = 1 << 2   // 에러 또는 연결 종료 (HUP)
+};
+
+// Wait()가 돌려주는 준비 완료 이벤트
+struct ReactorEvent {
+    void* context;    // Add() 시 등록한 사용자 포인터
+    uint32_t events;  // ReactorEventFlag 조합
+};
+
+// 소켓 준비 상태 통지를 추상화한 인터페이스
+// - 소켓은 연결 시 한 번만 등록하고, 준비된 소켓만 Wait()에서 반환된다.
+// - 엣지 트리거 의미를 기준으로 하므로 호출자는 읽기 이벤트를 받으면 WOULDBLOCK이 날 때까지 읽어야 한다.
+//   (레벨 트리거 구현에서도 끝까지 읽는 것은 문제가 되지 않는다)
+// - Add/Remove/Wakeup은 다른 스레드에서 호출해도 되지만 Wait()는 소유 스레드 하나만 호출한다.
+class Reactor
+{
+public:
+    virtual ~Reactor() = default;
+
+    // 등록 시 관심 이벤트는 REACTOR_READ
+    virtual bool Add(SOCKET sock, void* context) = 0;
+    virtual void Remove(SOCKET sock) = 0;
+
+    // 관심 이벤트 변경 (송신 버퍼가 남아 있을 때만 REACTOR_WRITE를 켠다)
+    virtual bool Modify(SOCKET sock, void* context, uint32_t interest) = 0;
+
+    // 준비된 이벤트를 최대 maxEvents개까지 채우고 개수를 반환 (타임아웃/깨우기 시 0, 에러 시 -1)
+    virtual int Wait(ReactorEvent* events, int maxEvents, int timeoutMs) = 0;
+
+    // Wait() 중인 스레드를 즉시 깨움
+    virtual void Wakeup() = 0;
+
+    virtual const char* GetName() const = 0;
+
+    // 플랫폼에 맞는 기본 구현 생성 (Linux: epoll, 그 외: WSAPoll/poll)
+    static std::unique_ptr<Reactor> Create();
+};
+
+#ifdef REACTOR_USE_EPOLL
+
+// Linux 엣지 트리거 epoll 구현
+class EpollReactor : public Reactor
+{
+private:
+    int _epoll_fd;
+    int _wakeup_fd;  // eventfd
+
+public:
+    EpollReactor();
+    ~EpollReactor() override;
+
+    bool Add(SOCKET sock, void* context) override;
+    void Remove(SOCKET sock) override;
+    bool Modify(SOCKET sock, void* context, uint32_t interest) override;
+    int Wait(ReactorEvent* events, int maxEvents, int timeoutMs) override;
+    void Wakeup() override;
+    const char* GetName() const override { return "epoll"; }
+};
+
+#endif
+
+// poll 기반 범용 구현 (Windows WSAPoll / POSIX poll)
+// select()와 달리 FD_SETSIZE 제한이 없고 등록 목록을 매번 다시 만들지 않는다.
+class PollReactor : public Reactor
+{
+private:
+    enum PendingOp {
+        PENDING_ADD,
+        PENDING_REMOVE,
+        PENDING_MODIFY
+    };
+
+    struct PendingChange {
+        SOCKET sock;
+        void* context;
+        PendingOp op;
+        uint32_t interest;
+    };
+
+#ifdef _WIN32
+    std::vector<WSAPOLLFD> _fds;
+#else
+    std::vector<struct pollfd> _fds;
+#endif
+    std::vector<void*> _contexts;  // _fds와 같은 인덱스
+
+    std::mutex _pending_mutex;
+    std::vector<PendingChange> _pending;  // 다른 스레드의 Add/Remove는 Wait() 시작 시 반영
+
+    SOCKET _wakeup_recv;  // 깨우기용 루프백 UDP 소켓 (index 0에 등록)
+    SOCKET _wakeup_send;
+
+    void PushPendingChange(const PendingChange& change);
+    void ApplyPendingChanges();
+    void DrainWakeup();
+
+public:
+    PollReactor();
+    ~PollReactor() override;
+
+    bool Add(SOCKET sock, void* context) override;
+    void Remove(SOCKET sock) override;
+    bool Modify(SOCKET sock, void* context, uint32_t interest) override;
+    int Wait(ReactorEvent* events, int maxEvents, int timeoutMs) override;
+    void Wakeup() override;
+    const char* GetName() const override { return "poll"; }
+};
@@ -0,0 +1,86 @@
+﻿#include "RowReader.h"
+#include <charconv>
+
+uint64_t RowReader::ParseUInt(std::string_view text)
+{
+	uint64_t value = 0;
+	const char* end = text.data() + text.size();
+	std::from_chars_result result = std::from_chars(text.data(), end, value);
+	if (result.ec != std::errc()) {
+		// 음수이거나 숫자로 시작하지 않는 값
+		return 0;
+	}
+	return value;
+}
+
+float RowReader::ParseFloat(std::string_view text)
+{
+	float value = 0.0f;
+	const char* end = text.data() + text.size();
+	std::from_chars_result result = std::from_chars(text.data(), end, value);
+	if (result.ec != std::errc()) {
+		return 0.0f;
+	}
+	return value;
+}
+
+ResultRowReader::ResultRowReader(MYSQL_RES* result, MYSQL* conn)
+	: _result(result), _row(nullptr), _lengths(nullptr), _column_count(0), _conn(conn), _fetch_error(false)
+{
+	if (_result) {
+		_column_count = mysql_num_fields(_result);
+	}
+}
+
+ResultRowReader::~ResultRowReader()
+{
+	FreeResult();
+}
+
+bool ResultRowReader::Fetch()
+{
+	if (!_result) {
+		return false;
+	}
+
+	_row = mysql_fetch_row(_result);
+	_lengths = _row ? mysql_fetch_lengths(_result) : nullptr;
+	if (!_row && _conn) {
+		// 스트리밍 결과는 행을 읽는 도중에도 서버와 통신하므로 끝과 실패를 구분해야 한다
+		_fetch_error = mysql_errno(_conn) != 0;
+	}
+	return _row != nullptr && _lengths != nullptr;
+}
+
+bool ResultRowReader::IsNull(unsigned int column) const
+{
+	return !_row || column >= _column_count || _row[column] == nullptr;
+}
+
+uint64_t ResultRowReader::GetUInt64(unsigned int column) const
+{
+	return IsNull(column) ? 0 : ParseUInt(GetString(column));
+}
+
+float ResultRowReader::GetFloat(unsigned int column) const
+{
+	return IsNull(column) ? 0.0f : ParseFloat(GetString(column));
+}
+
+std::string_view ResultRowReader::GetString(unsigned int column) const
+{
+	if (IsNull(column)) {
+		return std::string_view();
+	}
+	return std::string_view(_row[column], _lengths[column]);
+}
+
+void ResultRowReader::FreeResult()
+{
+	if (_result) {
+		mysql_free_result(_result);
+		_result = nullptr;
+	}
+	_row = nullptr;
+	_lengths = nullptr;
+}
@@ -0,0 +1,66 @@
+﻿#pragma once
+#include <string_view>
+#include <cstdint>
+#include <mysql.h>
+
+// 결과 집합을 한 행씩 읽는 공통 인터페이스 (응답 패킷 생성 함수는 결과가 어디서 왔는지 모른다)
+// - 텍스트 프로토콜 결과(MYSQL_RES)는 ResultRowReader, 준비된 문장 결과는 PreparedStatement가 구현한다.
+// - 숫자는 예외를 던지지 않는 from_chars로 읽고, 형식이 잘못되었거나 NULL이면 0을 돌려준다.
+// - 문자열은 복사하지 않고 결과 버퍼를 가리키는 string_view로 넘기므로 FlatBufferBuilder::CreateString에
+//   바로 넘긴다. 다음 Fetch(또는 FreeResult) 전까지만 유효하다.
+// - 결과를 미리 받아 두지 않고 스트리밍으로 읽는 경우 Fetch가 false인 것만으로는 끝인지 실패인지 모르므로
+//   다 읽은 뒤 HasFetchError로 확인한다.
+class RowReader
+{
+public:
+    virtual ~RowReader() = default;
+
+    // 다음 행으로 이동 (행이 없거나 실패하면 false)
+    virtual bool Fetch() = 0;
+    virtual unsigned int GetColumnCount() const = 0;
+    virtual bool IsNull(unsigned int column) const = 0;
+    virtual uint64_t GetUInt64(unsigned int column) const = 0;
+    virtual float GetFloat(unsigned int column) const = 0;
+    virtual std::string_view GetString(unsigned int column) const = 0;
+    // 남은 행을 버리고 결과를 해제 (다 읽은 뒤 바로 호출해 메모리를 돌려준다)
+    virtual void FreeResult() = 0;
+    // 마지막 Fetch가 행이 끝나서가 아니라 에러로 멈췄는지 (스트리밍 중 연결이 끊긴 경우 등)
+    virtual bool HasFetchError() const = 0;
+
+    uint32_t GetUInt(unsigned int column) const { return static_cast<uint32_t>(GetUInt64(column)); }
+
+    // 텍스트 값 변환 (실패하면 0)
+    static uint64_t ParseUInt(std::string_view text);
+    static float ParseFloat(std::string_view text);
+};
+
+// MYSQL_ROW + mysql_fetch_lengths 위에서 읽는 RowReader (결과를 소유하고 소멸할 때 해제)
+// - mysql_use_result로 받은 결과면 conn을 같이 넘겨야 중간 실패를 HasFetchError로 알 수 있다.
+class ResultRowReader : public RowReader
+{
+private:
+    MYSQL_RES* _result;
+    MYSQL_ROW _row;
+    unsigned long* _lengths;
+    unsigned int _column_count;
+    MYSQL* _conn;
+    bool _fetch_error;
+
+public:
+    explicit ResultRowReader(MYSQL_RES* result, MYSQL* conn = nullptr);
+    ~ResultRowReader() override;
+
+    ResultRowReader(const ResultRowReader&) = delete;
+    ResultRowReader& operator=(const ResultRowReader&) = delete;
+
+    bool IsValid() const { return _result != nullptr; }
+
+    bool Fetch() override;
+    unsigned int GetColumnCount() const override { return _column_count; }
+    bool IsNull(unsigned int column) const override;
+    uint64_t GetUInt64(unsigned int column) const override;
+    float GetFloat(unsigned int column) const override;
+    std::string_view GetString(unsigned int column) const override;
+    void FreeResult() override;
+    bool HasFetchError() const override { return _fetch_error; }
+};
@@ -5,13 +5,57 @@
 #include <thread>
 #include <iostream>
 #include <chrono>
-#include "DatabaseThread.h"
+#include <cstring>
+#include <stdexcept>
+#include "DatabasePool.h"
+#include "ConnectionSlab.h"
+#include "ConcurrencyLimiter.h"
+#include "BufferPool.h"
+#include "IoUring.h"
+#include "Reactor.h"
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+// 연결마다 디스크립터를 하나씩 쓰므로 프로세스 한도가 max_connections보다 낮으면 가능한 만큼 올린다
+// (리슨/여유 소켓, DB 연결, reactor, 로그 파일 등에 쓸 여유분을 더해 계산)
+static void EnsureDescriptorLimit(unsigned int maxConnections)
+{
+#ifndef _WIN32
+    const rlim_t reserve = 256;
+    rlim_t needed = static_cast<rlim_t>(maxConnections) + reserve;
+
+    struct rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) != 0 || limit.rlim_cur == RLIM_INFINITY || limit.rlim_cur >= needed) {
+        return;
+    }
+
+    rlim_t target = (limit.rlim_max == RLIM_INFINITY || limit.rlim_max >= needed) ? needed : limit.rlim_max;
+    if (target > limit.rlim_cur) {
+        struct rlimit raised = limit;
+        raised.rlim_cur = target;
+        if (setrlimit(RLIMIT_NOFILE, &raised) == 0) {
+            printf("Raised file descriptor limit: %llu -> %llu\n",
+                static_cast<unsigned long long>(limit.rlim_cur), static_cast<unsigned long long>(target));
+            limit.rlim_cur = target;
+        }
+    }
+
+    if (limit.rlim_cur < needed) {
+        printf("File descriptor limit %llu is below max connections %u (+%llu reserve), "
+            "connections beyond the limit will be accepted and closed\n",
+            static_cast<unsigned long long>(limit.rlim_cur), maxConnections, static_cast<unsigned long long>(reserve));
+    }
+#else
+    (void)maxConnections;
+#endif
+}
 
 std::unique_ptr<Server> Server::instance = nullptr;
 std::mutex Server::instance_mutex;
 
 Server::Server()
-    : _wsa_data(WSAData()), _server_sock(INVALID_SOCKET), _is_running(false)
+    : _is_running(false)
 {
 }
 
@@ -28,72 +72,170 @@ Server::~Server()
 {
     Stop();
 
-    DisconnectAllUsers();
-    
-    //  ó   
-    if (_response_handler_thread && _response_handler_thread->joinable()) {
-        _response_handler_thread->join();
+    if (_stats_thread && _stats_thread->joinable()) {
+        _stats_thread->join();
     }
 
-    // ͺ̽   
-    if (_database_thread) {
-        _database_thread->Stop();
+    std::lock_guard<std::mutex> lock(_worker_threads_mutex);
+    // 서로의 작업 덱을 참조하므로 모든 스레드를 먼저 멈춘 뒤 해제
+    // (워커가 넘기지 못한 연결 해제를 DB 풀에 넘기고 끝나도록 DB 풀보다 먼저 멈춘다)
+    for (auto& worker : _worker_threads) {
+        worker->Join();
     }
 
-    if (_thread_cleaner && _thread_cleaner->joinable()) {
-        _thread_cleaner->join();
+    // DB 실행기 종료 대기 후 남은 세션 정리 (이후로는 WorkerThread로 응답이 오지 않음)
+    if (_db_pool) {
+        std::cout << "[Server] 모든 사용자 연결 해제 처리 중..." << std::endl;
+        _db_pool->Stop();
+        _db_pool.reset();
     }
-
-    std::lock_guard<std::mutex> lock(_worker_threads_mutex);
-    _worker_threads.clear();  // unique_ptr̹Ƿ ڵ delete
-
-    //   ݱ
-    if (_server_sock != INVALID_SOCKET) {
-        closesocket(_server_sock);
+    _worker_threads.clear();  // unique_ptr이므로 자동으로 delete됨
+
+    BufferPoolStats poolStats = BufferPool::Instance().GetStats();
+    printf("[Server] 버퍼 풀 - 재사용: %llu, 새 블록: %llu, 풀 미사용(대형): %llu, 아레나: %llu KB%s\n",
+        static_cast<unsigned long long>(poolStats.hits), static_cast<unsigned long long>(poolStats.misses),
+        static_cast<unsigned long long>(poolStats.oversize), static_cast<unsigned long long>(poolStats.arena_bytes / 1024),
+        poolStats.huge_pages ? " (huge page)" : "");
+
+    // 리슨 소켓 닫기 (acceptor가 모두 끝났으므로 여유 디스크립터도 함께 닫는다)
+    CloseListenSockets();
+    for (SOCKET spareSock : _spare_socks) {
+        if (spareSock != INVALID_SOCKET) {
+            closesocket(spareSock);
+        }
     }
+    _spare_socks.clear();
     WSACleanup();
 }
 
 void Server::SetNonBlocking(SOCKET sock)
 {
-    u_long mode = 1;  // 1 for non-blocking, 0 for blocking
-    int result = ioctlsocket(sock, FIONBIO, &mode);
+    int result = SetSocketNonBlocking(sock);
     if (result != 0) {
-        std::cerr << "[Server] Non-blocking  : " << WSAGetLastError() << std::endl;
+        std::cerr << "[Server] Non-blocking 설정 실패: " << WSAGetLastError() << std::endl;
     }
 
-    // ߰  ɼ 
+    // 추가 소켓 옵션 설정
     int keepAlive = 1;
     setsockopt(sock, SOL_SOCKET, SO_KEEPALIVE, (char*)&keepAlive, sizeof(keepAlive));
 
-    // TCP_NODELAY   ּȭ
+    // TCP_NODELAY 설정으로 지연 최소화
     int noDelay = 1;
     setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, (char*)&noDelay, sizeof(noDelay));
 
-    // /۽  ũ 
+    // 수신/송신 버퍼 크기 증가
     int bufferSize = 65536;
     setsockopt(sock, SOL_SOCKET, SO_RCVBUF, (char*)&bufferSize, sizeof(bufferSize));
     setsockopt(sock, SOL_SOCKET, SO_SNDBUF, (char*)&bufferSize, sizeof(bufferSize));
 }
 
-void Server::Initialize(const char* ip, int port)
+void Server::Initialize(const char* ip, int port, const ServerConfig& config)
 {
+    _config = config;
+    BufferPool::Instance().EnableHugePages(_config.huge_pages);
+
+#ifdef _WIN32
     int result = WSAStartup(MAKEWORD(2, 2), &_wsa_data);
     if (result != 0) {
         printf("Failed WSAStartup: %d\n", result);
         throw std::runtime_error("WSAStartup failed");
     }
+#endif
 
-    _server_sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
-    if (_server_sock == INVALID_SOCKET) {
-        printf("Failed to create server socket: %d\n", WSAGetLastError());
+    EnsureDescriptorLimit(_config.max_connections);
+
+    // 리슨 소켓 생성 (SO_REUSEPORT 모드면 acceptor 수만큼)
+    unsigned int listenerCount = _config.acceptor_count > 0 ? _config.acceptor_count : 1;
+#ifndef SO_REUSEPORT
+    if (listenerCount > 1) {
+        printf("SO_REUSEPORT is not supported on this platform, using a single listener\n");
+        listenerCount = 1;
+    }
+#endif
+    for (unsigned int i = 0; i < listenerCount; ++i) {
+        SOCKET listenSock = CreateListenSocket(ip, port, listenerCount > 1);
+        if (listenSock == INVALID_SOCKET) {
+            CloseListenSockets();
+            WSACleanup();
+            throw std::runtime_error("Listen socket setup failed");
+        }
+        _listen_socks.push_back(listenSock);
+        _accept_reactors.push_back(Reactor::Create());
+        _spare_socks.push_back(socket(AF_INET, SOCK_STREAM, 0));
+    }
+
+    // 연결 슬랩 할당 (DB 스레드의 응답 전달과 WorkerThread가 모두 참조하므로 먼저 만든다)
+    _connections = std::make_unique<ConnectionSlab>(_config.max_connections);
+
+    _db_limiter = std::make_unique<ConcurrencyLimiter>(std::chrono::milliseconds(_config.db_latency_target_ms));
+
+    // DB 실행기 풀 (실행기마다 요청 큐가 있고, 가득 차면 WorkerThread가 새 요청에 바로 실패 응답을 보냄)
+    _db_pool = std::make_unique<DatabasePool>(_config.db_executor_count, _config.task_queue_capacity,
+        [this](DBResponse&& response) { ProcessDBResponse(std::move(response)); },
+        [this](const TaskCompletion& completion) { OnTaskCompleted(completion); });
+    if (!_db_pool->Start())
+    {
+        printf("Failed to Connect Database Server\n");
+        CloseListenSockets();
         WSACleanup();
-        throw std::runtime_error("Socket creation failed");
+        throw std::runtime_error("Database connection failed");
+    }
+
+    _is_running.store(true);
+
+    // WorkerThread 풀 생성 (실행 중에는 개수가 바뀌지 않음)
+    unsigned int workerCount = _config.worker_count;
+    if (workerCount == 0) {
+        workerCount = std::thread::hardware_concurrency();
+        if (workerCount == 0) {
+            workerCount = 1;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(_worker_threads_mutex);
+        for (unsigned int i = 0; i < workerCount; ++i) {
+            _worker_threads.push_back(std::make_unique<WorkerThread>(_db_pool.get(), _connections.get(), _db_limiter.get(), _config));
+        }
+
+        // 한가한 워커가 바쁜 워커의 작업을 가져갈 수 있도록 서로 연결
+        std::vector<WorkerThread*> peers;
+        for (auto& worker : _worker_threads) {
+            peers.push_back(worker.get());
+        }
+        for (auto& worker : _worker_threads) {
+            worker->SetPeers(peers);
+            worker->Start();
+        }
+    }
+    printf("WorkerThread pool created: %u threads\n", workerCount);
+
+    if (_config.stats_interval_sec > 0) {
+        _stats_thread = std::make_unique<std::thread>(&Server::RunStatsReporter, this);
+    }
+
+    printf("Server initialized successfully on %s:%d (listeners: %zu)\n", ip, port, _listen_socks.size());
+}
+
+SOCKET Server::CreateListenSocket(const char* ip, int port, bool reusePort)
+{
+    SOCKET listenSock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (listenSock == INVALID_SOCKET) {
+        printf("Failed to create server socket: %d\n", WSAGetLastError());
+        return INVALID_SOCKET;
     }
 
-    // SO_REUSEADDR 
+    // SO_REUSEADDR 설정
     int opt = 1;
-    setsockopt(_server_sock, SOL_SOCKET, SO_REUSEADDR, (char*)&opt, sizeof(opt));
+    setsockopt(listenSock, SOL_SOCKET, SO_REUSEADDR, (char*)&opt, sizeof(opt));
+
+#ifdef SO_REUSEPORT
+    // 같은 포트에 리스너를 여러 개 열면 커널이 새 연결을 리스너별로 나눠준다
+    if (reusePort) {
+        setsockopt(listenSock, SOL_SOCKET, SO_REUSEPORT, (char*)&opt, sizeof(opt));
+    }
+#else
+    (void)reusePort;
+#endif
 
     sockaddr_in serverSockAddr;
     memset(&serverSockAddr, 0, sizeof(serverSockAddr));
@@ -101,40 +243,34 @@ void Server::Initialize(const char* ip, int port)
     serverSockAddr.sin_family = AF_INET;
     serverSockAddr.sin_port = htons(port);
 
-    result = bind(_server_sock, (sockaddr*)&serverSockAddr, sizeof(serverSockAddr));
+    int result = bind(listenSock, (sockaddr*)&serverSockAddr, sizeof(serverSockAddr));
     if (result == SOCKET_ERROR) {
         printf("Failed to bind server socket: %d\n", WSAGetLastError());
-        closesocket(_server_sock);
-        WSACleanup();
-        throw std::runtime_error("Socket bind failed");
+        closesocket(listenSock);
+        return INVALID_SOCKET;
     }
 
-    result = listen(_server_sock, SOMAXCONN);
+    result = listen(listenSock, SOMAXCONN);
     if (result == SOCKET_ERROR) {
         printf("Failed to listen on server socket: %d\n", WSAGetLastError());
-        closesocket(_server_sock);
-        WSACleanup();
-        throw std::runtime_error("Socket listen failed");
-    }
-
-    _database_thread = std::make_unique<DatabaseThread>(&RecvPakets, &SendPackets);
-    if (!_database_thread->ConnectDB())
-    {
-        printf("Failed to Connect Database Server\n");
-        closesocket(_server_sock);
-        WSACleanup();
-        throw std::runtime_error("Database connection failed");
+        closesocket(listenSock);
+        return INVALID_SOCKET;
     }
 
-    //  ó  
-    _response_handler_thread = std::make_unique<std::thread>(&Server::ResponseHandlerLoop, this);
+    // Non-blocking 모드로 설정 (준비 통지 후 WOULDBLOCK이 날 때까지 accept)
+    SetNonBlocking(listenSock);
+    return listenSock;
+}
 
-    
-    // Non-blocking  
-    SetNonBlocking(_server_sock);
-  
-    _is_running.store(true);
-    printf("Server initialized successfully on %s:%d\n", ip, port);
+void Server::CloseListenSockets()
+{
+    std::lock_guard<std::mutex> lock(_listen_socks_mutex);
+    for (SOCKET& listenSock : _listen_socks) {
+        if (listenSock != INVALID_SOCKET) {
+            closesocket(listenSock);
+            listenSock = INVALID_SOCKET;
+        }
+    }
 }
 
 void Server::Run()
@@ -144,76 +280,222 @@ void Server::Run()
         return;
     }
 
-    _thread_cleaner = std::make_unique<std::thread>(&Server::Thread_ClearDeadWorkerLoop, this);
-
     printf("Server is running...\n");
 
+    // 리스너마다 전용 acceptor 스레드 (첫 번째는 호출 스레드가 담당)
+    for (size_t i = 1; i < _listen_socks.size(); ++i) {
+        _acceptor_threads.push_back(std::make_unique<std::thread>(&Server::RunAcceptor, this, i));
+    }
+    RunAcceptor(0);
+
+    for (auto& acceptor : _acceptor_threads) {
+        if (acceptor && acceptor->joinable()) {
+            acceptor->join();
+        }
+    }
+    _acceptor_threads.clear();
+
+    printf("Server main loop finished\n");
+}
+
+void Server::RunAcceptor(size_t index)
+{
+    SOCKET listenSock = _listen_socks[index];
+
+#ifdef USE_IO_URING
+    if (_config.io_backend == IoBackend::IO_URING && RunUringAcceptLoop(index)) {
+        return;
+    }
+#endif
+
+    // 리슨 소켓도 Reactor로 감시해서 연결이 들어올 때만 깨어남 (바쁜 대기 없음)
+    Reactor* reactor = _accept_reactors[index].get();
+    if (!reactor->Add(listenSock, &_listen_socks[index])) {
+        printf("Failed to register listen socket %zu\n", index);
+        return;
+    }
+
+    // 엣지 트리거라 에러로 백로그를 다 비우지 못하면 새 연결이 올 때까지 통지가 없으므로 대기 타임아웃마다 다시 시도
+    ReactorEvent events[4];
+    bool retryAccept = false;
+    while (_is_running.load()) {
+        int count = reactor->Wait(events, 4, 100);
+        if (count < 0) {
+            printf("Accept wait error: %d\n", WSAGetLastError());
+            continue;
+        }
+        if (count > 0 || retryAccept) {
+            retryAccept = !AcceptPending(index);
+        }
+    }
+}
+
+bool Server::AcceptPending(size_t index)
+{
+    SOCKET listenSock = _listen_socks[index];
+    uint64_t dropped = 0;
+    bool drained = false;
+
+    // 엣지 트리거: 쌓인 연결을 WOULDBLOCK이 날 때까지 모두 받는다
     while (_is_running.load()) {
         sockaddr_in clientSockAddr;
-        int clientSockAddrSize = sizeof(clientSockAddr);
+        socklen_t clientSockAddrSize = sizeof(clientSockAddr);
         memset(&clientSockAddr, 0, sizeof(clientSockAddr));
 
-        SOCKET clientSock = accept(_server_sock, (sockaddr*)&clientSockAddr, &clientSockAddrSize);
+        SOCKET clientSock = accept(listenSock, (sockaddr*)&clientSockAddr, &clientSockAddrSize);
 
         if (clientSock == INVALID_SOCKET) {
             int error = WSAGetLastError();
-            if (error == WSAEWOULDBLOCK) {
-                // Non-blocking 忡   
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
-                continue;
-            }
-            else if (!_is_running.load()) {
-                //   
+            if (error == WSAEWOULDBLOCK || !_is_running.load()) {
+                drained = true;
                 break;
             }
-            else {
-                printf("Accept error: %d\n", error);
-                std::this_thread::sleep_for(std::chrono::milliseconds(10));
-                continue;
+            if (error == WSAEINTR || error == WSAECONNABORTED) {
+                continue; // 대기 중에 클라이언트가 끊은 연결은 건너뜀
             }
+            // 디스크립터 한도: 받지 못한 연결이 백로그에 남아 통지 없이 계속 기다리므로 받아서 바로 끊는다
+            if (IsDescriptorLimitError(error)) {
+                if (DropPendingConnection(index, dropped)) {
+                    continue;
+                }
+                printf("File descriptor limit reached, no spare descriptor to drop pending connections\n");
+                break;
+            }
+            printf("Accept error: %d\n", error);
+            break;
         }
 
-        // Ŭ̾Ʈ ϵ non-blocking 
-        SetNonBlocking(clientSock);
+        DispatchClient(clientSock);
+    }
 
-        std::lock_guard<std::mutex> lock(_worker_threads_mutex);
-        int canUseThreadIdx = FindCanUseWorkerThread();
+    if (dropped > 0) {
+        printf("File descriptor limit reached, closed %llu pending connections\n", static_cast<unsigned long long>(dropped));
+    }
+    return drained || !_is_running.load();
+}
 
-        if (canUseThreadIdx == -1) {
-            //  WorkerThread 
-            try {
-                _worker_threads.push_back(std::make_unique<WorkerThread>(clientSock,&RecvPakets));
-                printf("New WorkerThread created. Total threads: %zu\n", _worker_threads.size());
-            }
-            catch (const std::exception& e) {
-                printf("Failed to create WorkerThread: %s\n", e.what());
-                closesocket(clientSock);
+bool Server::DropPendingConnection(size_t index, uint64_t& dropped)
+{
+    SOCKET& spareSock = _spare_socks[index];
+    if (spareSock == INVALID_SOCKET) {
+        // 이전에 다시 잡지 못했음 - 그 사이 디스크립터가 풀렸으면 지금 잡고 다음 accept에서 쓴다
+        spareSock = socket(AF_INET, SOCK_STREAM, 0);
+        return false;
+    }
+
+    // 대기 연결이 그 사이 끊겼거나 백로그가 비었으면 accept가 실패하지만, 이어지는 accept가 WOULDBLOCK으로 끝내 준다
+    closesocket(spareSock);
+    SOCKET clientSock = accept(_listen_socks[index], nullptr, nullptr);
+    if (clientSock != INVALID_SOCKET) {
+        closesocket(clientSock);
+        ++dropped;
+    }
+    spareSock = socket(AF_INET, SOCK_STREAM, 0);
+    return true;
+}
+
+void Server::DispatchClient(SOCKET clientSock)
+{
+    // 클라이언트 소켓도 non-blocking으로 설정
+    SetNonBlocking(clientSock);
+
+    std::lock_guard<std::mutex> lock(_worker_threads_mutex);
+    int workerIdx = FindLeastLoadedWorkerThread();
+
+    if (workerIdx == -1) {
+        printf("No WorkerThread available\n");
+        closesocket(clientSock);
+        return;
+    }
+
+    if (!_worker_threads[workerIdx]->AddClient(clientSock)) {
+        printf("Connection limit reached (%u)\n", _connections->GetCapacity());
+        closesocket(clientSock);
+        return;
+    }
+    printf("Client added to thread %d\n", workerIdx);
+}
+
+#ifdef USE_IO_URING
+bool Server::RunUringAcceptLoop(size_t index)
+{
+    SOCKET listenSock = _listen_socks[index];
+    IoUring uring;
+    if (!uring.Initialize(64, 0, 0) || !uring.ArmAccept(listenSock, nullptr)) {
+        std::cerr << "[Server] io_uring accept 초기화 실패, 폴링 accept로 대체" << std::endl;
+        return false;
+    }
+
+    std::cout << "[Server] io_uring multishot accept 사용" << std::endl;
+
+    IoCompletion completions[64];
+    bool armed = true;
+    bool retryAccept = false;  // 디스크립터 한도로 백로그를 다 비우지 못해 accept를 다시 걸지 않은 상태
+    while (_is_running.load()) {
+        int count = uring.Wait(completions, 64, 100);
+        if (count < 0) {
+            std::cerr << "[Server] io_uring 대기 에러: " << errno << std::endl;
+            continue;
+        }
+
+        // 대기 타임아웃마다 백로그를 다시 비워 보고, 다 비웠으면 multishot accept를 다시 건다
+        if (retryAccept) {
+            retryAccept = !AcceptPending(index);
+            if (!retryAccept && !armed) {
+                armed = uring.ArmAccept(listenSock, nullptr);
             }
         }
-        else {
-            //  WorkerThread Ŭ̾Ʈ ߰
-            _worker_threads[canUseThreadIdx]->AddClient(clientSock);
-            printf("Client added to existing thread %d\n", canUseThreadIdx);
+
+        for (int i = 0; i < count; ++i) {
+            const IoCompletion& completion = completions[i];
+            if (completion.op != IOURING_OP_ACCEPT) {
+                continue;
+            }
+
+            if (completion.result >= 0) {
+                DispatchClient(static_cast<SOCKET>(completion.result));
+            }
+            else if (IsDescriptorLimitError(-completion.result)) {
+                // 바로 다시 걸면 같은 에러가 반복되므로 백로그를 직접 비운 뒤에 다시 건다 (리슨 소켓은 non-blocking)
+                retryAccept = !AcceptPending(index);
+            }
+            else if (_is_running.load()) {
+                printf("Accept error: %d\n", -completion.result);
+            }
+
+            // multishot이 끝났으면 다시 건다 (서버 종료로 소켓이 닫힌 경우 제외)
+            if (!completion.more) {
+                armed = false;
+                if (_is_running.load() && !retryAccept) {
+                    armed = uring.ArmAccept(listenSock, nullptr);
+                }
+            }
         }
     }
-
-    printf("Server main loop finished\n");
+    return true;
 }
+#endif
 
 void Server::Stop()
 {
     printf("Stopping server...\n");
     _is_running.store(false);
+
+    // 통계 출력 스레드 깨우기
+    {
+        std::lock_guard<std::mutex> lock(_stats_mutex);
+    }
+    _stats_cv.notify_all();
     
-    DisconnectAllUsers();
-    
-    //   ݱ (accept ŷ )
-    if (_server_sock != INVALID_SOCKET) {
-        closesocket(_server_sock);
-        _server_sock = INVALID_SOCKET;
+    // 대기 중인 acceptor를 깨우고 리슨 소켓 닫기
+    for (auto& reactor : _accept_reactors) {
+        if (reactor) {
+            reactor->Wakeup();
+        }
     }
+    CloseListenSockets();
 
-    //  WorkerThread 
+    // 모든 WorkerThread 종료
     std::lock_guard<std::mutex> lock(_worker_threads_mutex);
     for (auto& worker : _worker_threads) {
         if (worker) {
@@ -231,98 +513,144 @@ void Server::Destroy()
     }
 }
 
-int Server::FindCanUseWorkerThread()
+int Server::FindLeastLoadedWorkerThread()
 {
-    // _worker_threads_mutex ̹ ִٰ 
-    if (_worker_threads.empty()) {
-        return -1;
-    }
+    // _worker_threads_mutex가 이미 잠겨있다고 가정
+    int bestIdx = -1;
+    double bestScore = 0.0;
 
     for (size_t i = 0; i < _worker_threads.size(); ++i) {
-        if (_worker_threads[i] &&
-            !_worker_threads[i]->IsFullAccess() &&
-            _worker_threads[i]->DoThread()) {
-            return static_cast<int>(i);
+        if (!_worker_threads[i] || !_worker_threads[i]->DoThread()) {
+            continue;
+        }
+
+        double score = _worker_threads[i]->GetLoadScore();
+        if (bestIdx == -1 || score < bestScore) {
+            bestIdx = static_cast<int>(i);
+            bestScore = score;
         }
     }
-    return -1;
+    return bestIdx;
 }
 
-void Server::ClearDeadThreads()
+void Server::ProcessDBResponse(DBResponse&& response)
 {
-    std::lock_guard<std::mutex> lock(_worker_threads_mutex);
+    if (response.response_data.empty()) {
+        std::cerr << "[Server] 빈 응답 데이터" << std::endl;
+        return;
+    }
 
-    for (auto iter = _worker_threads.begin(); iter != _worker_threads.end();) {
-        if (*iter && !(*iter)->DoThread()) {
-            printf("Removing dead WorkerThread. Remaining: %zu\n", _worker_threads.size() - 1);
-            iter = _worker_threads.erase(iter);
-        }
-        else {
-            ++iter;
-        }
+    // 해당 연결을 가진 WorkerThread 찾기
+    WorkerThread* targetWorker = FindWorkerThreadByHandle(response.client_handle);
+    if (targetWorker) {
+        // 워커의 송신 요청 큐에 넣고 깨움 (그 사이 끊기면 워커가 핸들을 다시 확인해 버림)
+        targetWorker->SendToClient(response.client_handle, std::move(response.response_data), response.task_id);
+    }
+    else {
+        std::cerr << "[Server] 끊긴 연결로 가는 응답 폐기 - 핸들: " << response.client_handle << std::endl;
     }
 }
 
-void Server::Thread_ClearDeadWorkerLoop()
+WorkerThread* Server::FindWorkerThreadByHandle(ConnectionHandle handle)
 {
-    while (_is_running.load()) {
-        std::this_thread::sleep_for(std::chrono::seconds(2));
-        ClearDeadThreads();
-    }
-    printf("Thread cleaner finished\n");
+    // 전역 잠금 없이 슬롯 번호로 바로 찾고 세대가 다르면 nullptr
+    return _connections->FindWorker(handle);
 }
 
-void Server::ResponseHandlerLoop()
+void Server::OnTaskCompleted(const TaskCompletion& completion)
 {
-    std::cout << "[Server]  ó  " << std::endl;
+    // 큐에 넣은 시점부터 처리 완료까지의 지연으로 동시성 한도 조정
+    _db_limiter->Release(std::chrono::steady_clock::now() - completion.admitted_at);
 
-    while (_is_running.load()) {
-        DBResponse response;
-        if (SendPackets.dequeue(response)) {
-            ProcessDBResponse(response);
-        }
-        else {
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
-        }
-    }
+    // 앞선 요청이 끝나기를 기다리는 거절 응답이 나갈 수 있도록 완료 번호 기록
+    // (샤드 이동 판단보다 먼저 해야 새 샤드의 완료가 이전 샤드의 늦은 기록에 덮이지 않는다)
+    _connections->CompleteRequest(completion.client_handle, completion.task_id);
 
-    std::cout << "[Server]  ó  " << std::endl;
-}
+    // 연결이 다른 샤드로 옮겨 갈 수 있는지 판단하는 대기 수 감소
+    _connections->ReleaseDbPending(completion.client_handle, 1);
 
-void Server::ProcessDBResponse(const DBResponse& response)
-{
-    if (response.response_data.empty()) {
-        std::cerr << "[Server]   " << std::endl;
-        return;
-    }
-
-    // ش Ŭ̾Ʈ   WorkerThread ã
-    WorkerThread* targetWorker = FindWorkerThreadBySocket(response.client_socket);
+    // 한도에 걸려 수신을 멈췄던 연결이면 소유 워커가 다시 읽기 시작한다
+    WorkerThread* targetWorker = FindWorkerThreadByHandle(completion.client_handle);
     if (targetWorker) {
-        // WorkerThread   û
-        targetWorker->SendToClient(response.client_socket, response.response_data);
-    }
-    else {
-        std::cerr << "[Server] Ŭ̾Ʈ  ã  : " << response.client_socket << std::endl;
+        targetWorker->ReleaseInFlight(completion.client_handle);
     }
 }
 
-WorkerThread* Server::FindWorkerThreadBySocket(SOCKET clientSocket)
+ServerStats Server::GetStats()
 {
-    std::lock_guard<std::mutex> lock(_worker_threads_mutex);
+    ServerStats stats;
+    stats.task_queue_depth = _db_pool ? _db_pool->GetQueueDepth() : 0;
+    stats.task_queue_capacity = _db_pool ? _db_pool->GetQueueCapacity() : 0;
+    stats.db_executors = _db_pool ? static_cast<uint32_t>(_db_pool->GetExecutorCount()) : 0;
+    stats.db_connected = _db_pool ? static_cast<uint32_t>(_db_pool->GetConnectedCount()) : 0;
+    stats.db_reconnects = _db_pool ? _db_pool->GetReconnects() : 0;
+    if (_db_pool) {
+        stats.db_queue_depths = _db_pool->GetQueueDepths();
+    }
+    stats.rejected_requests = 0;
+    stats.read_pauses = 0;
+    stats.rate_limited_frames = 0;
+    stats.rate_limited_requests = 0;
+    stats.rate_limit_disconnects = 0;
+    stats.idle_timeouts = 0;
+    stats.frame_timeouts = 0;
+    stats.send_timeouts = 0;
+    stats.connections = _connections ? _connections->GetUsed() : 0;
+
+    ConcurrencyLimiterStats limiterStats = _db_limiter ? _db_limiter->GetStats() : ConcurrencyLimiterStats();
+    stats.db_limit = limiterStats.limit;
+    stats.db_in_flight = limiterStats.in_flight;
+    stats.db_latency_ms = limiterStats.latency_ms;
+    for (int i = 0; i < TASK_PRIORITY_COUNT; ++i) {
+        stats.db_shed[i] = limiterStats.shed[i];
+    }
 
+    std::lock_guard<std::mutex> lock(_worker_threads_mutex);
     for (auto& worker : _worker_threads) {
-        if (worker && worker->HasClient(clientSocket)) {
-            return worker.get();
-        }
+        stats.rejected_requests += worker->GetRejectedRequests();
+        stats.read_pauses += worker->GetReadPauses();
+        stats.rate_limited_frames += worker->GetRateLimitedFrames();
+        stats.rate_limited_requests += worker->GetRateLimitedRequests();
+        stats.rate_limit_disconnects += worker->GetRateLimitDisconnects();
+        stats.idle_timeouts += worker->GetIdleTimeouts();
+        stats.frame_timeouts += worker->GetFrameTimeouts();
+        stats.send_timeouts += worker->GetSendTimeouts();
     }
-    return nullptr;
+    return stats;
 }
 
-void Server::DisconnectAllUsers()
+void Server::RunStatsReporter()
 {
-    if (_database_thread) {
-        std::cout << "[Server]     ó ..." << std::endl;
-        _database_thread->DisconnectAllUsers();
+    std::unique_lock<std::mutex> lock(_stats_mutex);
+    while (_is_running.load()) {
+        if (_stats_cv.wait_for(lock, std::chrono::seconds(_config.stats_interval_sec),
+            [this] { return !_is_running.load(); })) {
+            break;
+        }
+
+        ServerStats stats = GetStats();
+        printf("[Server] 요청 큐: %zu/%zu, 큐 가득 참 거절: %llu, 수신 중단: %llu, 연결: %u\n",
+            stats.task_queue_depth, stats.task_queue_capacity,
+            static_cast<unsigned long long>(stats.rejected_requests),
+            static_cast<unsigned long long>(stats.read_pauses), stats.connections);
+        printf("[Server] DB 실행기 연결: %u/%u, 재연결: %llu\n", stats.db_connected, stats.db_executors,
+            static_cast<unsigned long long>(stats.db_reconnects));
+        printf("[Server] 실행기(샤드)별 요청 큐:");
+        for (size_t i = 0; i < stats.db_queue_depths.size(); ++i) {
+            printf(" %zu", stats.db_queue_depths[i]);
+        }
+        printf("\n");
+        printf("[Server] DB 동시성 한도: %u, 처리 중: %u, 지연: %.1f ms, 거절(CRITICAL/NORMAL/LOW): %llu/%llu/%llu\n",
+            stats.db_limit, stats.db_in_flight, stats.db_latency_ms,
+            static_cast<unsigned long long>(stats.db_shed[0]), static_cast<unsigned long long>(stats.db_shed[1]),
+            static_cast<unsigned long long>(stats.db_shed[2]));
+        printf("[Server] 속도 제한 - 버린 프레임: %llu, 거절한 요청: %llu, 끊은 연결: %llu\n",
+            static_cast<unsigned long long>(stats.rate_limited_frames),
+            static_cast<unsigned long long>(stats.rate_limited_requests),
+            static_cast<unsigned long long>(stats.rate_limit_disconnects));
+        printf("[Server] 시간 초과로 끊은 연결 - 유휴: %llu, 미완성 프레임: %llu, 송신 정체: %llu\n",
+            static_cast<unsigned long long>(stats.idle_timeouts),
+            static_cast<unsigned long long>(stats.frame_timeouts),
+            static_cast<unsigned long long>(stats.send_timeouts));
     }
 }
\ No newline at end of file
@@ -6,12 +6,42 @@
 #include <mutex>
 #include <atomic>
 #include <memory>
-#include "LockFreeQueue.h"
+#include <condition_variable>
+#include <cstdint>
+#include "TaskQueue.h"
 #include "Packet.h"
+#include "ServerConfig.h"
 
 
 class WorkerThread;
-class DatabaseThread;
+class DatabasePool;
+class ConnectionSlab;
+class Reactor;
+class ConcurrencyLimiter;
+struct TaskCompletion;
+
+// 요청 큐와 역압 상태 (GetStats, 주기 출력용)
+struct ServerStats {
+    size_t task_queue_depth;      // 모든 실행기 요청 큐에 쌓인 Task 수 (대략값)
+    size_t task_queue_capacity;   // 모든 실행기 요청 큐 크기의 합 (0이면 제한 없음)
+    uint64_t rejected_requests;   // 요청 큐가 가득 차 실패 응답으로 돌려보낸 요청 수
+    uint64_t read_pauses;         // 연결당 처리 중인 요청 한도로 수신을 멈춘 횟수
+    uint32_t connections;         // 현재 연결 수
+    uint32_t db_executors;        // DB 실행기 수
+    uint32_t db_connected;        // DB에 연결되어 있는 실행기 수
+    uint64_t db_reconnects;       // 실행기들이 DB에 다시 연결한 횟수
+    std::vector<size_t> db_queue_depths;  // 실행기(샤드)별 요청 큐 깊이
+    uint32_t db_limit;            // DB 동시성 제한기의 현재 한도
+    uint32_t db_in_flight;        // 제한기를 통과해 대기/처리 중인 요청 수
+    double db_latency_ms;         // 요청 큐 대기 + 처리 지연 (EWMA)
+    uint64_t db_shed[3];          // 제한기가 거절한 요청 수 (CRITICAL, NORMAL, LOW)
+    uint64_t rate_limited_frames;     // 연결 프레임 한도를 넘어 버린 프레임 수
+    uint64_t rate_limited_requests;   // 요청 종류별 한도를 넘어 실패 응답으로 돌려보낸 요청 수
+    uint64_t rate_limit_disconnects;  // 속도 제한 위반으로 끊은 연결 수
+    uint64_t idle_timeouts;           // 유휴 시간 초과로 끊은 연결 수
+    uint64_t frame_timeouts;          // 미완성 프레임 시간 초과로 끊은 연결 수
+    uint64_t send_timeouts;           // 응답 전송 정체로 끊은 연결 수
+};
 
 class Server
 {
@@ -21,41 +51,68 @@ private:
     static std::mutex instance_mutex;
 
     std::atomic<bool> _is_running;
+    ServerConfig _config;
 
+    std::unique_ptr<ConnectionSlab> _connections;  // 연결 핸들 -> 소유 WorkerThread (WorkerThread보다 오래 살아야 함)
     std::vector<std::unique_ptr<WorkerThread>> _worker_threads;
-    SOCKET _server_sock;
+    std::vector<SOCKET> _listen_socks;                      // SO_REUSEPORT 모드면 acceptor마다 하나
+    std::mutex _listen_socks_mutex;                         // 리슨 소켓 닫기 보호용
+    std::vector<std::unique_ptr<Reactor>> _accept_reactors; // 리슨 소켓별 준비 통지
+    std::vector<SOCKET> _spare_socks;                       // 리스너별 여유 디스크립터 (디스크립터 한도에서 대기 연결을 받아 끊는 데 사용)
+    std::vector<std::unique_ptr<std::thread>> _acceptor_threads;  // 두 번째 리스너부터 사용하는 acceptor 스레드
+#ifdef _WIN32
     WSAData _wsa_data;
+#endif
+
+    std::unique_ptr<DatabasePool> _db_pool;  // DB 실행기 풀 (실행기마다 요청 큐와 MYSQL 연결을 가짐)
+    std::mutex _worker_threads_mutex;  // WorkerThread 벡터 보호용 (Initialize 이후 크기는 고정)
 
-    std::unique_ptr<std::thread> _thread_cleaner;
-    std::unique_ptr<DatabaseThread> _database_thread;
-    std::mutex _worker_threads_mutex;  // WorkerThread  ȣ
+    std::unique_ptr<ConcurrencyLimiter> _db_limiter;  // WorkerThread enqueue와 DB 처리 사이의 적응형 동시성 제한기
 
-    LockFreeQueue<Task> RecvPakets;
-    LockFreeQueue<DBResponse> SendPackets;
+    // 통계 주기 출력 스레드
+    std::unique_ptr<std::thread> _stats_thread;
+    std::mutex _stats_mutex;
+    std::condition_variable _stats_cv;
+    void RunStatsReporter();
 
-    // Non-blocking accept  
+    // Non-blocking accept를 위한 설정
     void SetNonBlocking(SOCKET sock);
 
-    std::unique_ptr<std::thread> _response_handler_thread;  //  ó 
+    SOCKET CreateListenSocket(const char* ip, int port, bool reusePort);
+    void CloseListenSockets();
+
+    // index번째 리스너의 accept 루프 (준비 통지가 오면 쌓인 연결을 모두 받음)
+    void RunAcceptor(size_t index);
+    // 쌓인 연결을 WOULDBLOCK까지 받음 (에러로 다 받지 못했으면 false - 새 통지가 없어도 다음 루프에서 다시 시도)
+    bool AcceptPending(size_t index);
+    // 디스크립터 한도로 accept할 수 없을 때 여유 디스크립터를 내주고 대기 연결 하나를 받아 바로 끊음
+    // (여유 디스크립터를 잡지 못해 계속할 수 없으면 false)
+    bool DropPendingConnection(size_t index, uint64_t& dropped);
+    // 새 연결을 WorkerThread에 배정
+    void DispatchClient(SOCKET clientSock);
+#ifdef USE_IO_URING
+    // multishot accept로 연결을 받는 루프 (io_uring을 쓸 수 없으면 false)
+    bool RunUringAcceptLoop(size_t index);
+#endif
 
-    //  ó Լ
-    void ResponseHandlerLoop();
-    void ProcessDBResponse(const DBResponse& response);
-    WorkerThread* FindWorkerThreadBySocket(SOCKET clientSocket);
+    // DB 처리 결과를 연결을 소유한 WorkerThread의 송신 요청 큐로 바로 넘김 (DB 스레드에서 호출)
+    void ProcessDBResponse(DBResponse&& response);
+    WorkerThread* FindWorkerThreadByHandle(ConnectionHandle handle);
+    // 요청 하나의 DB 처리가 끝남 - 연결의 처리 중인 요청 수를 줄임 (DB 스레드에서 호출)
+    void OnTaskCompleted(const TaskCompletion& completion);
 
 public:
     static Server* Instance();
     ~Server();
 
-    void Initialize(const char* ip, int port);
+    void Initialize(const char* ip, int port, const ServerConfig& config = ServerConfig());
     void Run();
     void Stop();
     void Destroy();
 
-    int FindCanUseWorkerThread();
-    void ClearDeadThreads();
-    void Thread_ClearDeadWorkerLoop();
+    // 부하 점수(연결 수 + 최근 이벤트 처리량)가 가장 낮은 WorkerThread 선택
+    int FindLeastLoadedWorkerThread();
 
     bool IsRunning() const { return _is_running.load(); }
-    void DisconnectAllUsers();
+    ServerStats GetStats();
 };
\ No newline at end of file
@@ -0,0 +1,70 @@
+﻿#pragma once
+#include "TaskQueue.h"  // TASK_QUEUE_CAPACITY
+#include "DatabasePool.h"  // DB_POOL_DEFAULT_SIZE
+#include "RateLimiter.h"
+
+// 네트워크 I/O 방식
+enum class IoBackend {
+    REACTOR,   // 준비 상태 통지 (Linux: epoll, Windows: WSAPoll)
+    IO_URING   // 완료 통지 (Linux io_uring, USE_IO_URING 빌드에서만 사용 가능)
+};
+
+// 서버 실행 옵션
+struct ServerConfig {
+    IoBackend io_backend;
+
+    // WorkerThread 수 (0이면 하드웨어 스레드 수), 실행 중에는 늘거나 줄지 않는다
+    unsigned int worker_count;
+
+    // 동시 연결 한도 (연결 슬랩 크기, 최대 2^20), 가득 차면 새 연결은 바로 닫는다
+    unsigned int max_connections;
+
+    // 리스너 수: 2 이상이면 SO_REUSEPORT로 같은 포트에 여러 리슨 소켓을 열고 각각 전용 acceptor 스레드가 받는다
+    unsigned int acceptor_count;
+
+    // DB 실행기 수 (실행기마다 MYSQL 연결 하나), 같은 연결의 요청은 항상 같은 실행기가 처리한다
+    unsigned int db_executor_count;
+
+    // 실행기별 요청 큐(WorkerThread -> DB 실행기) 크기, 가득 차면 새 요청은 바로 실패 응답을 받는다
+    unsigned int task_queue_capacity;
+
+    // 연결당 DB 처리가 끝나지 않은 요청 한도 (0이면 제한 없음), 도달하면 그 연결의 수신을 멈춰 TCP로 역압을 건다
+    unsigned int max_in_flight;
+
+    // DB 동시성 제한기의 목표 지연 (ms, 요청 큐 대기 + 처리), 넘으면 한도를 줄이고 낮은 우선순위 요청부터 거절 (0이면 제한 없음)
+    unsigned int db_latency_target_ms;
+
+    // 연결당 초당 프레임 한도 (rate 0이면 제한 없음), 넘치는 프레임은 응답 없이 버린다
+    RateLimit connection_rate;
+
+    // EventType별 연결당 초당 요청 한도 (값으로 인덱싱), 넘치는 요청은 바로 실패 응답을 받는다
+    RateLimit event_rates[RATE_LIMIT_EVENT_SLOTS];
+
+    // 속도 제한 위반이 이 횟수에 도달한 연결은 끊는다 (0이면 끊지 않음)
+    unsigned int rate_violation_limit;
+
+    // 연결 타임아웃 (초, 0이면 검사하지 않음)
+    unsigned int idle_timeout_sec;   // 이 시간 동안 아무것도 받지 못한 연결 (유휴/반쯤 끊긴 연결)
+    unsigned int frame_timeout_sec;  // 프레임 일부만 보내고 나머지를 이 시간 안에 채우지 않는 연결 (slowloris)
+    unsigned int send_timeout_sec;   // 보낼 응답이 남았는데 이 시간 동안 전송이 진척되지 않는 연결
+
+    // 요청 큐/거절 통계 출력 주기 (초, 0이면 출력하지 않음)
+    unsigned int stats_interval_sec;
+
+    // 네트워크 버퍼 풀 아레나를 huge page로 할당 시도 (실패하면 일반 페이지)
+    bool huge_pages;
+
+    // io_uring 설정
+    unsigned int uring_entries;       // 워커당 SQ 크기
+    unsigned int uring_buffer_count;  // multishot recv용 제공 버퍼 개수 (2의 거듭제곱)
+    unsigned int uring_buffer_size;   // 제공 버퍼 하나의 크기
+
+    ServerConfig()
+        : io_backend(IoBackend::REACTOR), worker_count(0), max_connections(65536), acceptor_count(1),
+        db_executor_count(DB_POOL_DEFAULT_SIZE), task_queue_capacity(TASK_QUEUE_CAPACITY), max_in_flight(32), db_latency_target_ms(50),
+        connection_rate(200, 400), rate_violation_limit(0),
+        idle_timeout_sec(300), frame_timeout_sec(10), send_timeout_sec(30), stats_interval_sec(10), huge_pages(false),
+        uring_entries(4096), uring_buffer_count(1024), uring_buffer_size(4096) {
+        RateLimitPolicy::SetDefaultEventLimits(event_rates);
+    }
+};
@@ -1,5 +1,7 @@
 #include <iostream>
 #include <csignal>
+#include <cstring>
+#include <cstdlib>
 #include "Server.h"
 #include "mysql.h"
 
@@ -19,6 +21,7 @@ void SignalHandler(int signal)
     }
 }
 
+#ifdef _WIN32
 BOOL WINAPI ConsoleHandler(DWORD signal)
 {
     if (signal == CTRL_C_EVENT || signal == CTRL_CLOSE_EVENT) {
@@ -33,6 +36,7 @@ BOOL WINAPI ConsoleHandler(DWORD signal)
     }
     return FALSE;
 }
+#endif
 
 void Cleanup()
 {
@@ -42,23 +46,103 @@ void Cleanup()
     }
 }
 
-int main()
+int main(int argc, char* argv[])
 {
     try {
-        // ñ׳ ڵ鷯 
+        // 시그널 핸들러 설정
         std::signal(SIGINT, SignalHandler);
         std::signal(SIGTERM, SignalHandler);
+#ifdef _WIN32
         SetConsoleCtrlHandler(ConsoleHandler, TRUE);
+#endif
 
-        //    Լ 
+        // 종료 시 정리 함수 등록
         std::atexit(Cleanup);
 
+        // 실행 옵션
+        //   --io-uring    : io_uring 백엔드 사용 (지원하지 않으면 reactor로 대체)
+        //   --acceptors N : SO_REUSEPORT 리스너 N개를 각자의 acceptor 스레드로 운영
+        //   --workers N   : WorkerThread 수 (기본값: 하드웨어 스레드 수)
+        //   --max-connections N : 동시 연결 한도 (기본값: 65536)
+        //   --huge-pages  : 네트워크 버퍼 풀을 huge page로 할당 시도
+        //   --db-threads N : DB 실행기 수, 실행기마다 MYSQL 연결 하나 (기본값: 4)
+        //   --task-queue-capacity N : 실행기별 요청 큐 크기 (기본값: 65536), 가득 차면 새 요청은 바로 실패 응답
+        //   --max-in-flight N : 연결당 처리 중인 요청 한도 (기본값: 32, 0이면 제한 없음)
+        //   --db-latency-target N : DB 동시성 제한기 목표 지연 ms (기본값: 50, 0이면 제한 없음)
+        //   --rate-limit N[:B] : 연결당 초당 프레임 한도와 버스트 (기본값: 200:400, 0이면 제한 없음)
+        //   --event-rate TYPE=N[:B] : 요청 종류별 연결당 초당 한도 (예: C2S_PlayerChat=5:10, 0이면 제한 없음)
+        //   --rate-disconnect N : 속도 제한 위반 N회에 도달한 연결을 끊음 (기본값: 0, 끊지 않음)
+        //   --idle-timeout N : N초 동안 아무것도 받지 못한 연결을 끊음 (기본값: 300, 0이면 끊지 않음)
+        //   --frame-timeout N : 프레임을 N초 안에 다 보내지 않는 연결을 끊음 (기본값: 10, 0이면 끊지 않음)
+        //   --send-timeout N : 응답 전송이 N초 동안 진척되지 않는 연결을 끊음 (기본값: 30, 0이면 끊지 않음)
+        //   --stats-interval N : 요청 큐/거절 통계 출력 주기 초 (기본값: 10, 0이면 출력 안 함)
+        ServerConfig config;
+        for (int i = 1; i < argc; ++i) {
+            if (strcmp(argv[i], "--io-uring") == 0) {
+                config.io_backend = IoBackend::IO_URING;
+            }
+            else if (strcmp(argv[i], "--acceptors") == 0 && i + 1 < argc) {
+                config.acceptor_count = static_cast<unsigned int>(atoi(argv[++i]));
+            }
+            else if (strcmp(argv[i], "--workers") == 0 && i + 1 < argc) {
+                config.worker_count = static_cast<unsigned int>(atoi(argv[++i]));
+            }
+            else if (strcmp(argv[i], "--huge-pages") == 0) {
+                config.huge_pages = true;
+            }
+            else if (strcmp(argv[i], "--max-connections") == 0 && i + 1 < argc) {
+                config.max_connections = static_cast<unsigned int>(atoi(argv[++i]));
+            }
+            else if (strcmp(argv[i], "--db-threads") == 0 && i + 1 < argc) {
+                config.db_executor_count = static_cast<unsigned int>(atoi(argv[++i]));
+            }
+            else if (strcmp(argv[i], "--task-queue-capacity") == 0 && i + 1 < argc) {
+                config.task_queue_capacity = static_cast<unsigned int>(atoi(argv[++i]));
+            }
+            else if (strcmp(argv[i], "--max-in-flight") == 0 && i + 1 < argc) {
+                config.max_in_flight = static_cast<unsigned int>(atoi(argv[++i]));
+            }
+            else if (strcmp(argv[i], "--db-latency-target") == 0 && i + 1 < argc) {
+                config.db_latency_target_ms = static_cast<unsigned int>(atoi(argv[++i]));
+            }
+            else if (strcmp(argv[i], "--rate-limit") == 0 && i + 1 < argc) {
+                if (!RateLimitPolicy::ParseRateLimit(argv[++i], config.connection_rate)) {
+                    std::cerr << "잘못된 --rate-limit 값: " << argv[i] << std::endl;
+                }
+            }
+            else if (strcmp(argv[i], "--event-rate") == 0 && i + 1 < argc) {
+                EventType packetType;
+                RateLimit limit;
+                if (RateLimitPolicy::ParseEventLimit(argv[++i], packetType, limit)) {
+                    config.event_rates[packetType] = limit;
+                }
+                else {
+                    std::cerr << "잘못된 --event-rate 값: " << argv[i] << std::endl;
+                }
+            }
+            else if (strcmp(argv[i], "--rate-disconnect") == 0 && i + 1 < argc) {
+                config.rate_violation_limit = static_cast<unsigned int>(atoi(argv[++i]));
+            }
+            else if (strcmp(argv[i], "--idle-timeout") == 0 && i + 1 < argc) {
+                config.idle_timeout_sec = static_cast<unsigned int>(atoi(argv[++i]));
+            }
+            else if (strcmp(argv[i], "--frame-timeout") == 0 && i + 1 < argc) {
+                config.frame_timeout_sec = static_cast<unsigned int>(atoi(argv[++i]));
+            }
+            else if (strcmp(argv[i], "--send-timeout") == 0 && i + 1 < argc) {
+                config.send_timeout_sec = static_cast<unsigned int>(atoi(argv[++i]));
+            }
+            else if (strcmp(argv[i], "--stats-interval") == 0 && i + 1 < argc) {
+                config.stats_interval_sec = static_cast<unsigned int>(atoi(argv[++i]));
+            }
+        }
+
         Server* server = Server::Instance();
 
         std::cout << "Starting server\n";
-        server->Initialize("192.168.0.101", 36930);
+        server->Initialize("192.168.0.101", 36930, config);
 
-        //  
+        // 서버 실행
         server->Run();
 
         std::cout << "Server stopped gracefully\n";
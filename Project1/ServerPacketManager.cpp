@@ -9,9 +9,41 @@
 
 #include "ServerPacketManager.h"
 #include "flatbuffers/flatbuffers.h"
+#include "PooledFlatBufferAllocator.h"
 #include "UserEvent_generated.h"
 #include <iostream>
 
+// 행을 읽는 대로 조각 단위로 인코딩해 보냄 (보낸 뒤 같은 빌더를 비워 다음 조각에 재사용하므로 결과 크기와 상관없이 메모리가 일정)
+// - encodeRow: 현재 행 하나를 빌더에 쓰고 오프셋을 반환 (다음 Fetch 전에 호출되므로 string_view를 그대로 써도 된다)
+// - finishChunk: 모은 오프셋 벡터, result, has_more로 패킷을 완성 (builder.Finish까지)
+// 다음 행을 미리 읽어 두어 지금 조각이 마지막인지 안다.
+template <typename T, typename EncodeRow, typename FinishChunk>
+static void SendRowsInChunks(flatbuffers::FlatBufferBuilder& builder, RowReader* rows,
+    EncodeRow encodeRow, FinishChunk finishChunk, const ResponseChunkSink& sendChunk)
+{
+    std::vector<flatbuffers::Offset<T>> entries;
+    bool hasRow = rows->Fetch();
+
+    do {
+        builder.Clear();
+        entries.clear();
+
+        // 한 행은 무조건 넣고, 그 뒤로는 목표 크기에 닿을 때까지 (벡터에 들어갈 오프셋 크기 포함)
+        while (hasRow && (entries.empty() ||
+            builder.GetSize() + entries.size() * sizeof(flatbuffers::uoffset_t) < DB_RESPONSE_CHUNK_SIZE)) {
+            entries.push_back(encodeRow());
+            hasRow = rows->Fetch();
+        }
+
+        // 읽기가 중간에 끊겼으면 마지막 조각을 FAIL로 보내 클라이언트가 잘린 목록을 완성된 것으로 보지 않게 함
+        ResultCode result = (!hasRow && rows->HasFetchError()) ? ResultCode_FAIL : ResultCode_SUCCESS;
+        finishChunk(builder.CreateVector(entries), result, hasRow);
+        sendChunk(PacketBuffer::Copy(builder.GetBufferPointer(), builder.GetSize()));
+    } while (hasRow);
+
+    rows->FreeResult();
+}
+
 ServerPacketManager::ServerPacketManager()
 {
     ClearError();
@@ -42,7 +74,7 @@ bool ServerPacketManager::VerifyPacket(const uint8_t* data, size_t size)
     return VerifyDatabasePacketBuffer(verifier);
 }
 
-// === Ŭ̾Ʈ û Ŷ Ľ (C2S) ===
+// === 클라이언트 요청 패킷 파싱 (C2S) ===
 
 const C2S_Login* ServerPacketManager::ParseLoginRequest(const uint8_t* data, size_t size)
 {
@@ -269,13 +301,13 @@ const C2S_SavePlayerData* ServerPacketManager::ParseSavePlayerDataRequest(const
     return packet->packet_event_as_C2S_SavePlayerData();
 }
 
-// ===   Ŷ  (S2C) ===
+// === 서버 응답 패킷 생성 (S2C) ===
 
-std::vector<uint8_t> ServerPacketManager::CreateLoginResponse(ResultCode result, uint32_t user_id, const std::string& username, const std::string& nickname, uint32_t level, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateLoginResponse(ResultCode result, uint32_t user_id, const std::string& username, const std::string& nickname, uint32_t level, uint32_t client_socket)
 {
     ClearError();
     try {
-        flatbuffers::FlatBufferBuilder builder;
+        flatbuffers::FlatBufferBuilder builder(FLATBUFFER_INITIAL_SIZE, &PooledFlatBufferAllocator::Instance());
 
         auto usernameOffset = builder.CreateString(username);
         auto nicknameOffset = builder.CreateString(nickname);
@@ -287,19 +319,19 @@ std::vector<uint8_t> ServerPacketManager::CreateLoginResponse(ResultCode result,
         uint8_t* bufferPointer = builder.GetBufferPointer();
         size_t bufferSize = builder.GetSize();
 
-        return std::vector<uint8_t>(bufferPointer, bufferPointer + bufferSize);
+        return PacketBuffer::Copy(bufferPointer, bufferSize);
     }
     catch (const std::exception& e) {
         SetError("CreateLoginResponse failed: " + std::string(e.what()));
-        return std::vector<uint8_t>();
+        return PacketBuffer();
     }
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateLogoutResponse(ResultCode result, const std::string& message, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateLogoutResponse(ResultCode result, const std::string& message, uint32_t client_socket)
 {
     ClearError();
     try {
-        flatbuffers::FlatBufferBuilder builder;
+        flatbuffers::FlatBufferBuilder builder(FLATBUFFER_INITIAL_SIZE, &PooledFlatBufferAllocator::Instance());
 
         auto messageOffset = builder.CreateString(message);
         auto logoutResponse = CreateS2C_Logout(builder, result, messageOffset);
@@ -310,19 +342,19 @@ std::vector<uint8_t> ServerPacketManager::CreateLogoutResponse(ResultCode result
         uint8_t* bufferPointer = builder.GetBufferPointer();
         size_t bufferSize = builder.GetSize();
 
-        return std::vector<uint8_t>(bufferPointer, bufferPointer + bufferSize);
+        return PacketBuffer::Copy(bufferPointer, bufferSize);
     }
     catch (const std::exception& e) {
         SetError("CreateLogoutResponse failed: " + std::string(e.what()));
-        return std::vector<uint8_t>();
+        return PacketBuffer();
     }
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateAccountResponse(ResultCode result, uint32_t user_id, const std::string& message, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateAccountResponse(ResultCode result, uint32_t user_id, const std::string& message, uint32_t client_socket)
 {
     ClearError();
     try {
-        flatbuffers::FlatBufferBuilder builder;
+        flatbuffers::FlatBufferBuilder builder(FLATBUFFER_INITIAL_SIZE, &PooledFlatBufferAllocator::Instance());
 
         auto messageOffset = builder.CreateString(message);
         auto accountResponse = CreateS2C_CreateAccount(builder, result, user_id, messageOffset);
@@ -333,21 +365,21 @@ std::vector<uint8_t> ServerPacketManager::CreateAccountResponse(ResultCode resul
         uint8_t* bufferPointer = builder.GetBufferPointer();
         size_t bufferSize = builder.GetSize();
 
-        return std::vector<uint8_t>(bufferPointer, bufferPointer + bufferSize);
+        return PacketBuffer::Copy(bufferPointer, bufferSize);
     }
     catch (const std::exception& e) {
         SetError("CreateAccountResponse failed: " + std::string(e.what()));
-        return std::vector<uint8_t>();
+        return PacketBuffer();
     }
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateItemDataResponse(ResultCode result, uint32_t user_id, uint32_t gold, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateItemDataResponse(ResultCode result, uint32_t user_id, uint32_t gold, uint32_t client_socket)
 {
     ClearError();
     try {
-        flatbuffers::FlatBufferBuilder builder;
+        flatbuffers::FlatBufferBuilder builder(FLATBUFFER_INITIAL_SIZE, &PooledFlatBufferAllocator::Instance());
 
-        //   ͷ ⺻  
+        // 빈 아이템 벡터로 기본 응답 생성
         std::vector<flatbuffers::Offset<ItemData>> items;
         auto itemsVector = builder.CreateVector(items);
 
@@ -359,21 +391,21 @@ std::vector<uint8_t> ServerPacketManager::CreateItemDataResponse(ResultCode resu
         uint8_t* bufferPointer = builder.GetBufferPointer();
         size_t bufferSize = builder.GetSize();
 
-        return std::vector<uint8_t>(bufferPointer, bufferPointer + bufferSize);
+        return PacketBuffer::Copy(bufferPointer, bufferSize);
     }
     catch (const std::exception& e) {
         SetError("CreateItemDataResponse failed: " + std::string(e.what()));
-        return std::vector<uint8_t>();
+        return PacketBuffer();
     }
 }
 
-std::vector<uint8_t> ServerPacketManager::CreatePlayerDataResponse(ResultCode result, uint32_t user_id, const std::string& username, const std::string& nickname,
+PacketBuffer ServerPacketManager::CreatePlayerDataResponse(ResultCode result, uint32_t user_id, const std::string& username, const std::string& nickname,
     uint32_t level, uint32_t exp, uint32_t hp, uint32_t mp, uint32_t attack,
     uint32_t defense, uint32_t gold, uint32_t map_id, float pos_x, float pos_y, uint32_t client_socket)
 {
     ClearError();
     try {
-        flatbuffers::FlatBufferBuilder builder;
+        flatbuffers::FlatBufferBuilder builder(FLATBUFFER_INITIAL_SIZE, &PooledFlatBufferAllocator::Instance());
 
         auto usernameOffset = builder.CreateString(username);
         auto nicknameOffset = builder.CreateString(nickname);
@@ -385,21 +417,21 @@ std::vector<uint8_t> ServerPacketManager::CreatePlayerDataResponse(ResultCode re
         uint8_t* bufferPointer = builder.GetBufferPointer();
         size_t bufferSize = builder.GetSize();
 
-        return std::vector<uint8_t>(bufferPointer, bufferPointer + bufferSize);
+        return PacketBuffer::Copy(bufferPointer, bufferSize);
     }
     catch (const std::exception& e) {
         SetError("CreatePlayerDataResponse failed: " + std::string(e.what()));
-        return std::vector<uint8_t>();
+        return PacketBuffer();
     }
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateMonsterDataResponse(ResultCode result, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateMonsterDataResponse(ResultCode result, uint32_t client_socket)
 {
     ClearError();
     try {
-        flatbuffers::FlatBufferBuilder builder;
+        flatbuffers::FlatBufferBuilder builder(FLATBUFFER_INITIAL_SIZE, &PooledFlatBufferAllocator::Instance());
 
-        //   ͷ ⺻  
+        // 빈 몬스터 벡터로 기본 응답 생성
         std::vector<flatbuffers::Offset<MonsterData>> monsters;
         auto monstersVector = builder.CreateVector(monsters);
 
@@ -411,21 +443,21 @@ std::vector<uint8_t> ServerPacketManager::CreateMonsterDataResponse(ResultCode r
         uint8_t* bufferPointer = builder.GetBufferPointer();
         size_t bufferSize = builder.GetSize();
 
-        return std::vector<uint8_t>(bufferPointer, bufferPointer + bufferSize);
+        return PacketBuffer::Copy(bufferPointer, bufferSize);
     }
     catch (const std::exception& e) {
         SetError("CreateMonsterDataResponse failed: " + std::string(e.what()));
-        return std::vector<uint8_t>();
+        return PacketBuffer();
     }
 }
 
-std::vector<uint8_t> ServerPacketManager::CreatePlayerChatResponse(ResultCode result, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreatePlayerChatResponse(ResultCode result, uint32_t client_socket)
 {
     ClearError();
     try {
-        flatbuffers::FlatBufferBuilder builder;
+        flatbuffers::FlatBufferBuilder builder(FLATBUFFER_INITIAL_SIZE, &PooledFlatBufferAllocator::Instance());
 
-        //  ä ͷ ⺻  
+        // 빈 채팅 벡터로 기본 응답 생성
         std::vector<flatbuffers::Offset<ChatData>> chats;
         auto chatsVector = builder.CreateVector(chats);
 
@@ -437,21 +469,21 @@ std::vector<uint8_t> ServerPacketManager::CreatePlayerChatResponse(ResultCode re
         uint8_t* bufferPointer = builder.GetBufferPointer();
         size_t bufferSize = builder.GetSize();
 
-        return std::vector<uint8_t>(bufferPointer, bufferPointer + bufferSize);
+        return PacketBuffer::Copy(bufferPointer, bufferSize);
     }
     catch (const std::exception& e) {
         SetError("CreatePlayerChatResponse failed: " + std::string(e.what()));
-        return std::vector<uint8_t>();
+        return PacketBuffer();
     }
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateShopListResponse(ResultCode result, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateShopListResponse(ResultCode result, uint32_t client_socket)
 {
     ClearError();
     try {
-        flatbuffers::FlatBufferBuilder builder;
+        flatbuffers::FlatBufferBuilder builder(FLATBUFFER_INITIAL_SIZE, &PooledFlatBufferAllocator::Instance());
 
-        //   ͷ ⺻  
+        // 빈 상점 벡터로 기본 응답 생성
         std::vector<flatbuffers::Offset<ShopData>> shops;
         auto shopsVector = builder.CreateVector(shops);
 
@@ -463,21 +495,21 @@ std::vector<uint8_t> ServerPacketManager::CreateShopListResponse(ResultCode resu
         uint8_t* bufferPointer = builder.GetBufferPointer();
         size_t bufferSize = builder.GetSize();
 
-        return std::vector<uint8_t>(bufferPointer, bufferPointer + bufferSize);
+        return PacketBuffer::Copy(bufferPointer, bufferSize);
     }
     catch (const std::exception& e) {
         SetError("CreateShopListResponse failed: " + std::string(e.what()));
-        return std::vector<uint8_t>();
+        return PacketBuffer();
     }
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateShopItemsResponse(ResultCode result, uint32_t shop_id, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateShopItemsResponse(ResultCode result, uint32_t shop_id, uint32_t client_socket)
 {
     ClearError();
     try {
-        flatbuffers::FlatBufferBuilder builder;
+        flatbuffers::FlatBufferBuilder builder(FLATBUFFER_INITIAL_SIZE, &PooledFlatBufferAllocator::Instance());
 
-        //   ͷ ⺻  
+        // 빈 아이템 벡터로 기본 응답 생성
         std::vector<flatbuffers::Offset<ItemData>> items;
         auto itemsVector = builder.CreateVector(items);
 
@@ -489,19 +521,19 @@ std::vector<uint8_t> ServerPacketManager::CreateShopItemsResponse(ResultCode res
         uint8_t* bufferPointer = builder.GetBufferPointer();
         size_t bufferSize = builder.GetSize();
 
-        return std::vector<uint8_t>(bufferPointer, bufferPointer + bufferSize);
+        return PacketBuffer::Copy(bufferPointer, bufferSize);
     }
     catch (const std::exception& e) {
         SetError("CreateShopItemsResponse failed: " + std::string(e.what()));
-        return std::vector<uint8_t>();
+        return PacketBuffer();
     }
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateShopTransactionResponse(ResultCode result, const std::string& message, uint32_t updated_gold, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateShopTransactionResponse(ResultCode result, const std::string& message, uint32_t updated_gold, uint32_t client_socket)
 {
     ClearError();
     try {
-        flatbuffers::FlatBufferBuilder builder;
+        flatbuffers::FlatBufferBuilder builder(FLATBUFFER_INITIAL_SIZE, &PooledFlatBufferAllocator::Instance());
 
         auto messageOffset = builder.CreateString(message);
         auto transactionResponse = CreateS2C_ShopTransaction(builder, result, messageOffset, updated_gold);
@@ -512,19 +544,19 @@ std::vector<uint8_t> ServerPacketManager::CreateShopTransactionResponse(ResultCo
         uint8_t* bufferPointer = builder.GetBufferPointer();
         size_t bufferSize = builder.GetSize();
 
-        return std::vector<uint8_t>(bufferPointer, bufferPointer + bufferSize);
+        return PacketBuffer::Copy(bufferPointer, bufferSize);
     }
     catch (const std::exception& e) {
         SetError("CreateShopTransactionResponse failed: " + std::string(e.what()));
-        return std::vector<uint8_t>();
+        return PacketBuffer();
     }
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateGameServerResponse(ResultCode result, uint32_t server_id, const std::string& message, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateGameServerResponse(ResultCode result, uint32_t server_id, const std::string& message, uint32_t client_socket)
 {
     ClearError();
     try {
-        flatbuffers::FlatBufferBuilder builder;
+        flatbuffers::FlatBufferBuilder builder(FLATBUFFER_INITIAL_SIZE, &PooledFlatBufferAllocator::Instance());
 
         auto messageOffset = builder.CreateString(message);
         auto gameServerResponse = CreateS2C_CreateGameServer(builder, result, server_id, messageOffset);
@@ -535,21 +567,21 @@ std::vector<uint8_t> ServerPacketManager::CreateGameServerResponse(ResultCode re
         uint8_t* bufferPointer = builder.GetBufferPointer();
         size_t bufferSize = builder.GetSize();
 
-        return std::vector<uint8_t>(bufferPointer, bufferPointer + bufferSize);
+        return PacketBuffer::Copy(bufferPointer, bufferSize);
     }
     catch (const std::exception& e) {
         SetError("CreateGameServerResponse failed: " + std::string(e.what()));
-        return std::vector<uint8_t>();
+        return PacketBuffer();
     }
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateGameServerListResponse(ResultCode result, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateGameServerListResponse(ResultCode result, uint32_t client_socket)
 {
     ClearError();
     try {
-        flatbuffers::FlatBufferBuilder builder;
+        flatbuffers::FlatBufferBuilder builder(FLATBUFFER_INITIAL_SIZE, &PooledFlatBufferAllocator::Instance());
 
-        //   ͷ ⺻  
+        // 빈 서버 벡터로 기본 응답 생성
         std::vector<flatbuffers::Offset<GameServerData>> servers;
         auto serversVector = builder.CreateVector(servers);
 
@@ -561,19 +593,19 @@ std::vector<uint8_t> ServerPacketManager::CreateGameServerListResponse(ResultCod
         uint8_t* bufferPointer = builder.GetBufferPointer();
         size_t bufferSize = builder.GetSize();
 
-        return std::vector<uint8_t>(bufferPointer, bufferPointer + bufferSize);
+        return PacketBuffer::Copy(bufferPointer, bufferSize);
     }
     catch (const std::exception& e) {
         SetError("CreateGameServerListResponse failed: " + std::string(e.what()));
-        return std::vector<uint8_t>();
+        return PacketBuffer();
     }
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateJoinGameServerResponse(ResultCode result, const std::string& server_ip, uint32_t server_port, const std::string& message, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateJoinGameServerResponse(ResultCode result, const std::string& server_ip, uint32_t server_port, const std::string& message, uint32_t client_socket)
 {
     ClearError();
     try {
-        flatbuffers::FlatBufferBuilder builder;
+        flatbuffers::FlatBufferBuilder builder(FLATBUFFER_INITIAL_SIZE, &PooledFlatBufferAllocator::Instance());
 
         auto serverIpOffset = builder.CreateString(server_ip);
         auto messageOffset = builder.CreateString(message);
@@ -585,19 +617,19 @@ std::vector<uint8_t> ServerPacketManager::CreateJoinGameServerResponse(ResultCod
         uint8_t* bufferPointer = builder.GetBufferPointer();
         size_t bufferSize = builder.GetSize();
 
-        return std::vector<uint8_t>(bufferPointer, bufferPointer + bufferSize);
+        return PacketBuffer::Copy(bufferPointer, bufferSize);
     }
     catch (const std::exception& e) {
         SetError("CreateJoinGameServerResponse failed: " + std::string(e.what()));
-        return std::vector<uint8_t>();
+        return PacketBuffer();
     }
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateCloseGameServerResponse(ResultCode result, const std::string& message, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateCloseGameServerResponse(ResultCode result, const std::string& message, uint32_t client_socket)
 {
     ClearError();
     try {
-        flatbuffers::FlatBufferBuilder builder;
+        flatbuffers::FlatBufferBuilder builder(FLATBUFFER_INITIAL_SIZE, &PooledFlatBufferAllocator::Instance());
 
         auto messageOffset = builder.CreateString(message);
         auto closeGameServerResponse = CreateS2C_CloseGameServer(builder, result, messageOffset);
@@ -608,19 +640,19 @@ std::vector<uint8_t> ServerPacketManager::CreateCloseGameServerResponse(ResultCo
         uint8_t* bufferPointer = builder.GetBufferPointer();
         size_t bufferSize = builder.GetSize();
 
-        return std::vector<uint8_t>(bufferPointer, bufferPointer + bufferSize);
+        return PacketBuffer::Copy(bufferPointer, bufferSize);
     }
     catch (const std::exception& e) {
         SetError("CreateCloseGameServerResponse failed: " + std::string(e.what()));
-        return std::vector<uint8_t>();
+        return PacketBuffer();
     }
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateSavePlayerDataResponse(ResultCode result, const std::string& message, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateSavePlayerDataResponse(ResultCode result, const std::string& message, uint32_t client_socket)
 {
     ClearError();
     try {
-        flatbuffers::FlatBufferBuilder builder;
+        flatbuffers::FlatBufferBuilder builder(FLATBUFFER_INITIAL_SIZE, &PooledFlatBufferAllocator::Instance());
 
         auto messageOffset = builder.CreateString(message);
         auto savePlayerDataResponse = CreateS2C_SavePlayerData(builder, result, messageOffset);
@@ -631,31 +663,32 @@ std::vector<uint8_t> ServerPacketManager::CreateSavePlayerDataResponse(ResultCod
         uint8_t* bufferPointer = builder.GetBufferPointer();
         size_t bufferSize = builder.GetSize();
 
-        return std::vector<uint8_t>(bufferPointer, bufferPointer + bufferSize);
+        return PacketBuffer::Copy(bufferPointer, bufferSize);
     }
     catch (const std::exception& e) {
         SetError("CreateSavePlayerDataResponse failed: " + std::string(e.what()));
-        return std::vector<uint8_t>();
+        return PacketBuffer();
     }
 }
 
-// === MySQL    Ŷ  ( ) ===
+// === DB 결과 행에서 직접 응답 패킷 생성 (서버 전용) ===
 
-std::vector<uint8_t> ServerPacketManager::CreateLoginResponseFromDB(MYSQL_RES* result, const std::string& username, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateLoginResponseFromDB(RowReader* rows, const std::string& username, uint32_t client_socket)
 {
-    if (!IsValidMySQLResult(result)) {
+    if (!rows) {
         return CreateLoginErrorResponse(ResultCode_FAIL, client_socket);
     }
 
-    MYSQL_ROW row = mysql_fetch_row(result);
-    if (!row) {
+    if (!rows->Fetch()) {
+        rows->FreeResult();
         return CreateLoginErrorResponse(ResultCode_INVALID_USER, client_socket);
     }
 
     try {
-        uint32_t user_id = GetUintFromRow(row, 0);
-        std::string nickname = GetStringFromRow(row, 1);  // nickname ߰
-        uint32_t level = GetUintFromRow(row, 2);
+        uint32_t user_id = rows->GetUInt(0);
+        std::string nickname(rows->GetString(1));  // nickname 추가
+        uint32_t level = rows->GetUInt(2);
+        rows->FreeResult();
 
         return CreateLoginResponse(ResultCode_SUCCESS, user_id, username, nickname, level, client_socket);
     }
@@ -665,30 +698,31 @@ std::vector<uint8_t> ServerPacketManager::CreateLoginResponseFromDB(MYSQL_RES* r
     }
 }
 
-std::vector<uint8_t> ServerPacketManager::CreatePlayerDataResponseFromDB(MYSQL_RES* result, uint32_t user_id, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreatePlayerDataResponseFromDB(RowReader* rows, uint32_t user_id, uint32_t client_socket)
 {
-    if (!IsValidMySQLResult(result)) {
+    if (!rows) {
         return CreatePlayerDataErrorResponse(ResultCode_FAIL, client_socket);
     }
 
-    MYSQL_ROW row = mysql_fetch_row(result);
-    if (!row) {
+    if (!rows->Fetch()) {
+        rows->FreeResult();
         return CreatePlayerDataErrorResponse(ResultCode_USER_NOT_FOUND, client_socket);
     }
 
     try {
-        std::string username = GetStringFromRow(row, 0);
-        std::string nickname = GetStringFromRow(row, 1);  // nickname ߰
-        uint32_t level = GetUintFromRow(row, 2);
-        uint32_t exp = GetUintFromRow(row, 3);
-        uint32_t hp = GetUintFromRow(row, 4);
-        uint32_t mp = GetUintFromRow(row, 5);
-        uint32_t attack = GetUintFromRow(row, 6);
-        uint32_t defense = GetUintFromRow(row, 7);
-        uint32_t gold = GetUintFromRow(row, 8);
-        uint32_t map_id = GetUintFromRow(row, 9);
-        float pos_x = GetFloatFromRow(row, 10);
-        float pos_y = GetFloatFromRow(row, 11);
+        std::string username(rows->GetString(0));
+        std::string nickname(rows->GetString(1));  // nickname 추가
+        uint32_t level = rows->GetUInt(2);
+        uint32_t exp = rows->GetUInt(3);
+        uint32_t hp = rows->GetUInt(4);
+        uint32_t mp = rows->GetUInt(5);
+        uint32_t attack = rows->GetUInt(6);
+        uint32_t defense = rows->GetUInt(7);
+        uint32_t gold = rows->GetUInt(8);
+        uint32_t map_id = rows->GetUInt(9);
+        float pos_x = rows->GetFloat(10);
+        float pos_y = rows->GetFloat(11);
+        rows->FreeResult();
 
         return CreatePlayerDataResponse(ResultCode_SUCCESS, user_id, username, nickname, level, exp, hp, mp,
             attack, defense, gold, map_id, pos_x, pos_y, client_socket);
@@ -699,94 +733,94 @@ std::vector<uint8_t> ServerPacketManager::CreatePlayerDataResponseFromDB(MYSQL_R
     }
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateItemDataResponseFromDB(MYSQL_RES* result, uint32_t user_id, uint32_t client_socket)
+void ServerPacketManager::CreateItemDataResponseFromDB(RowReader* rows, uint32_t user_id, const ResponseChunkSink& sendChunk, uint32_t client_socket)
 {
-    if (!IsValidMySQLResult(result)) {
-        return CreateItemDataErrorResponse(ResultCode_FAIL, user_id, client_socket);
+    if (!rows) {
+        sendChunk(CreateItemDataErrorResponse(ResultCode_FAIL, user_id, client_socket));
+        return;
     }
     ClearError();
     try {
-        flatbuffers::FlatBufferBuilder builder;
-        std::vector<flatbuffers::Offset<ItemData>> items;
+        flatbuffers::FlatBufferBuilder builder(FLATBUFFER_INITIAL_SIZE, &PooledFlatBufferAllocator::Instance());
         uint32_t gold = 0;
         bool first_row = true;
-        MYSQL_ROW row;
-
-        // ù ° ࿡ ÷  Ȯ
-        unsigned int num_fields = mysql_num_fields(result);
-
-        while ((row = mysql_fetch_row(result))) {
-            uint32_t item_id = GetUintFromRow(row, 0);
-            std::string item_name = GetStringFromRow(row, 1);
-            uint32_t item_count = GetUintFromRow(row, 2);
-            uint32_t item_type = GetUintFromRow(row, 3);
-            uint32_t base_price = GetUintFromRow(row, 4);
-            uint32_t attack_bonus = GetUintFromRow(row, 5);
-            uint32_t defense_bonus = GetUintFromRow(row, 6);
-            uint32_t hp_bonus = GetUintFromRow(row, 7);
-            uint32_t mp_bonus = GetUintFromRow(row, 8);
-            std::string description = GetStringFromRow(row, 9);
 
-            auto itemNameOffset = builder.CreateString(item_name);
-            auto descriptionOffset = builder.CreateString(description);
-            auto itemData = CreateItemData(builder, item_id, itemNameOffset, item_count, item_type,
-                base_price, attack_bonus, defense_bonus, hp_bonus, mp_bonus, descriptionOffset);
-            items.push_back(itemData);
+        // 결과 컬럼 개수 확인 (인벤토리 조회만 gold 컬럼이 붙음)
+        unsigned int num_fields = rows->GetColumnCount();
+
+        auto encodeRow = [&]() {
+            uint32_t item_id = rows->GetUInt(0);
+            std::string_view item_name = rows->GetString(1);
+            uint32_t item_count = rows->GetUInt(2);
+            uint32_t item_type = rows->GetUInt(3);
+            uint32_t base_price = rows->GetUInt(4);
+            uint32_t attack_bonus = rows->GetUInt(5);
+            uint32_t defense_bonus = rows->GetUInt(6);
+            uint32_t hp_bonus = rows->GetUInt(7);
+            uint32_t mp_bonus = rows->GetUInt(8);
+            std::string_view description = rows->GetString(9);
 
             if (first_row) {
-                // ÷ 11 ̻ 쿡 gold  
+                // 컬럼이 11개 이상인 경우에만 gold 값 가져오기
                 if (num_fields > 10) {
-                    gold = GetUintFromRow(row, 10);
+                    gold = rows->GetUInt(10);
                 }
                 else {
-                    gold = 0; // gold ÷  0 
+                    gold = 0; // gold 컬럼이 없으면 0으로 설정
                 }
                 first_row = false;
             }
-        }
 
-        auto itemsVector = builder.CreateVector(items);
-        auto itemResponse = CreateS2C_ItemData(builder, ResultCode_SUCCESS, user_id, itemsVector, gold);
-        auto packet = CreateDatabasePacket(builder, EventType_S2C_ItemData, itemResponse.Union(), client_socket);
-        builder.Finish(packet);
+            auto itemNameOffset = builder.CreateString(item_name);
+            auto descriptionOffset = builder.CreateString(description);
+            return CreateItemData(builder, item_id, itemNameOffset, item_count, item_type,
+                base_price, attack_bonus, defense_bonus, hp_bonus, mp_bonus, descriptionOffset);
+        };
 
-        uint8_t* bufferPointer = builder.GetBufferPointer();
-        size_t bufferSize = builder.GetSize();
-        return std::vector<uint8_t>(bufferPointer, bufferPointer + bufferSize);
+        // gold는 조각마다 같은 값을 넣는다 (첫 행에서 읽은 값)
+        auto finishChunk = [&](flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<ItemData>>> itemsVector,
+            ResultCode result, bool has_more) {
+            auto itemResponse = CreateS2C_ItemData(builder, result, user_id, itemsVector, gold, has_more);
+            auto packet = CreateDatabasePacket(builder, EventType_S2C_ItemData, itemResponse.Union(), client_socket);
+            builder.Finish(packet);
+        };
+
+        SendRowsInChunks<ItemData>(builder, rows, encodeRow, finishChunk, sendChunk);
     }
     catch (const std::exception& e) {
         SetError("CreateItemDataResponseFromDB failed: " + std::string(e.what()));
-        return CreateItemDataErrorResponse(ResultCode_FAIL, user_id, client_socket);
+        rows->FreeResult();
+        sendChunk(CreateItemDataErrorResponse(ResultCode_FAIL, user_id, client_socket));
     }
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateMonsterDataResponseFromDB(MYSQL_RES* result, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateMonsterDataResponseFromDB(RowReader* rows, uint32_t client_socket)
 {
-    if (!IsValidMySQLResult(result)) {
+    if (!rows) {
         return CreateMonsterDataResponse(ResultCode_FAIL, client_socket);
     }
 
     ClearError();
     try {
-        flatbuffers::FlatBufferBuilder builder;
+        flatbuffers::FlatBufferBuilder builder(FLATBUFFER_INITIAL_SIZE, &PooledFlatBufferAllocator::Instance());
 
         std::vector<flatbuffers::Offset<MonsterData>> monsters;
 
-        MYSQL_ROW row;
-        while ((row = mysql_fetch_row(result))) {
-            uint32_t monster_id = GetUintFromRow(row, 0);
-            std::string monster_name = GetStringFromRow(row, 1);
-            uint32_t level = GetUintFromRow(row, 2);
-            uint32_t hp = GetUintFromRow(row, 3);
-            uint32_t attack = GetUintFromRow(row, 4);
-            uint32_t defense = GetUintFromRow(row, 5);
-            uint32_t exp_reward = GetUintFromRow(row, 6);
-            uint32_t gold_reward = GetUintFromRow(row, 7);
+        while (rows->Fetch()) {
+            uint32_t monster_id = rows->GetUInt(0);
+            std::string_view monster_name = rows->GetString(1);
+            uint32_t level = rows->GetUInt(2);
+            uint32_t hp = rows->GetUInt(3);
+            uint32_t attack = rows->GetUInt(4);
+            uint32_t defense = rows->GetUInt(5);
+            uint32_t exp_reward = rows->GetUInt(6);
+            uint32_t gold_reward = rows->GetUInt(7);
 
             auto monsterNameOffset = builder.CreateString(monster_name);
             auto monsterData = CreateMonsterData(builder, monster_id, monsterNameOffset, level, hp, attack, defense, exp_reward, gold_reward);
             monsters.push_back(monsterData);
         }
+        rows->FreeResult();
 
         auto monstersVector = builder.CreateVector(monsters);
         auto monsterResponse = CreateS2C_MonsterData(builder, ResultCode_SUCCESS, monstersVector);
@@ -797,7 +831,7 @@ std::vector<uint8_t> ServerPacketManager::CreateMonsterDataResponseFromDB(MYSQL_
         uint8_t* bufferPointer = builder.GetBufferPointer();
         size_t bufferSize = builder.GetSize();
 
-        return std::vector<uint8_t>(bufferPointer, bufferPointer + bufferSize);
+        return PacketBuffer::Copy(bufferPointer, bufferSize);
     }
     catch (const std::exception& e) {
         SetError("CreateMonsterDataResponseFromDB failed: " + std::string(e.what()));
@@ -805,75 +839,71 @@ std::vector<uint8_t> ServerPacketManager::CreateMonsterDataResponseFromDB(MYSQL_
     }
 }
 
-std::vector<uint8_t> ServerPacketManager::CreatePlayerChatResponseFromDB(MYSQL_RES* result, uint32_t client_socket)
+void ServerPacketManager::CreatePlayerChatResponseFromDB(RowReader* rows, const ResponseChunkSink& sendChunk, uint32_t client_socket)
 {
-    if (!IsValidMySQLResult(result)) {
-        return CreatePlayerChatResponse(ResultCode_FAIL, client_socket);
+    if (!rows) {
+        sendChunk(CreatePlayerChatResponse(ResultCode_FAIL, client_socket));
+        return;
     }
 
     ClearError();
     try {
-        flatbuffers::FlatBufferBuilder builder;
-
-        std::vector<flatbuffers::Offset<ChatData>> chats;
+        flatbuffers::FlatBufferBuilder builder(FLATBUFFER_INITIAL_SIZE, &PooledFlatBufferAllocator::Instance());
 
-        MYSQL_ROW row;
-        while ((row = mysql_fetch_row(result))) {
-            uint32_t chat_id = GetUintFromRow(row, 0);
-            uint32_t sender_id = GetUintFromRow(row, 1);
-            std::string sender_name = GetStringFromRow(row, 2);
-            std::string message = GetStringFromRow(row, 3);
-            uint32_t chat_type = GetUintFromRow(row, 4);
-            uint64_t timestamp = static_cast<uint64_t>(GetUintFromRow(row, 5));
+        auto encodeRow = [&]() {
+            uint32_t chat_id = rows->GetUInt(0);
+            uint32_t sender_id = rows->GetUInt(1);
+            std::string_view sender_name = rows->GetString(2);
+            std::string_view message = rows->GetString(3);
+            uint32_t chat_type = rows->GetUInt(4);
+            uint64_t timestamp = rows->GetUInt64(5);
 
             auto senderNameOffset = builder.CreateString(sender_name);
             auto messageOffset = builder.CreateString(message);
-            auto chatData = CreateChatData(builder, chat_id, sender_id, senderNameOffset, messageOffset, chat_type, timestamp);
-            chats.push_back(chatData);
-        }
+            return CreateChatData(builder, chat_id, sender_id, senderNameOffset, messageOffset, chat_type, timestamp);
+        };
 
-        auto chatsVector = builder.CreateVector(chats);
-        auto chatResponse = CreateS2C_PlayerChat(builder, ResultCode_SUCCESS, chatsVector);
-        auto packet = CreateDatabasePacket(builder, EventType_S2C_PlayerChat, chatResponse.Union(), client_socket);
+        auto finishChunk = [&](flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<ChatData>>> chatsVector,
+            ResultCode result, bool has_more) {
+            auto chatResponse = CreateS2C_PlayerChat(builder, result, chatsVector, has_more);
+            auto packet = CreateDatabasePacket(builder, EventType_S2C_PlayerChat, chatResponse.Union(), client_socket);
+            builder.Finish(packet);
+        };
 
-        builder.Finish(packet);
-
-        uint8_t* bufferPointer = builder.GetBufferPointer();
-        size_t bufferSize = builder.GetSize();
-
-        return std::vector<uint8_t>(bufferPointer, bufferPointer + bufferSize);
+        SendRowsInChunks<ChatData>(builder, rows, encodeRow, finishChunk, sendChunk);
     }
     catch (const std::exception& e) {
         SetError("CreatePlayerChatResponseFromDB failed: " + std::string(e.what()));
-        return CreatePlayerChatResponse(ResultCode_FAIL, client_socket);
+        rows->FreeResult();
+        sendChunk(CreatePlayerChatResponse(ResultCode_FAIL, client_socket));
     }
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateShopListResponseFromDB(MYSQL_RES* result, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateShopListResponseFromDB(RowReader* rows, uint32_t client_socket)
 {
-    if (!IsValidMySQLResult(result)) {
+    if (!rows) {
         return CreateShopListResponse(ResultCode_FAIL, client_socket);
     }
 
     ClearError();
     try {
-        flatbuffers::FlatBufferBuilder builder;
+        flatbuffers::FlatBufferBuilder builder(FLATBUFFER_INITIAL_SIZE, &PooledFlatBufferAllocator::Instance());
 
         std::vector<flatbuffers::Offset<ShopData>> shops;
 
-        MYSQL_ROW row;
-        while ((row = mysql_fetch_row(result))) {
-            uint32_t shop_id = GetUintFromRow(row, 0);
-            std::string shop_name = GetStringFromRow(row, 1);
-            uint32_t shop_type = GetUintFromRow(row, 2);
-            uint32_t map_id = GetUintFromRow(row, 3);
-            float pos_x = GetFloatFromRow(row, 4);
-            float pos_y = GetFloatFromRow(row, 5);
+        while (rows->Fetch()) {
+            uint32_t shop_id = rows->GetUInt(0);
+            std::string_view shop_name = rows->GetString(1);
+            uint32_t shop_type = rows->GetUInt(2);
+            uint32_t map_id = rows->GetUInt(3);
+            float pos_x = rows->GetFloat(4);
+            float pos_y = rows->GetFloat(5);
 
             auto shopNameOffset = builder.CreateString(shop_name);
             auto shopData = CreateShopData(builder, shop_id, shopNameOffset, shop_type, map_id, pos_x, pos_y);
             shops.push_back(shopData);
         }
+        rows->FreeResult();
 
         auto shopsVector = builder.CreateVector(shops);
         auto shopResponse = CreateS2C_ShopList(builder, ResultCode_SUCCESS, shopsVector);
@@ -884,7 +914,7 @@ std::vector<uint8_t> ServerPacketManager::CreateShopListResponseFromDB(MYSQL_RES
         uint8_t* bufferPointer = builder.GetBufferPointer();
         size_t bufferSize = builder.GetSize();
 
-        return std::vector<uint8_t>(bufferPointer, bufferPointer + bufferSize);
+        return PacketBuffer::Copy(bufferPointer, bufferSize);
     }
     catch (const std::exception& e) {
         SetError("CreateShopListResponseFromDB failed: " + std::string(e.what()));
@@ -892,36 +922,36 @@ std::vector<uint8_t> ServerPacketManager::CreateShopListResponseFromDB(MYSQL_RES
     }
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateShopItemsResponseFromDB(MYSQL_RES* result, uint32_t shop_id, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateShopItemsResponseFromDB(RowReader* rows, uint32_t shop_id, uint32_t client_socket)
 {
-    if (!IsValidMySQLResult(result)) {
+    if (!rows) {
         return CreateShopItemsResponse(ResultCode_FAIL, shop_id, client_socket);
     }
 
     ClearError();
     try {
-        flatbuffers::FlatBufferBuilder builder;
+        flatbuffers::FlatBufferBuilder builder(FLATBUFFER_INITIAL_SIZE, &PooledFlatBufferAllocator::Instance());
 
         std::vector<flatbuffers::Offset<ItemData>> items;
 
-        MYSQL_ROW row;
-        while ((row = mysql_fetch_row(result))) {
-            uint32_t item_id = GetUintFromRow(row, 0);
-            std::string item_name = GetStringFromRow(row, 1);
-            uint32_t item_type = GetUintFromRow(row, 2);
-            uint32_t base_price = GetUintFromRow(row, 3);
-            uint32_t attack_bonus = GetUintFromRow(row, 4);
-            uint32_t defense_bonus = GetUintFromRow(row, 5);
-            uint32_t hp_bonus = GetUintFromRow(row, 6);
-            uint32_t mp_bonus = GetUintFromRow(row, 7);
-            std::string description = GetStringFromRow(row, 8);
+        while (rows->Fetch()) {
+            uint32_t item_id = rows->GetUInt(0);
+            std::string_view item_name = rows->GetString(1);
+            uint32_t item_type = rows->GetUInt(2);
+            uint32_t base_price = rows->GetUInt(3);
+            uint32_t attack_bonus = rows->GetUInt(4);
+            uint32_t defense_bonus = rows->GetUInt(5);
+            uint32_t hp_bonus = rows->GetUInt(6);
+            uint32_t mp_bonus = rows->GetUInt(7);
+            std::string_view description = rows->GetString(8);
 
             auto itemNameOffset = builder.CreateString(item_name);
             auto descriptionOffset = builder.CreateString(description);
-            auto itemData = CreateItemData(builder, item_id, itemNameOffset, 1, item_type, //   1 
+            auto itemData = CreateItemData(builder, item_id, itemNameOffset, 1, item_type, // 상점에서는 수량 1로 설정
                 base_price, attack_bonus, defense_bonus, hp_bonus, mp_bonus, descriptionOffset);
             items.push_back(itemData);
         }
+        rows->FreeResult();
 
         auto itemsVector = builder.CreateVector(items);
         auto shopItemsResponse = CreateS2C_ShopItems(builder, ResultCode_SUCCESS, shop_id, itemsVector);
@@ -932,7 +962,7 @@ std::vector<uint8_t> ServerPacketManager::CreateShopItemsResponseFromDB(MYSQL_RE
         uint8_t* bufferPointer = builder.GetBufferPointer();
         size_t bufferSize = builder.GetSize();
 
-        return std::vector<uint8_t>(bufferPointer, bufferPointer + bufferSize);
+        return PacketBuffer::Copy(bufferPointer, bufferSize);
     }
     catch (const std::exception& e) {
         SetError("CreateShopItemsResponseFromDB failed: " + std::string(e.what()));
@@ -940,120 +970,116 @@ std::vector<uint8_t> ServerPacketManager::CreateShopItemsResponseFromDB(MYSQL_RE
     }
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateGameServerListResponseFromDB(MYSQL_RES* result, uint32_t client_socket)
+void ServerPacketManager::CreateGameServerListResponseFromDB(RowReader* rows, const ResponseChunkSink& sendChunk, uint32_t client_socket)
 {
-    if (!IsValidMySQLResult(result)) {
-        return CreateGameServerListResponse(ResultCode_FAIL, client_socket);
+    if (!rows) {
+        sendChunk(CreateGameServerListResponse(ResultCode_FAIL, client_socket));
+        return;
     }
 
     ClearError();
     try {
-        flatbuffers::FlatBufferBuilder builder;
-
-        std::vector<flatbuffers::Offset<GameServerData>> servers;
-
-        MYSQL_ROW row;
-        while ((row = mysql_fetch_row(result))) {
-            uint32_t server_id = GetUintFromRow(row, 0);
-            std::string server_name = GetStringFromRow(row, 1);
-            std::string server_ip = GetStringFromRow(row, 2);
-            uint32_t server_port = GetUintFromRow(row, 3);
-            uint32_t owner_user_id = GetUintFromRow(row, 4);
-            std::string owner_nickname = GetStringFromRow(row, 5);
-            uint32_t current_players = GetUintFromRow(row, 6);
-            uint32_t max_players = GetUintFromRow(row, 7);
-            bool has_password = GetStringFromRow(row, 8) != ""; // password   true
+        flatbuffers::FlatBufferBuilder builder(FLATBUFFER_INITIAL_SIZE, &PooledFlatBufferAllocator::Instance());
+
+        auto encodeRow = [&]() {
+            uint32_t server_id = rows->GetUInt(0);
+            std::string_view server_name = rows->GetString(1);
+            std::string_view server_ip = rows->GetString(2);
+            uint32_t server_port = rows->GetUInt(3);
+            uint32_t owner_user_id = rows->GetUInt(4);
+            std::string_view owner_nickname = rows->GetString(5);
+            uint32_t current_players = rows->GetUInt(6);
+            uint32_t max_players = rows->GetUInt(7);
+            bool has_password = rows->GetUInt(8) != 0; // password가 비어있지 않으면 1
 
             auto serverNameOffset = builder.CreateString(server_name);
             auto serverIpOffset = builder.CreateString(server_ip);
             auto ownerNicknameOffset = builder.CreateString(owner_nickname);
 
-            auto gameServerData = CreateGameServerData(builder, server_id, serverNameOffset,
+            return CreateGameServerData(builder, server_id, serverNameOffset,
                 serverIpOffset, server_port, owner_user_id, ownerNicknameOffset,
                 current_players, max_players, has_password);
-            servers.push_back(gameServerData);
-        }
+        };
 
-        auto serversVector = builder.CreateVector(servers);
-        auto gameServerListResponse = CreateS2C_GameServerList(builder, ResultCode_SUCCESS, serversVector);
-        auto packet = CreateDatabasePacket(builder, EventType_S2C_GameServerList, gameServerListResponse.Union(), client_socket);
+        auto finishChunk = [&](flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<GameServerData>>> serversVector,
+            ResultCode result, bool has_more) {
+            auto gameServerListResponse = CreateS2C_GameServerList(builder, result, serversVector, has_more);
+            auto packet = CreateDatabasePacket(builder, EventType_S2C_GameServerList, gameServerListResponse.Union(), client_socket);
+            builder.Finish(packet);
+        };
 
-        builder.Finish(packet);
-
-        uint8_t* bufferPointer = builder.GetBufferPointer();
-        size_t bufferSize = builder.GetSize();
-
-        return std::vector<uint8_t>(bufferPointer, bufferPointer + bufferSize);
+        SendRowsInChunks<GameServerData>(builder, rows, encodeRow, finishChunk, sendChunk);
     }
     catch (const std::exception& e) {
         SetError("CreateGameServerListResponseFromDB failed: " + std::string(e.what()));
-        return CreateGameServerListResponse(ResultCode_FAIL, client_socket);
+        rows->FreeResult();
+        sendChunk(CreateGameServerListResponse(ResultCode_FAIL, client_socket));
     }
 }
 
-// ===     ===
+// === 간편한 에러 응답 생성 ===
 
-std::vector<uint8_t> ServerPacketManager::CreateLoginErrorResponse(ResultCode error_code, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateLoginErrorResponse(ResultCode error_code, uint32_t client_socket)
 {
     return CreateLoginResponse(error_code, 0, "", "", 0, client_socket);
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateAccountErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateAccountErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket)
 {
     return CreateAccountResponse(error_code, 0, message, client_socket);
 }
 
-std::vector<uint8_t> ServerPacketManager::CreatePlayerDataErrorResponse(ResultCode error_code, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreatePlayerDataErrorResponse(ResultCode error_code, uint32_t client_socket)
 {
     return CreatePlayerDataResponse(error_code, 0, "", "", 0, 0, 0, 0, 0, 0, 0, 0, 0.0f, 0.0f, client_socket);
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateItemDataErrorResponse(ResultCode error_code, uint32_t user_id, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateItemDataErrorResponse(ResultCode error_code, uint32_t user_id, uint32_t client_socket)
 {
     return CreateItemDataResponse(error_code, user_id, 0, client_socket);
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateShopListErrorResponse(ResultCode error_code, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateShopListErrorResponse(ResultCode error_code, uint32_t client_socket)
 {
     return CreateShopListResponse(error_code, client_socket);
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateShopItemsErrorResponse(ResultCode error_code, uint32_t shop_id, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateShopItemsErrorResponse(ResultCode error_code, uint32_t shop_id, uint32_t client_socket)
 {
     return CreateShopItemsResponse(error_code, shop_id, client_socket);
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateShopTransactionErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateShopTransactionErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket)
 {
     return CreateShopTransactionResponse(error_code, message, 0, client_socket);
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateGameServerErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateGameServerErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket)
 {
     return CreateGameServerResponse(error_code, 0, message, client_socket);
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateGameServerListErrorResponse(ResultCode error_code, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateGameServerListErrorResponse(ResultCode error_code, uint32_t client_socket)
 {
     return CreateGameServerListResponse(error_code, client_socket);
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateJoinGameServerErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateJoinGameServerErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket)
 {
     return CreateJoinGameServerResponse(error_code, "", 0, message, client_socket);
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateCloseGameServerErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateCloseGameServerErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket)
 {
     return CreateCloseGameServerResponse(error_code, message, client_socket);
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateSavePlayerDataErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateSavePlayerDataErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket)
 {
     return CreateSavePlayerDataResponse(error_code, message, client_socket);
 }
 
-std::vector<uint8_t> ServerPacketManager::CreateGenericErrorResponse(EventType response_type, ResultCode error_code, uint32_t client_socket)
+PacketBuffer ServerPacketManager::CreateGenericErrorResponse(EventType response_type, ResultCode error_code, uint32_t client_socket)
 {
     switch (response_type) {
     case EventType_S2C_Login:
@@ -1070,7 +1096,7 @@ std::vector<uint8_t> ServerPacketManager::CreateGenericErrorResponse(EventType r
         return CreateShopItemsErrorResponse(error_code, 0, client_socket);
     case EventType_S2C_ShopTransaction:
         return CreateShopTransactionErrorResponse(error_code, "Generic error", client_socket);
-        //    ߰
+        // 게임 서버 관련 추가
     case EventType_S2C_CreateGameServer:
         return CreateGameServerErrorResponse(error_code, "Generic error", client_socket);
     case EventType_S2C_GameServerList:
@@ -1083,33 +1109,11 @@ std::vector<uint8_t> ServerPacketManager::CreateGenericErrorResponse(EventType r
         return CreateSavePlayerDataErrorResponse(error_code, "Generic error", client_socket);
     default:
         SetError("Unsupported response type for generic error");
-        return std::vector<uint8_t>();
+        return PacketBuffer();
     }
 }
 
-// === MySQL  Լ ===
-
-std::string ServerPacketManager::GetStringFromRow(MYSQL_ROW row, int index)
-{
-    return row && row[index] ? std::string(row[index]) : std::string();
-}
-
-uint32_t ServerPacketManager::GetUintFromRow(MYSQL_ROW row, int index)
-{
-    return row && row[index] ? static_cast<uint32_t>(std::stoul(row[index])) : 0;
-}
-
-float ServerPacketManager::GetFloatFromRow(MYSQL_ROW row, int index)
-{
-    return row && row[index] ? std::stof(row[index]) : 0.0f;
-}
-
-bool ServerPacketManager::IsValidMySQLResult(MYSQL_RES* result)
-{
-    return result != nullptr;
-}
-
-// === û   Լ ===
+// === 요청 검증 헬퍼 함수들 ===
 
 bool ServerPacketManager::ValidateLoginRequest(const C2S_Login* request)
 {
@@ -1183,7 +1187,7 @@ bool ServerPacketManager::ValidatePlayerDataRequest(const C2S_PlayerData* reques
         return false;
     }
 
-    // request_type: 0 = ȸ, 1 = Ʈ
+    // request_type: 0 = 조회, 1 = 업데이트
     if (request->request_type() > 1) {
         SetError("Invalid request type");
         return false;
@@ -1204,7 +1208,7 @@ bool ServerPacketManager::ValidateItemDataRequest(const C2S_ItemData* request)
         return false;
     }
 
-    // request_type: 0 = ȸ, 1 = ߰, 2 = , 3 = 
+    // request_type: 0 = 조회, 1 = 추가, 2 = 삭제, 3 = 사용
     if (request->request_type() > 3) {
         SetError("Invalid request type");
         return false;
@@ -1220,7 +1224,7 @@ bool ServerPacketManager::ValidateShopListRequest(const C2S_ShopList* request)
         return false;
     }
 
-    // request_type: 0 = ȸ
+    // request_type: 0 = 상점목록조회
     if (request->request_type() > 0) {
         SetError("Invalid request type");
         return false;
@@ -1271,7 +1275,7 @@ bool ServerPacketManager::ValidateShopTransactionRequest(const C2S_ShopTransacti
         return false;
     }
 
-    // transaction_type: 0 = , 1 = Ǹ
+    // transaction_type: 0 = 구매, 1 = 판매
     if (request->transaction_type() > 1) {
         SetError("Invalid transaction type");
         return false;
@@ -1327,7 +1331,7 @@ bool ServerPacketManager::ValidateGameServerListRequest(const C2S_GameServerList
         return false;
     }
 
-    // request_type: 0 = üȸ
+    // request_type: 0 = 전체조회
     if (request->request_type() > 0) {
         SetError("Invalid request type");
         return false;
@@ -1388,7 +1392,7 @@ bool ServerPacketManager::ValidateSavePlayerDataRequest(const C2S_SavePlayerData
         return false;
     }
 
-    // , ġ  ȿ ˻
+    // 레벨, 경험치 등의 유효성 검사
     if (request->level() == 0 || request->level() > 1000) {
         SetError("Invalid level");
         return false;
@@ -1397,7 +1401,7 @@ bool ServerPacketManager::ValidateSavePlayerDataRequest(const C2S_SavePlayerData
     return true;
 }
 
-// === ƿƼ Լ ===
+// === 유틸리티 함수들 ===
 
 EventType ServerPacketManager::GetPacketType(const uint8_t* data, size_t size)
 {
@@ -1409,6 +1413,30 @@ EventType ServerPacketManager::GetPacketType(const uint8_t* data, size_t size)
     return packet ? packet->packet_event_type() : EventType_NONE;
 }
 
+// union 값은 없어도 검증을 통과하므로 요청 테이블이 비어 있으면 0
+template <typename T>
+static uint32_t UserIdOf(const T* request)
+{
+    return request ? request->user_id() : 0;
+}
+
+uint32_t ServerPacketManager::GetRequestUserId(const uint8_t* data, EventType packet_type)
+{
+    const DatabasePacket* packet = GetDatabasePacket(data);
+
+    switch (packet_type) {
+    case EventType_C2S_Logout: return UserIdOf(packet->packet_event_as_C2S_Logout());
+    case EventType_C2S_ItemData: return UserIdOf(packet->packet_event_as_C2S_ItemData());
+    case EventType_C2S_ShopTransaction: return UserIdOf(packet->packet_event_as_C2S_ShopTransaction());
+    case EventType_C2S_PlayerData: return UserIdOf(packet->packet_event_as_C2S_PlayerData());
+    case EventType_C2S_CreateGameServer: return UserIdOf(packet->packet_event_as_C2S_CreateGameServer());
+    case EventType_C2S_JoinGameServer: return UserIdOf(packet->packet_event_as_C2S_JoinGameServer());
+    case EventType_C2S_CloseGameServer: return UserIdOf(packet->packet_event_as_C2S_CloseGameServer());
+    case EventType_C2S_SavePlayerData: return UserIdOf(packet->packet_event_as_C2S_SavePlayerData());
+    default: return 0;
+    }
+}
+
 uint32_t ServerPacketManager::GetClientSocket(const uint8_t* data, size_t size)
 {
     if (!VerifyPacket(data, size)) {
@@ -1461,6 +1489,28 @@ std::string ServerPacketManager::GetPacketTypeName(EventType packet_type)
     }
 }
 
+EventType ServerPacketManager::GetResponseType(EventType request_type)
+{
+    switch (request_type) {
+    case EventType_C2S_Login: return EventType_S2C_Login;
+    case EventType_C2S_Logout: return EventType_S2C_Logout;
+    case EventType_C2S_CreateAccount: return EventType_S2C_CreateAccount;
+    case EventType_C2S_ItemData: return EventType_S2C_ItemData;
+    case EventType_C2S_PlayerData: return EventType_S2C_PlayerData;
+    case EventType_C2S_MonsterData: return EventType_S2C_MonsterData;
+    case EventType_C2S_PlayerChat: return EventType_S2C_PlayerChat;
+    case EventType_C2S_ShopList: return EventType_S2C_ShopList;
+    case EventType_C2S_ShopItems: return EventType_S2C_ShopItems;
+    case EventType_C2S_ShopTransaction: return EventType_S2C_ShopTransaction;
+    case EventType_C2S_CreateGameServer: return EventType_S2C_CreateGameServer;
+    case EventType_C2S_GameServerList: return EventType_S2C_GameServerList;
+    case EventType_C2S_JoinGameServer: return EventType_S2C_JoinGameServer;
+    case EventType_C2S_CloseGameServer: return EventType_S2C_CloseGameServer;
+    case EventType_C2S_SavePlayerData: return EventType_S2C_SavePlayerData;
+    default: return EventType_NONE;
+    }
+}
+
 std::string ServerPacketManager::GetResultCodeName(ResultCode result)
 {
     switch (result) {
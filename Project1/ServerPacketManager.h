@@ -3,9 +3,18 @@
 #include <vector>
 #include <string>
 #include <cstdint>
+#include <functional>
 #include <mysql.h>
+#include "PacketBuffer.h"
+#include "RowReader.h"
 
-//  
+#define FLATBUFFER_INITIAL_SIZE 1024  // 응답 빌더 초기 버퍼 크기 (BufferPool 1KB 등급)
+#define DB_RESPONSE_CHUNK_SIZE 16384  // 목록 응답 한 조각의 목표 크기 (프레임 상한 64KB보다 충분히 작게)
+
+// 목록 응답 조각을 하나씩 받아 보내는 함수 (조각이 만들어지는 대로 호출됨)
+typedef std::function<void(PacketBuffer&&)> ResponseChunkSink;
+
+// 전방 선언
 struct DatabasePacket;
 struct C2S_Login;
 struct C2S_Logout;
@@ -18,7 +27,7 @@ struct C2S_ShopList;
 struct C2S_ShopItems;
 struct C2S_ShopTransaction;
 
-//    ü   ߰
+// 게임 서버 관련 구조체 전방 선언 추가
 struct C2S_CreateGameServer;
 struct C2S_GameServerList;
 struct C2S_JoinGameServer;
@@ -28,7 +37,7 @@ struct C2S_SavePlayerData;
 enum EventType : uint8_t;
 enum ResultCode : int8_t;
 
-//  Ŷ Ŵ Ŭ
+// 서버용 패킷 매니저 클래스
 class ServerPacketManager
 {
 private:
@@ -42,249 +51,243 @@ public:
     ServerPacketManager();
     ~ServerPacketManager();
 
-    // === Ŭ̾Ʈ û Ŷ Ľ (C2S) ===
-    // FlatBuffers ü ͸  ȯ
+    // === 클라이언트 요청 패킷 파싱 (C2S) ===
+    // FlatBuffers 구조체 포인터를 직접 반환
 
-    // α û Ľ
+    // 로그인 요청 파싱
     const C2S_Login* ParseLoginRequest(const uint8_t* data, size_t size);
 
-    // α׾ƿ û Ľ
+    // 로그아웃 요청 파싱
     const C2S_Logout* ParseLogoutRequest(const uint8_t* data, size_t size);
 
-    //   û Ľ
+    // 계정 생성 요청 파싱
     const C2S_CreateAccount* ParseCreateAccountRequest(const uint8_t* data, size_t size);
 
-    //   û Ľ
+    // 아이템 데이터 요청 파싱
     const C2S_ItemData* ParseItemDataRequest(const uint8_t* data, size_t size);
 
-    // ÷̾  û Ľ
+    // 플레이어 데이터 요청 파싱
     const C2S_PlayerData* ParsePlayerDataRequest(const uint8_t* data, size_t size);
 
-    //   û Ľ
+    // 몬스터 데이터 요청 파싱
     const C2S_MonsterData* ParseMonsterDataRequest(const uint8_t* data, size_t size);
 
-    // ä û Ľ
+    // 채팅 요청 파싱
     const C2S_PlayerChat* ParsePlayerChatRequest(const uint8_t* data, size_t size);
 
-    //   û Ľ
+    // 상점 목록 요청 파싱
     const C2S_ShopList* ParseShopListRequest(const uint8_t* data, size_t size);
 
-    //   û Ľ
+    // 상점 아이템 요청 파싱
     const C2S_ShopItems* ParseShopItemsRequest(const uint8_t* data, size_t size);
 
-    //  ŷ û Ľ
+    // 상점 거래 요청 파싱
     const C2S_ShopTransaction* ParseShopTransactionRequest(const uint8_t* data, size_t size);
 
-    // ===    Ŭ̾Ʈ û Ŷ Ľ (C2S) ߰ ===
+    // === 게임 서버 관련 클라이언트 요청 패킷 파싱 (C2S) 추가 ===
 
-    //    û Ľ
+    // 게임 서버 생성 요청 파싱
     const C2S_CreateGameServer* ParseCreateGameServerRequest(const uint8_t* data, size_t size);
 
-    //    û Ľ
+    // 게임 서버 목록 요청 파싱
     const C2S_GameServerList* ParseGameServerListRequest(const uint8_t* data, size_t size);
 
-    //    û Ľ
+    // 게임 서버 접속 요청 파싱
     const C2S_JoinGameServer* ParseJoinGameServerRequest(const uint8_t* data, size_t size);
 
-    //    û Ľ
+    // 게임 서버 종료 요청 파싱
     const C2S_CloseGameServer* ParseCloseGameServerRequest(const uint8_t* data, size_t size);
 
-    // ÷̾   û Ľ
+    // 플레이어 데이터 저장 요청 파싱
     const C2S_SavePlayerData* ParseSavePlayerDataRequest(const uint8_t* data, size_t size);
 
-    // ===   Ŷ  (S2C) ===
+    // === 서버 응답 패킷 생성 (S2C) ===
 
-    // α  
-    std::vector<uint8_t> CreateLoginResponse(ResultCode result, uint32_t user_id, const std::string& username, const std::string& nickname, uint32_t level, uint32_t client_socket = 0);
+    // 로그인 응답 생성
+    PacketBuffer CreateLoginResponse(ResultCode result, uint32_t user_id, const std::string& username, const std::string& nickname, uint32_t level, uint32_t client_socket = 0);
 
-    // α׾ƿ  
-    std::vector<uint8_t> CreateLogoutResponse(ResultCode result, const std::string& message, uint32_t client_socket = 0);
+    // 로그아웃 응답 생성
+    PacketBuffer CreateLogoutResponse(ResultCode result, const std::string& message, uint32_t client_socket = 0);
 
-    //    
-    std::vector<uint8_t> CreateAccountResponse(ResultCode result, uint32_t user_id, const std::string& message, uint32_t client_socket = 0);
+    // 계정 생성 응답 생성
+    PacketBuffer CreateAccountResponse(ResultCode result, uint32_t user_id, const std::string& message, uint32_t client_socket = 0);
 
-    //     ( ϵڵ)
-    std::vector<uint8_t> CreateItemDataResponse(ResultCode result, uint32_t user_id, uint32_t gold, uint32_t client_socket = 0);
+    // 아이템 데이터 응답 생성 (개별 하드코딩)
+    PacketBuffer CreateItemDataResponse(ResultCode result, uint32_t user_id, uint32_t gold, uint32_t client_socket = 0);
 
-    // ÷̾   
-    std::vector<uint8_t> CreatePlayerDataResponse(ResultCode result, uint32_t user_id, const std::string& username, const std::string& nickname,
+    // 플레이어 데이터 응답 생성
+    PacketBuffer CreatePlayerDataResponse(ResultCode result, uint32_t user_id, const std::string& username, const std::string& nickname,
         uint32_t level, uint32_t exp, uint32_t hp, uint32_t mp, uint32_t attack,
         uint32_t defense, uint32_t gold, uint32_t map_id, float pos_x, float pos_y, uint32_t client_socket = 0);
 
-    //    
-    std::vector<uint8_t> CreateMonsterDataResponse(ResultCode result, uint32_t client_socket = 0);
-
-    // ä  
-    std::vector<uint8_t> CreatePlayerChatResponse(ResultCode result, uint32_t client_socket = 0);
-
-    //    
-    std::vector<uint8_t> CreateShopListResponse(ResultCode result, uint32_t client_socket = 0);
+    // 몬스터 데이터 응답 생성
+    PacketBuffer CreateMonsterDataResponse(ResultCode result, uint32_t client_socket = 0);
 
-    //    
-    std::vector<uint8_t> CreateShopItemsResponse(ResultCode result, uint32_t shop_id, uint32_t client_socket = 0);
+    // 채팅 응답 생성
+    PacketBuffer CreatePlayerChatResponse(ResultCode result, uint32_t client_socket = 0);
 
-    //  ŷ  
-    std::vector<uint8_t> CreateShopTransactionResponse(ResultCode result, const std::string& message, uint32_t updated_gold, uint32_t client_socket = 0);
+    // 상점 목록 응답 생성
+    PacketBuffer CreateShopListResponse(ResultCode result, uint32_t client_socket = 0);
 
-    // ===      Ŷ  (S2C) ߰ ===
+    // 상점 아이템 응답 생성
+    PacketBuffer CreateShopItemsResponse(ResultCode result, uint32_t shop_id, uint32_t client_socket = 0);
 
-    //     
-    std::vector<uint8_t> CreateGameServerResponse(ResultCode result, uint32_t server_id, const std::string& message, uint32_t client_socket = 0);
+    // 상점 거래 응답 생성
+    PacketBuffer CreateShopTransactionResponse(ResultCode result, const std::string& message, uint32_t updated_gold, uint32_t client_socket = 0);
 
-    //     
-    std::vector<uint8_t> CreateGameServerListResponse(ResultCode result, uint32_t client_socket = 0);
+    // === 게임 서버 관련 서버 응답 패킷 생성 (S2C) 추가 ===
 
-    //     
-    std::vector<uint8_t> CreateJoinGameServerResponse(ResultCode result, const std::string& server_ip, uint32_t server_port, const std::string& message, uint32_t client_socket = 0);
+    // 게임 서버 생성 응답 생성
+    PacketBuffer CreateGameServerResponse(ResultCode result, uint32_t server_id, const std::string& message, uint32_t client_socket = 0);
 
-    //     
-    std::vector<uint8_t> CreateCloseGameServerResponse(ResultCode result, const std::string& message, uint32_t client_socket = 0);
+    // 게임 서버 목록 응답 생성
+    PacketBuffer CreateGameServerListResponse(ResultCode result, uint32_t client_socket = 0);
 
-    // ÷̾    
-    std::vector<uint8_t> CreateSavePlayerDataResponse(ResultCode result, const std::string& message, uint32_t client_socket = 0);
+    // 게임 서버 접속 응답 생성
+    PacketBuffer CreateJoinGameServerResponse(ResultCode result, const std::string& server_ip, uint32_t server_port, const std::string& message, uint32_t client_socket = 0);
 
-    // === MySQL    Ŷ  ( ) ===
+    // 게임 서버 종료 응답 생성
+    PacketBuffer CreateCloseGameServerResponse(ResultCode result, const std::string& message, uint32_t client_socket = 0);
 
-    // MySQL α   Ŷ 
-    std::vector<uint8_t> CreateLoginResponseFromDB(MYSQL_RES* result, const std::string& username, uint32_t client_socket = 0);
+    // 플레이어 데이터 저장 응답 생성
+    PacketBuffer CreateSavePlayerDataResponse(ResultCode result, const std::string& message, uint32_t client_socket = 0);
 
-    // MySQL ÷̾    Ŷ 
-    std::vector<uint8_t> CreatePlayerDataResponseFromDB(MYSQL_RES* result, uint32_t user_id, uint32_t client_socket = 0);
+    // === DB 결과 행에서 직접 응답 패킷 생성 (서버 내용, 행을 모두 읽고 결과를 해제) ===
+    // 길어질 수 있는 목록(인벤토리, 채팅, 게임 서버 목록)은 행을 읽는 대로 DB_RESPONSE_CHUNK_SIZE 안팎의
+    // 조각으로 나눠 sendChunk로 넘긴다. 마지막 조각만 has_more가 false이고, 행이 없어도 빈 조각 하나는 보낸다.
+    // 중간에 읽기가 실패하면 마지막 조각의 result가 FAIL이다.
 
-    // MySQL     Ŷ  ( Ʈ )
-    std::vector<uint8_t> CreateItemDataResponseFromDB(MYSQL_RES* result, uint32_t user_id, uint32_t client_socket = 0);
+    // MySQL 로그인 결과로 응답 패킷 생성
+    PacketBuffer CreateLoginResponseFromDB(RowReader* rows, const std::string& username, uint32_t client_socket = 0);
 
-    // MySQL     Ŷ 
-    std::vector<uint8_t> CreateMonsterDataResponseFromDB(MYSQL_RES* result, uint32_t client_socket = 0);
+    // MySQL 플레이어 데이터 결과로 응답 패킷 생성
+    PacketBuffer CreatePlayerDataResponseFromDB(RowReader* rows, uint32_t user_id, uint32_t client_socket = 0);
 
-    // MySQL ä    Ŷ 
-    std::vector<uint8_t> CreatePlayerChatResponseFromDB(MYSQL_RES* result, uint32_t client_socket = 0);
+    // MySQL 아이템 데이터 결과로 응답 패킷 생성 (아이템 리스트 포함, 조각 단위)
+    void CreateItemDataResponseFromDB(RowReader* rows, uint32_t user_id, const ResponseChunkSink& sendChunk, uint32_t client_socket = 0);
 
-    // MySQL     Ŷ 
-    std::vector<uint8_t> CreateShopListResponseFromDB(MYSQL_RES* result, uint32_t client_socket = 0);
+    // MySQL 몬스터 데이터 결과로 응답 패킷 생성
+    PacketBuffer CreateMonsterDataResponseFromDB(RowReader* rows, uint32_t client_socket = 0);
 
-    // MySQL     Ŷ 
-    std::vector<uint8_t> CreateShopItemsResponseFromDB(MYSQL_RES* result, uint32_t shop_id, uint32_t client_socket = 0);
+    // MySQL 채팅 데이터 결과로 응답 패킷 생성 (조각 단위)
+    void CreatePlayerChatResponseFromDB(RowReader* rows, const ResponseChunkSink& sendChunk, uint32_t client_socket = 0);
 
-    // ===    MySQL   Ŷ  ߰ ===
+    // MySQL 상점 목록 결과로 응답 패킷 생성
+    PacketBuffer CreateShopListResponseFromDB(RowReader* rows, uint32_t client_socket = 0);
 
-    // MySQL      Ŷ 
-    std::vector<uint8_t> CreateGameServerListResponseFromDB(MYSQL_RES* result, uint32_t client_socket = 0);
+    // MySQL 상점 아이템 결과로 응답 패킷 생성
+    PacketBuffer CreateShopItemsResponseFromDB(RowReader* rows, uint32_t shop_id, uint32_t client_socket = 0);
 
-    // ===     ===
+    // === 게임 서버 관련 MySQL 결과에서 응답 패킷 생성 추가 ===
 
-    // α  
-    std::vector<uint8_t> CreateLoginErrorResponse(ResultCode error_code, uint32_t client_socket = 0);
+    // MySQL 게임 서버 목록 결과로 응답 패킷 생성 (조각 단위)
+    void CreateGameServerListResponseFromDB(RowReader* rows, const ResponseChunkSink& sendChunk, uint32_t client_socket = 0);
 
-    //    
-    std::vector<uint8_t> CreateAccountErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket = 0);
+    // === 간편한 에러 응답 생성 ===
 
-    // ÷̾   
-    std::vector<uint8_t> CreatePlayerDataErrorResponse(ResultCode error_code, uint32_t client_socket = 0);
+    // 로그인 실패 응답
+    PacketBuffer CreateLoginErrorResponse(ResultCode error_code, uint32_t client_socket = 0);
 
-    //    
-    std::vector<uint8_t> CreateItemDataErrorResponse(ResultCode error_code, uint32_t user_id, uint32_t client_socket = 0);
+    // 계정 생성 실패 응답
+    PacketBuffer CreateAccountErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket = 0);
 
-    //    
-    std::vector<uint8_t> CreateShopListErrorResponse(ResultCode error_code, uint32_t client_socket = 0);
+    // 플레이어 데이터 실패 응답
+    PacketBuffer CreatePlayerDataErrorResponse(ResultCode error_code, uint32_t client_socket = 0);
 
-    //    
-    std::vector<uint8_t> CreateShopItemsErrorResponse(ResultCode error_code, uint32_t shop_id, uint32_t client_socket = 0);
+    // 아이템 데이터 실패 응답
+    PacketBuffer CreateItemDataErrorResponse(ResultCode error_code, uint32_t user_id, uint32_t client_socket = 0);
 
-    //  ŷ  
-    std::vector<uint8_t> CreateShopTransactionErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket = 0);
+    // 상점 목록 실패 응답
+    PacketBuffer CreateShopListErrorResponse(ResultCode error_code, uint32_t client_socket = 0);
 
-    // ===       ߰ ===
+    // 상점 아이템 실패 응답
+    PacketBuffer CreateShopItemsErrorResponse(ResultCode error_code, uint32_t shop_id, uint32_t client_socket = 0);
 
-    //     
-    std::vector<uint8_t> CreateGameServerErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket = 0);
+    // 상점 거래 실패 응답
+    PacketBuffer CreateShopTransactionErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket = 0);
 
-    //     
-    std::vector<uint8_t> CreateGameServerListErrorResponse(ResultCode error_code, uint32_t client_socket = 0);
+    // === 게임 서버 관련 에러 응답 생성 추가 ===
 
-    //     
-    std::vector<uint8_t> CreateJoinGameServerErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket = 0);
+    // 게임 서버 생성 실패 응답
+    PacketBuffer CreateGameServerErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket = 0);
 
-    //     
-    std::vector<uint8_t> CreateCloseGameServerErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket = 0);
+    // 게임 서버 목록 실패 응답
+    PacketBuffer CreateGameServerListErrorResponse(ResultCode error_code, uint32_t client_socket = 0);
 
-    // ÷̾    
-    std::vector<uint8_t> CreateSavePlayerDataErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket = 0);
+    // 게임 서버 접속 실패 응답
+    PacketBuffer CreateJoinGameServerErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket = 0);
 
-    // Ϲ   
-    std::vector<uint8_t> CreateGenericErrorResponse(EventType response_type, ResultCode error_code, uint32_t client_socket = 0);
+    // 게임 서버 종료 실패 응답
+    PacketBuffer CreateCloseGameServerErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket = 0);
 
-    // === MySQL  Լ ===
+    // 플레이어 데이터 저장 실패 응답
+    PacketBuffer CreateSavePlayerDataErrorResponse(ResultCode error_code, const std::string& message, uint32_t client_socket = 0);
 
-    // MySQL    ڿ  
-    std::string GetStringFromRow(MYSQL_ROW row, int index);
+    // 일반적인 에러 응답 생성
+    PacketBuffer CreateGenericErrorResponse(EventType response_type, ResultCode error_code, uint32_t client_socket = 0);
 
-    // MySQL      
-    uint32_t GetUintFromRow(MYSQL_ROW row, int index);
+    // === 요청 검증 헬퍼 함수들 ===
 
-    // MySQL    Ǽ  
-    float GetFloatFromRow(MYSQL_ROW row, int index);
-
-    // MySQL   (NULL üũ )
-    bool IsValidMySQLResult(MYSQL_RES* result);
-
-    // === û   Լ ===
-
-    // α û ȿ ˻
+    // 로그인 요청 유효성 검사
     bool ValidateLoginRequest(const C2S_Login* request);
 
-    //   û ȿ ˻
+    // 계정 생성 요청 유효성 검사
     bool ValidateCreateAccountRequest(const C2S_CreateAccount* request);
 
-    // ÷̾  û ȿ ˻
+    // 플레이어 데이터 요청 유효성 검사
     bool ValidatePlayerDataRequest(const C2S_PlayerData* request);
 
-    //   û ȿ ˻
+    // 아이템 데이터 요청 유효성 검사
     bool ValidateItemDataRequest(const C2S_ItemData* request);
 
-    //   û ȿ ˻
+    // 상점 목록 요청 유효성 검사
     bool ValidateShopListRequest(const C2S_ShopList* request);
 
-    //   û ȿ ˻
+    // 상점 아이템 요청 유효성 검사
     bool ValidateShopItemsRequest(const C2S_ShopItems* request);
 
-    //  ŷ û ȿ ˻
+    // 상점 거래 요청 유효성 검사
     bool ValidateShopTransactionRequest(const C2S_ShopTransaction* request);
 
-    // ===    û   Լ ߰ ===
+    // === 게임 서버 관련 요청 검증 헬퍼 함수들 추가 ===
 
-    //    û ȿ ˻
+    // 게임 서버 생성 요청 유효성 검사
     bool ValidateCreateGameServerRequest(const C2S_CreateGameServer* request);
 
-    //    û ȿ ˻
+    // 게임 서버 목록 요청 유효성 검사
     bool ValidateGameServerListRequest(const C2S_GameServerList* request);
 
-    //    û ȿ ˻
+    // 게임 서버 접속 요청 유효성 검사
     bool ValidateJoinGameServerRequest(const C2S_JoinGameServer* request);
 
-    //    û ȿ ˻
+    // 게임 서버 종료 요청 유효성 검사
     bool ValidateCloseGameServerRequest(const C2S_CloseGameServer* request);
 
-    // ÷̾   û ȿ ˻
+    // 플레이어 데이터 저장 요청 유효성 검사
     bool ValidateSavePlayerDataRequest(const C2S_SavePlayerData* request);
 
-    // === ƿƼ Լ ===
+    // === 유틸리티 함수들 ===
 
-    // Ŷ Ÿ Ȯ (EventType enum ȯ)
+    // 패킷 타입 확인 (EventType enum 반환)
     EventType GetPacketType(const uint8_t* data, size_t size);
 
-    // Ŭ̾Ʈ   Ȯ
+    // 요청에 실린 user_id (user_id가 없는 요청이면 0, 이미 검증한 패킷에만 사용)
+    uint32_t GetRequestUserId(const uint8_t* data, EventType packet_type);
+
+    // 클라이언트 소켓 정보 확인
     uint32_t GetClientSocket(const uint8_t* data, size_t size);
 
-    // Ŷ 
+    // 패킷 검증
     bool IsValidPacket(const uint8_t* data, size_t size);
 
-    // Ŷ Ÿ ڿ ȯ ()
+    // 패킷 타입을 문자열로 변환 (디버깅용)
     std::string GetPacketTypeName(EventType packet_type);
+    // 요청 타입에 대응하는 응답 타입 (C2S_X -> S2C_X, 요청이 아니면 EventType_NONE)
+    EventType GetResponseType(EventType request_type);
 
-    //  ڵ带 ڿ ȯ ()
+    // 결과 코드를 문자열로 변환 (디버깅용)
     std::string GetResultCodeName(ResultCode result);
 
-    //  ޽ ȯ
+    // 에러 메시지 반환
     std::string GetLastError() const { return _last_error; }
 };
\ No newline at end of file
@@ -0,0 +1,127 @@
+﻿#include "TimerWheel.h"
+
+TimerWheel::TimerWheel(std::chrono::milliseconds tick)
+	: _start(std::chrono::steady_clock::now()), _tick(tick.count() > 0 ? tick : std::chrono::milliseconds(1)),
+	_current_tick(1), _count(0)
+{
+	for (int level = 0; level < TIMER_WHEEL_LEVELS; ++level) {
+		for (int slot = 0; slot < TIMER_WHEEL_SLOTS; ++slot) {
+			_slots[level][slot].prev = &_slots[level][slot];
+			_slots[level][slot].next = &_slots[level][slot];
+		}
+	}
+}
+
+uint64_t TimerWheel::TicksFor(std::chrono::milliseconds duration) const
+{
+	if (duration.count() <= 0) {
+		return 0;
+	}
+	return static_cast<uint64_t>((duration.count() + _tick.count() - 1) / _tick.count());
+}
+
+void TimerWheel::Insert(TimerEntry* entry)
+{
+	// 위 단계 칸에 있던 항목은 내려올 때 만료 틱이 현재 틱과 같을 수 있다 (이번 틱에 바로 꺼냄)
+	if (entry->expire_tick < _current_tick) {
+		entry->expire_tick = _current_tick;
+	}
+
+	uint64_t delta = entry->expire_tick - _current_tick;
+	int level = 0;
+	while (level < TIMER_WHEEL_LEVELS - 1 && delta >= (1ULL << (TIMER_WHEEL_BITS * (level + 1)))) {
+		++level;
+	}
+
+	// 휠 범위를 넘는 타이머는 가장 먼 칸에 두고, 만료되면 호출자가 다시 건다
+	uint64_t maxDelta = (1ULL << (TIMER_WHEEL_BITS * TIMER_WHEEL_LEVELS)) - 1;
+	if (delta > maxDelta) {
+		entry->expire_tick = _current_tick + maxDelta;
+	}
+
+	uint32_t slot = static_cast<uint32_t>(entry->expire_tick >> (TIMER_WHEEL_BITS * level)) & TIMER_WHEEL_MASK;
+	TimerEntry* head = &_slots[level][slot];
+	entry->prev = head->prev;
+	entry->next = head;
+	head->prev->next = entry;
+	head->prev = entry;
+}
+
+void TimerWheel::Unlink(TimerEntry* entry)
+{
+	entry->prev->next = entry->next;
+	entry->next->prev = entry->prev;
+	entry->prev = nullptr;
+	entry->next = nullptr;
+}
+
+void TimerWheel::ScheduleAt(TimerEntry* entry, uint64_t tick)
+{
+	if (entry->IsScheduled()) {
+		Unlink(entry);
+		--_count;
+	}
+
+	entry->expire_tick = tick > _current_tick ? tick : _current_tick + 1;
+	Insert(entry);
+	++_count;
+}
+
+void TimerWheel::Cancel(TimerEntry* entry)
+{
+	if (!entry->IsScheduled()) {
+		return;
+	}
+	Unlink(entry);
+	--_count;
+}
+
+uint32_t TimerWheel::Cascade(int level)
+{
+	uint32_t slot = static_cast<uint32_t>(_current_tick >> (TIMER_WHEEL_BITS * level)) & TIMER_WHEEL_MASK;
+	TimerEntry* head = &_slots[level][slot];
+
+	// 칸을 통째로 떼어낸 뒤 하나씩 다시 배치 (더 아래 단계로만 내려간다)
+	TimerEntry* entry = head->next;
+	head->prev = head;
+	head->next = head;
+	while (entry != head) {
+		TimerEntry* next = entry->next;
+		Insert(entry);
+		entry = next;
+	}
+	return slot;
+}
+
+void TimerWheel::Advance(std::chrono::steady_clock::time_point now, std::vector<TimerEntry*>& expired)
+{
+	if (now < _start) {
+		return;
+	}
+	uint64_t target = static_cast<uint64_t>((now - _start) / _tick) + 1;
+
+	while (_current_tick < target) {
+		if (_count == 0) {
+			// 걸린 타이머가 없으면 칸을 돌 필요 없이 바로 건너뜀
+			_current_tick = target;
+			return;
+		}
+
+		++_current_tick;
+		if ((_current_tick & TIMER_WHEEL_MASK) == 0) {
+			for (int level = 1; level < TIMER_WHEEL_LEVELS; ++level) {
+				if (Cascade(level) != 0) {
+					break;
+				}
+			}
+		}
+
+		TimerEntry* head = &_slots[0][_current_tick & TIMER_WHEEL_MASK];
+		while (head->next != head) {
+			TimerEntry* entry = head->next;
+			Unlink(entry);
+			--_count;
+			expired.push_back(entry);
+		}
+	}
+}
@@ -0,0 +1,60 @@
+﻿#pragma once
+#include <chrono>
+#include <vector>
+#include <cstdint>
+
+#define TIMER_WHEEL_BITS 6
+#define TIMER_WHEEL_SLOTS (1 << TIMER_WHEEL_BITS)   // 단계별 칸 수
+#define TIMER_WHEEL_MASK (TIMER_WHEEL_SLOTS - 1)
+#define TIMER_WHEEL_LEVELS 4                         // 64^4 틱까지 (100ms 틱이면 약 194일)
+
+// 타이머 휠에 거는 항목 (소유 객체 안에 두고, 객체를 해제하기 전에 Cancel)
+struct TimerEntry {
+    TimerEntry* prev;
+    TimerEntry* next;
+    uint64_t expire_tick;
+    void* context;  // 만료 시 호출자가 찾아갈 객체
+
+    explicit TimerEntry(void* ctx = nullptr) : prev(nullptr), next(nullptr), expire_tick(0), context(ctx) {}
+    bool IsScheduled() const { return next != nullptr; }
+};
+
+// 계층형 타이밍 휠
+// - 단계마다 64칸이며, 만료까지 남은 틱 수에 맞는 단계의 칸에 이중 연결 리스트로 걸어 둔다.
+// - 등록/취소는 O(1)이고, 틱이 지날 때는 가장 아래 단계의 현재 칸만 꺼낸다.
+//   위 단계 칸은 아래 단계가 한 바퀴 돌 때마다 한 칸씩 아래로 다시 나눠 담는다.
+// - 틱마다 만료된 항목만 보므로 타이머가 수만 개여도 전체를 훑지 않는다.
+// - 틱은 1부터 시작하므로 호출자는 0을 "설정 안 됨" 표시로 쓸 수 있다.
+// - 동기화하지 않으므로 소유 스레드 하나에서만 사용한다.
+class TimerWheel
+{
+private:
+    TimerEntry _slots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];  // 각 칸의 머리 (자기 자신을 가리키면 빈 칸)
+    std::chrono::steady_clock::time_point _start;
+    std::chrono::milliseconds _tick;
+    uint64_t _current_tick;
+    size_t _count;
+
+    void Insert(TimerEntry* entry);
+    static void Unlink(TimerEntry* entry);
+    // level 단계의 현재 칸 항목을 아래 단계로 다시 나눠 담고 칸 번호를 반환 (0이면 위 단계도 내려야 함)
+    uint32_t Cascade(int level);
+
+public:
+    explicit TimerWheel(std::chrono::milliseconds tick);
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    uint64_t CurrentTick() const { return _current_tick; }
+    // duration을 틱 수로 올림 변환 (0이면 0)
+    uint64_t TicksFor(std::chrono::milliseconds duration) const;
+    size_t Size() const { return _count; }
+
+    // tick에 만료되도록 등록 (이미 걸려 있으면 옮김, 현재 틱 이하면 다음 틱)
+    void ScheduleAt(TimerEntry* entry, uint64_t tick);
+    void Cancel(TimerEntry* entry);
+
+    // now까지 틱을 진행하고 만료된 항목을 expired 뒤에 붙임 (꺼낸 항목은 휠에서 빠진 상태)
+    void Advance(std::chrono::steady_clock::time_point now, std::vector<TimerEntry*>& expired);
+};
@@ -1,398 +1,1382 @@
 ﻿#include "WorkerThread.h"
-#include "LockFreeQueue.h"
+#include "TaskQueue.h"
+#include "DatabasePool.h"
+#include "Reactor.h"
+#include "ConnectionSlab.h"
+#include "ConcurrencyLimiter.h"
+#include "IoUring.h"
+#include "ServerPacketManager.h"
+#include "UserEvent_generated.h"
 #include <iostream>
-#include <chrono>
 #include <vector>
 
-// 기존 생성자 (하위 호환성)
-WorkerThread::WorkerThread(SOCKET ClientSocket)
-	: _do_thread(true), _head(nullptr), _tail(nullptr), _client_count(0), _task_queue(nullptr)
+WorkerThread::WorkerThread(DatabasePool* dbPool, ConnectionSlab* connections, ConcurrencyLimiter* dbLimiter, const ServerConfig& config)
+	: _do_thread(true), _client_count(0), _event_rate(0.0),
+	_sample_events(0), _sample_start(std::chrono::steady_clock::now()), _db_pool(dbPool), _connections(connections),
+	_db_limiter(dbLimiter), _packet_manager(std::make_unique<ServerPacketManager>()), _max_in_flight(config.max_in_flight),
+	_rate_policy(config.connection_rate, config.event_rates, config.rate_violation_limit),
+	_rejected_requests(0), _read_pauses(0), _rate_limited_frames(0), _rate_limited_requests(0), _rate_limit_disconnects(0),
+	_timers(std::chrono::milliseconds(WORKER_TIMER_TICK_MS)), _idle_timeouts(0), _frame_timeouts(0), _send_timeouts(0),
+	_steal_cursor(0), _idle(false)
 {
-	SocketNode* newNode = new SocketNode(ClientSocket);
-	_head.store(newNode);
-	_tail.store(newNode);
-	_client_count.store(1);
+	_idle_timeout_ticks = _timers.TicksFor(std::chrono::seconds(config.idle_timeout_sec));
+	_frame_timeout_ticks = _timers.TicksFor(std::chrono::seconds(config.frame_timeout_sec));
+	_send_timeout_ticks = _timers.TicksFor(std::chrono::seconds(config.send_timeout_sec));
 
-	_thread = std::make_unique<std::thread>(&WorkerThread::RunOnServerThread, this);
+	InitializeIo(config);
 }
 
-// 새로운 생성자 (Task 큐 포함)
-WorkerThread::WorkerThread(SOCKET ClientSocket, LockFreeQueue<Task>* taskQueue)
-	: _do_thread(true), _head(nullptr), _tail(nullptr), _client_count(0), _task_queue(taskQueue)
+void WorkerThread::Start()
 {
-	SocketNode* newNode = new SocketNode(ClientSocket);
-	_head.store(newNode);
-	_tail.store(newNode);
-	_client_count.store(1);
-
 	_thread = std::make_unique<std::thread>(&WorkerThread::RunOnServerThread, this);
 }
 
 WorkerThread::~WorkerThread()
 {
-	StopThread();
+	Join();
 
-	if (_thread && _thread->joinable()) {
-		_thread->join();
+#ifdef USE_IO_URING
+	if (_uring) {
+		// 커널에 걸린 요청이 노드 메모리를 건드리지 않도록 링을 먼저 정리
+		for (SocketNode* node : _connections->CollectNodes(this)) {
+			shutdown(node->socket, SD_BOTH);
+		}
+		_uring.reset();
+
+		for (SocketNode* node : _closing_nodes) {
+			closesocket(node->socket);
+			delete node;
+		}
+		for (SocketNode* node : _new_nodes) {
+			closesocket(node->socket);
+			delete node;
+		}
+		_closing_nodes.clear();
+		_new_nodes.clear();
 	}
+#endif
 
 	// 남은 소켓들 정리
-	SocketNode* current = _head.load();
-	while (current != nullptr) {
-		SocketNode* next = current->next.load();
-		closesocket(current->socket);
-		delete current;
-		current = next;
+	for (SocketNode* node : _connections->CollectNodes(this)) {
+		_connections->Release(node->handle);
+		closesocket(node->socket);
+		delete node;
 	}
 }
 
-void WorkerThread::AddClient(SOCKET clientSocket)
+void WorkerThread::InitializeIo(const ServerConfig& config)
 {
-	if (_client_count.load() >= MAX_CLIENT_COUNT) {
-		closesocket(clientSocket);
-		return;
+#ifdef USE_IO_URING
+	if (config.io_backend == IoBackend::IO_URING) {
+		_uring = std::make_unique<IoUring>();
+		if (_uring->Initialize(config.uring_entries, config.uring_buffer_count, config.uring_buffer_size)) {
+			return;
+		}
+		std::cerr << "[WorkerThread] io_uring 초기화 실패, reactor로 대체" << std::endl;
+		_uring.reset();
 	}
+#else
+	if (config.io_backend == IoBackend::IO_URING) {
+		std::cerr << "[WorkerThread] io_uring 미지원 빌드, reactor 사용" << std::endl;
+	}
+#endif
+	_reactor = Reactor::Create();
+}
 
-	SocketNode* newNode = new SocketNode(clientSocket);
-
-	// Lock-free tail insertion
-	while (true) {
-		SocketNode* tail = _tail.load();
-		
-		if (tail == nullptr)
+void WorkerThread::RegisterNode(SocketNode* node)
+{
+#ifdef USE_IO_URING
+	if (_uring) {
+		// SQ는 워커 스레드만 만질 수 있으므로 넘겨서 다음 루프에서 recv를 건다
 		{
-			SocketNode* newNode = new SocketNode(clientSocket);
-			_head.store(newNode);
-			_tail.store(newNode);
-			_client_count.store(1);
-			break;
+			std::lock_guard<std::mutex> lock(_outbox_mutex);
+			_new_nodes.push_back(node);
 		}
+		_uring->Wakeup();
+		return;
+	}
+#endif
+	_reactor->Add(node->socket, node);
+}
 
-		SocketNode* next = tail->next.load();
+void WorkerThread::ReleaseNode(SocketNode* node)
+{
+	_timers.Cancel(&node->timer);
 
-		if (tail == _tail.load()) {  // tail이 변경되지 않았는지 확인
-			if (next == nullptr) {
-				// tail의 next를 새 노드로 설정 시도
-				if (tail->next.compare_exchange_weak(next, newNode))
-				{
-					// 성공하면 tail을 새 노드로 업데이트
-					_tail.compare_exchange_weak(tail, newNode);
-					_client_count.fetch_add(1);
-					printf("[WorkerThread] 클라이언트 추가: %d\n", _client_count.load());
-					break;
-				}
-			}
-			else {
-				// tail이 실제 마지막이 아니면 tail을 앞으로 이동 시도
-				_tail.compare_exchange_weak(tail, next);
-			}
-		}
+#ifdef USE_IO_URING
+	if (_uring) {
+		// 걸려 있는 recv/send가 완료될 때까지 메모리를 유지하고, 소켓은 끊어서 빨리 끝나도록 한다
+		node->closing = true;
+		shutdown(node->socket, SD_BOTH);
+		_uring->Cancel(node->socket);
+		_closing_nodes.push_back(node);
+		TryFinalizeClosing(node);
+		return;
 	}
+#endif
+	_reactor->Remove(node->socket);
+	closesocket(node->socket);
+	delete node;
 }
 
-void WorkerThread::RemoveSocketFromList(SOCKET target_socket)
+void WorkerThread::RecordEvents(int count)
 {
-	SocketNode* prev = nullptr;
-	SocketNode* current = _head.load();
+	_sample_events += static_cast<uint64_t>(count);
 
-	while (current != nullptr) {
-		if (current->socket == target_socket) {
-			SocketNode* next = current->next.load();
+	auto now = std::chrono::steady_clock::now();
+	auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - _sample_start).count();
+	if (elapsed < WORKER_RATE_SAMPLE_MS) {
+		return;
+	}
 
-			if (prev == nullptr) {
-				// 첫 번째 노드 제거
-				if (_head.compare_exchange_weak(current, next)) {
-					if (next == nullptr) {
-						_tail.store(nullptr);
-					}
+	double rate = _sample_events * 1000.0 / static_cast<double>(elapsed);
+	double previous = _event_rate.load();
+	_event_rate.store(WORKER_RATE_EWMA_ALPHA * rate + (1.0 - WORKER_RATE_EWMA_ALPHA) * previous);
 
-					// === DatabaseThread에 연결 해제 알림 (Task 큐 사용) ===
-					if (_task_queue) {
-						Task disconnectTask(current->socket, TaskType::CLIENT_DISCONNECTED);
-						_task_queue->enqueue(disconnectTask);
-						std::cout << "[WorkerThread] 클라이언트 연결 해제 알림 전송: " << current->socket << std::endl;
-					}
+	_sample_events = 0;
+	_sample_start = now;
+}
 
-					closesocket(current->socket);
-					delete current;
-					_client_count.fetch_sub(1);
-					printf("[WorkerThread] 클라이언트 제거: %d\n", _client_count.load());
-					return;
-				}
-			}
-			else {
-				// 중간 또는 마지막 노드 제거
-				if (prev->next.compare_exchange_weak(current, next)) {
-					if (current == _tail.load()) {
-						_tail.store(prev);
-					}
-
-					// === DatabaseThread에 연결 해제 알림 (Task 큐 사용) ===
-					if (_task_queue) {
-						Task disconnectTask(current->socket, TaskType::CLIENT_DISCONNECTED);
-						_task_queue->enqueue(disconnectTask);
-						std::cout << "[WorkerThread] 클라이언트 연결 해제 알림 전송: " << current->socket << std::endl;
-					}
-
-					closesocket(current->socket);
-					delete current;
-					_client_count.fetch_sub(1);
-					printf("[WorkerThread] 클라이언트 제거: %d\n", _client_count.load());
-					return;
-				}
-			}
-		}
-		prev = current;
-		current = current->next.load();
+void WorkerThread::WakeupLoop()
+{
+#ifdef USE_IO_URING
+	if (_uring) {
+		_uring->Wakeup();
+		return;
+	}
+#endif
+	if (_reactor) {
+		_reactor->Wakeup();
+	}
+}
+
+bool WorkerThread::AddClient(SOCKET clientSocket)
+{
+	SocketNode* newNode = new SocketNode(clientSocket);
+
+	// 슬랩에 등록해 핸들 발급 (아직 I/O를 걸기 전이라 이 연결로 가는 응답은 없음)
+	ConnectionHandle handle = _connections->Allocate(this, newNode);
+	if (handle == INVALID_CONNECTION_HANDLE) {
+		std::cerr << "[WorkerThread] 연결 슬랩이 가득 참, 연결 거부: " << clientSocket << std::endl;
+		delete newNode;
+		return false;
+	}
+	newNode->handle = handle;
+	newNode->inbox->handle = handle;
+
+	_client_count.fetch_add(1);
+	printf("[WorkerThread] 클라이언트 추가: %d (핸들 %u)\n", _client_count.load(), handle);
+
+	// 타이머 휠은 워커 스레드만 만지므로 다음 루프에서 건다
+	{
+		std::lock_guard<std::mutex> lock(_outbox_mutex);
+		_new_timer_handles.push_back(handle);
+	}
+
+	// 소켓은 연결 시 한 번만 등록 (이후 준비된 경우에만 워커가 깨어남)
+	RegisterNode(newNode);
+	return true;
+}
+
+void WorkerThread::RemoveClient(SocketNode* node)
+{
+	// 소켓을 닫기 전에 슬롯 반납 (세대가 올라가 이 연결로 가는 늦은 응답은 모두 버려짐)
+	// 이미 반납된 노드(io_uring 모드에서 해제 대기 중)면 아무것도 하지 않는다
+	if (!_connections->Release(node->handle)) {
+		return;
+	}
+
+	// === DatabaseThread에 연결 해제 알림 (아직 처리되지 않은 프레임 뒤에 오도록 inbox 사용) ===
+	if (_db_pool) {
+		ScheduleFrame(node, PacketBuffer());
+		std::cout << "[WorkerThread] 클라이언트 연결 해제 알림 전송: " << node->socket << std::endl;
 	}
+
+	ReleaseNode(node);
+	_client_count.fetch_sub(1);
+	printf("[WorkerThread] 클라이언트 제거: %d\n", _client_count.load());
 }
 
-bool WorkerThread::SendToClient(SOCKET clientSocket, const std::vector<uint8_t>& data)
+bool WorkerThread::SendToClient(ConnectionHandle handle, const std::vector<uint8_t>& data)
 {
-	std::lock_guard<std::mutex> lock(_send_mutex);
+	return SendToClient(handle, PacketBuffer::Copy(data.data(), data.size()));
+}
 
+bool WorkerThread::SendToClient(ConnectionHandle handle, PacketBuffer data, uint32_t requestId)
+{
 	if (data.empty()) {
 		std::cerr << "[WorkerThread] 전송할 데이터가 비어있음" << std::endl;
 		return false;
 	}
 
-	// 소켓 유효성 검사 추가
-	if (!HasClient(clientSocket)) {
-		std::cerr << "[WorkerThread] 유효하지 않은 클라이언트 소켓: " << clientSocket << std::endl;
+	// 송신 버퍼는 워커 스레드만 만지므로 여기서는 요청만 넘기고 바로 반환
+	// (느린 클라이언트 하나 때문에 호출 스레드나 같은 워커의 다른 소켓이 멈추지 않도록)
+	PushOutbox({ handle, std::move(data), requestId, 0, false });
+	return true;
+}
+
+void WorkerThread::PushOutbox(OutboundMessage&& message)
+{
+	// 큐가 비어 있을 때만 깨우므로 응답이 몰려도 깨우기는 루프 한 번에 한 번이다
+	bool needWakeup = false;
+	{
+		std::lock_guard<std::mutex> lock(_outbox_mutex);
+		needWakeup = _outbox.empty();
+		_outbox.push_back(std::move(message));
+	}
+
+	if (needWakeup) {
+		WakeupLoop();
+	}
+}
+
+void WorkerThread::DrainOutbox()
+{
+	// 붙잡아 둔 응답이 있는 연결의 완료 번호는 outbox를 꺼내기 전에 읽는다
+	// (완료된 요청의 응답은 완료 기록보다 먼저 outbox에 들어가므로 이번에 꺼낸 메시지에 모두 포함됨)
+	size_t deferredCount = _deferred_handles.size();
+	for (size_t i = 0; i < deferredCount; ++i) {
+		SocketNode* node = FindNode(_deferred_handles[i]);
+		if (node != nullptr) {
+			node->completed_snapshot = _connections->GetCompletedRequest(_deferred_handles[i]);
+		}
+	}
+
+	std::vector<OutboundMessage> messages;
+	{
+		std::lock_guard<std::mutex> lock(_outbox_mutex);
+		if (_outbox.empty() && deferredCount == 0) {
+			return;
+		}
+		messages.swap(_outbox);
+	}
+
+	// 같은 소켓으로 가는 응답은 모두 송신 버퍼에 이어 붙인 뒤 한 번에 내보낸다
+	std::vector<ConnectionHandle> touched;
+	for (OutboundMessage& message : messages) {
+		SocketNode* node = FindNode(message.handle);
+		if (node == nullptr) {
+			// 요청을 보낸 연결은 이미 끊김 (같은 소켓 번호를 받은 새 연결로 잘못 가지 않도록 버림)
+			if (!message.data.empty()) {
+				std::cerr << "[WorkerThread] 끊긴 연결로 가는 응답 폐기 - 핸들: " << message.handle << std::endl;
+			}
+			continue;
+		}
+		if (message.data.empty()) {
+			// 수신 재개 요청 (그 사이 다시 한도에 도달했으면 그대로 둔다)
+			if (node->read_paused && _connections->GetInFlight(message.handle) < _max_in_flight) {
+				ResumeReading(node);
+			}
+			continue;
+		}
+
+		// 붙잡아 둔 거절 응답보다 뒤 요청의 응답이거나, 앞선 요청이 아직 끝나지 않은 거절 응답이면 순서대로 기다림
+		bool behindDeferred = message.request_id != 0 && !node->deferred_responses.empty()
+			&& ConnectionSlab::IsEarlierRequest(node->deferred_responses.front().request_id, message.request_id);
+		if (behindDeferred || (message.rejection && !IsRequestSettled(node, message.after_request))) {
+			DeferResponse(node, message);
+			continue;
+		}
+
+		if (!QueueResponse(node, message.data, touched)) {
+			continue;
+		}
+		if (message.rejection) {
+			node->rejected_through = message.request_id;
+		}
+	}
+
+	// 완료 번호를 읽어 둔 연결만 확인 (이번에 새로 붙잡은 연결은 다음 루프에서 확인)
+	size_t kept = 0;
+	for (size_t i = 0; i < _deferred_handles.size(); ++i) {
+		SocketNode* node = FindNode(_deferred_handles[i]);
+		if (node == nullptr || (i < deferredCount && FlushDeferredResponses(node, touched))) {
+			continue;
+		}
+		_deferred_handles[kept++] = _deferred_handles[i];
+	}
+	_deferred_handles.resize(kept);
+
+	for (ConnectionHandle handle : touched) {
+		// 한도 초과로 이미 제거된 연결일 수 있으므로 다시 찾는다
+		SocketNode* node = FindNode(handle);
+		if (node == nullptr || !node->flush_pending) {
+			continue;
+		}
+		node->flush_pending = false;
+
+		// 이미 쓰기 대기 중이면 순서를 지키기 위해 쓰기 가능 이벤트에서 이어서 보낸다
+		if (!node->write_interest) {
+			FlushSendBuffer(node);
+		}
+	}
+}
+
+bool WorkerThread::QueueResponse(SocketNode* node, const PacketBuffer& data, std::vector<ConnectionHandle>& touched)
+{
+	if (!QueueSend(node, data)) {
 		return false;
 	}
+	if (!node->flush_pending) {
+		node->flush_pending = true;
+		touched.push_back(node->handle);
+	}
+	return true;
+}
+
+void WorkerThread::DeferResponse(SocketNode* node, OutboundMessage& message)
+{
+	std::deque<DeferredResponse>& deferred = node->deferred_responses;
+	if (deferred.empty()) {
+		_deferred_handles.push_back(node->handle);
+	}
 
-	// 먼저 패킷 크기를 전송 (4바이트 헤더)
-	uint32_t packetSize = static_cast<uint32_t>(data.size());
-	uint32_t networkSize = htonl(packetSize);
+	// 요청 번호 순으로 끼워 넣음 (같은 요청의 조각 응답은 도착한 순서 유지)
+	auto position = deferred.end();
+	while (position != deferred.begin()
+		&& ConnectionSlab::IsEarlierRequest(message.request_id, std::prev(position)->request_id)) {
+		--position;
+	}
+	deferred.insert(position, { message.request_id, message.after_request, message.rejection, std::move(message.data) });
+}
 
-	// 헤더 전송 개선
-	int headerResult = send(clientSocket, reinterpret_cast<const char*>(&networkSize), sizeof(networkSize), 0);
-	if (headerResult <= 0) {
-		int error = WSAGetLastError();
-		if (error != WSAEWOULDBLOCK) {
-			std::cerr << "[WorkerThread] 헤더 전송 실패: " << error << std::endl;
-			RemoveSocketFromList(clientSocket);
+bool WorkerThread::FlushDeferredResponses(SocketNode* node, std::vector<ConnectionHandle>& touched)
+{
+	std::deque<DeferredResponse>& deferred = node->deferred_responses;
+	while (!deferred.empty()) {
+		DeferredResponse& front = deferred.front();
+		if (front.rejection && !IsRequestSettled(node, front.after_request)) {
 			return false;
 		}
-		// WSAEWOULDBLOCK인 경우 재시도 로직 추가 가능
+		if (!QueueResponse(node, front.data, touched)) {
+			return true; // 송신 버퍼 한도로 연결이 끊김
+		}
+		if (front.rejection) {
+			node->rejected_through = front.request_id;
+		}
+		deferred.pop_front();
+	}
+	return true;
+}
+
+bool WorkerThread::IsRequestSettled(const SocketNode* node, uint32_t requestId) const
+{
+	// DB에서 끝났거나, 그 뒤 요청의 거절 응답이 이미 나갔으면 끝난 것
+	return requestId == 0
+		|| !ConnectionSlab::IsEarlierRequest(node->completed_snapshot, requestId)
+		|| !ConnectionSlab::IsEarlierRequest(node->rejected_through, requestId);
+}
+
+bool WorkerThread::QueueSend(SocketNode* node, const PacketBuffer& data)
+{
+	RingBuffer& buffer = node->send_buffer;
+	size_t frameSize = sizeof(uint32_t) + data.size();
+
+	if (PendingSendBytes(node) + frameSize > SEND_BUFFER_HARD_LIMIT) {
+		std::cerr << "[WorkerThread] 송신 버퍼 한도 초과, 연결 종료 - 소켓: " << node->socket
+			<< ", 대기 중: " << PendingSendBytes(node) << " bytes" << std::endl;
+		RemoveClient(node);
 		return false;
 	}
 
-	// 실제 패킷 데이터 전송 개선
-	int totalSent = 0;
-	int dataSize = static_cast<int>(data.size());
-	int retryCount = 0;
-	const int MAX_SEND_RETRY = 3;
+	// 비어 있던 송신 버퍼에 응답이 생기면 그때부터 전송 정체 시간을 잰다
+	if (PendingSendBytes(node) == 0) {
+		node->send_progress_tick = _timers.CurrentTick();
+		if (_send_timeout_ticks > 0) {
+			UpdateTimer(node);
+		}
+	}
+
+	// 패킷 크기 헤더(4바이트, 네트워크 바이트 순서)와 본문을 이어 붙임
+	uint32_t networkSize = htonl(static_cast<uint32_t>(data.size()));
+	buffer.Write(&networkSize, sizeof(networkSize));
+	buffer.Write(data.data(), data.size());
+
+	if (!node->slow_consumer && PendingSendBytes(node) > SEND_BUFFER_HIGH_WATER) {
+		node->slow_consumer = true;
+		std::cerr << "[WorkerThread] 느린 클라이언트 감지 - 소켓: " << node->socket
+			<< ", 대기 중: " << PendingSendBytes(node) << " bytes" << std::endl;
+	}
+	return true;
+}
+
+bool WorkerThread::FlushSendBuffer(SocketNode* node)
+{
+#ifdef USE_IO_URING
+	if (_uring) {
+		return SubmitUringSend(node);
+	}
+#endif
+
+	RingBuffer& buffer = node->send_buffer;
+
+	while (!buffer.Empty()) {
+		// 링 버퍼가 경계를 넘어 두 구간으로 나뉘어 있어도 한 번의 시스템 콜로 보냄
+		const uint8_t* ptrs[2];
+		size_t sizes[2];
+		int count = buffer.ReadSegments(ptrs, sizes);
+
+		SendSlice slices[2];
+		for (int i = 0; i < count; ++i) {
+			slices[i].data = ptrs[i];
+			slices[i].size = sizes[i];
+		}
 
-	while (totalSent < dataSize && retryCount < MAX_SEND_RETRY) {
-		int sent = send(clientSocket,
-			reinterpret_cast<const char*>(data.data()) + totalSent,
-			dataSize - totalSent, 0);
+		int sent = SendGather(node->socket, slices, count);
 
 		if (sent > 0) {
-			totalSent += sent;
-			retryCount = 0;
+			buffer.Consume(static_cast<size_t>(sent));
+			node->send_progress_tick = _timers.CurrentTick();
+			continue;
 		}
-		else {
-			int error = WSAGetLastError();
-			if (error == WSAEWOULDBLOCK) {
-				retryCount++;
-				std::this_thread::sleep_for(std::chrono::milliseconds(1));
-				continue;
-			}
-			else {
-				std::cerr << "[WorkerThread] 데이터 전송 실패: " << error << std::endl;
-				RemoveSocketFromList(clientSocket);
-				return false;
-			}
+
+		int error = WSAGetLastError();
+		if (error == WSAEWOULDBLOCK) {
+			break; // 커널 송신 버퍼가 가득 참, 쓰기 가능 이벤트를 기다림
+		}
+		if (error == WSAEINTR) {
+			continue;
 		}
-	}
 
-	if (totalSent < dataSize) {
-		std::cerr << "[WorkerThread] 데이터 전송 불완료: " << totalSent << "/" << dataSize << " bytes" << std::endl;
+		std::cerr << "[WorkerThread] 데이터 전송 실패: " << error << std::endl;
+		RemoveClient(node);
 		return false;
 	}
 
-	std::cout << "[WorkerThread] 데이터 전송 완료 - 소켓: " << clientSocket
-		<< ", 크기: " << data.size() << " bytes" << std::endl;
+	if (node->slow_consumer && buffer.Size() < SEND_BUFFER_HIGH_WATER / 2) {
+		node->slow_consumer = false;
+		std::cout << "[WorkerThread] 느린 클라이언트 해소 - 소켓: " << node->socket << std::endl;
+	}
+
+	// 남은 데이터가 있을 때만 쓰기 가능 통지를 받는다 (항상 켜두면 매 대기마다 깨어남)
+	bool needWrite = !buffer.Empty();
+	if (needWrite != node->write_interest) {
+		uint32_t interest = ReadInterest(node) | (needWrite ? static_cast<uint32_t>(REACTOR_WRITE) : 0u);
+		if (_reactor->Modify(node->socket, node, interest)) {
+			node->write_interest = needWrite;
+		}
+	}
 	return true;
 }
 
-bool WorkerThread::HasClient(SOCKET clientSocket) const
+void WorkerThread::PauseReading(SocketNode* node)
 {
-	SocketNode* current = _head.load();
-	while (current != nullptr) {
-		if (current->socket == clientSocket) {
-			return true;
+	node->read_paused = true;
+	_read_pauses.fetch_add(1);
+
+#ifdef USE_IO_URING
+	if (_uring) {
+		// multishot recv를 취소해 이후 데이터는 커널 수신 버퍼에 남긴다 (취소 완료 이벤트에서 recv_armed 해제)
+		if (node->recv_armed) {
+			_uring->CancelRecv(node);
 		}
-		current = current->next.load();
+		return;
 	}
-	return false;
+#endif
+	_reactor->Modify(node->socket, node, ReadInterest(node) | (node->write_interest ? static_cast<uint32_t>(REACTOR_WRITE) : 0u));
 }
 
-void WorkerThread::RunOnServerThread()
+void WorkerThread::ResumeReading(SocketNode* node)
 {
-	printf("[WorkerThread] WorkerThread 시작\n");
+	node->read_paused = false;
 
-	while (_do_thread.load()) {
-		if (_client_count.load() == 0) {
-			std::this_thread::sleep_for(std::chrono::milliseconds(10));
-			continue;
+	// 멈춘 동안 버퍼에 남겨둔 프레임부터 꺼냄 (다시 한도에 도달하면 그대로 멈춤)
+	if (!ExtractFrames(node) || node->read_paused) {
+		return;
+	}
+
+#ifdef USE_IO_URING
+	if (_uring) {
+		if (!node->recv_armed) {
+			node->recv_armed = _uring->ArmRecv(node->socket, node);
 		}
+		return;
+	}
+#endif
+	_reactor->Modify(node->socket, node, ReadInterest(node) | (node->write_interest ? static_cast<uint32_t>(REACTOR_WRITE) : 0u));
+	// 멈춘 동안 도착한 데이터는 엣지 통지가 다시 오지 않을 수 있으므로 바로 읽는다
+	ReceiveFromClient(node);
+}
 
-		fd_set readSet, errorSet; // 에러 셋 추가
-		FD_ZERO(&readSet);
-		FD_ZERO(&errorSet);
+void WorkerThread::RequestResume(ConnectionHandle handle)
+{
+	PushOutbox({ handle, PacketBuffer(), 0, 0, false });
+}
 
-		SOCKET maxSock = 0;
-		std::vector<SOCKET> socketList;
+uint32_t WorkerThread::ReadInterest(const SocketNode* node) const
+{
+	return node->read_paused ? 0u : static_cast<uint32_t>(REACTOR_READ);
+}
 
-		// 현재 연결된 소켓들을 복사 (lock-free 순회)
-		SocketNode* current = _head.load();
-		while (current != nullptr) {
-			SOCKET s = current->socket;
-			if (s != INVALID_SOCKET) { // 유효한 소켓만 추가
-				socketList.push_back(s);
-				FD_SET(s, &readSet);
-				FD_SET(s, &errorSet); // 에러 모니터링 추가
-				if (s > maxSock) maxSock = s;
-			}
-			current = current->next.load();
-		}
+void WorkerThread::ReleaseInFlight(ConnectionHandle handle)
+{
+	uint32_t remaining = 0;
+	if (!_connections->ReleaseInFlight(handle, remaining) || _max_in_flight == 0) {
+		return;
+	}
 
-		if (socketList.empty()) {
-			std::this_thread::sleep_for(std::chrono::milliseconds(1));
-			continue;
+	// 한도에서 하나 내려간 순간에만 소유 워커에 알림 (멈춘 상태인지는 소유 워커가 다시 확인)
+	if (remaining + 1 == _max_in_flight) {
+		WorkerThread* owner = _connections->FindWorker(handle);
+		if (owner != nullptr) {
+			owner->RequestResume(handle);
 		}
+	}
+}
+
+SocketNode* WorkerThread::FindNode(ConnectionHandle handle) const
+{
+	return _connections->FindNode(handle, this);
+}
+
+size_t WorkerThread::PendingSendBytes(const SocketNode* node) const
+{
+	size_t pending = node->send_buffer.Size();
+#ifdef USE_IO_URING
+	pending += node->uring_sending.size() - node->uring_send_offset;
+#endif
+	return pending;
+}
+
+bool WorkerThread::HasClient(ConnectionHandle handle) const
+{
+	return _connections->FindWorker(handle) == this;
+}
+
+void WorkerThread::RunOnServerThread()
+{
+#ifdef USE_IO_URING
+	if (_uring) {
+		RunUringLoop();
+		return;
+	}
+#endif
 
-		timeval timeout;
-		timeout.tv_sec = 0;
-		timeout.tv_usec = 10000; // 10ms
+	printf("[WorkerThread] WorkerThread 시작 (reactor: %s)\n", _reactor->GetName());
 
-		int result = select(0, &readSet, NULL, &errorSet, &timeout);
+	ReactorEvent events[128];
 
-		if (result == SOCKET_ERROR) {
+	while (_do_thread.load()) {
+		// 준비된 소켓이 있거나 깨우기 신호가 올 때까지 대기 (클라이언트가 없어도 바쁜 대기하지 않음)
+		// 처리할 작업이 남아 있으면 대기하지 않고 준비된 이벤트만 확인
+		bool hasWork = HasLocalWork();
+		_idle.store(!hasWork);
+		int count = _reactor->Wait(events, 128, hasWork ? 0 : WaitTimeoutMs());
+		_idle.store(false);
+
+		if (count < 0) {
 			int error = WSAGetLastError();
 			if (error != WSAEINTR) { // 인터럽트가 아닌 실제 에러만 로깅
-				std::cerr << "[WorkerThread] select 에러: " << error << std::endl;
+				std::cerr << "[WorkerThread] reactor 대기 에러: " << error << std::endl;
 			}
-			std::this_thread::sleep_for(std::chrono::milliseconds(10));
 			continue;
 		}
 
-		// 에러 발생한 소켓들 먼저 처리
-		for (SOCKET s : socketList) {
-			if (FD_ISSET(s, &errorSet)) {
-				std::cout << "[WorkerThread] 소켓 에러 감지, 제거: " << s << std::endl;
-				RemoveSocketFromList(s);
-			}
+		for (int i = 0; i < count; ++i) {
+			HandleSocketEvent(static_cast<SocketNode*>(events[i].context), events[i].events);
 		}
+		RecordEvents(count);
 
-		// 이벤트 발생한 소켓들 처리
-		for (SOCKET s : socketList) {
-			if (FD_ISSET(s, &readSet)) {
-				char buffer[4096];
-				ProcessClientData(s, buffer, sizeof(buffer));
-			}
-		}
+		// 새 연결에 타이머를 걸고 시간이 지난 연결을 정리
+		StartNewTimers();
+		ProcessTimers();
+
+		// 다른 스레드가 요청한 응답을 송신 버퍼로 옮기고 바로 보낼 수 있는 만큼 보냄
+		DrainOutbox();
 
-		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		// 요청 큐가 가득 차 미뤄둔 연결 해제 알림부터 다시 넣고, 조립된 프레임 처리 (내 덱이 비었으면 바쁜 워커의 덱에서 가져옴)
+		RetryPendingDisconnects();
+		ProcessWork();
 	}
+	HandOverPendingDisconnects();
 
 	printf("[WorkerThread] WorkerThread 종료\n");
 }
 
-void WorkerThread::ProcessClientData(SOCKET clientSocket, char* buffer, int bufferSize)
+void WorkerThread::HandleSocketEvent(SocketNode* node, uint32_t events)
 {
-	// 먼저 패킷 크기 읽기 (4바이트 헤더)
-	uint32_t packetSize = 0;
-	int headerReceived = recv(clientSocket, reinterpret_cast<char*>(&packetSize), sizeof(packetSize), 0);
+	SOCKET s = node->socket;  // 로그용
 
-	if (headerReceived <= 0) {
-		int error = WSAGetLastError();
-		// WSAEWOULDBLOCK은 non-blocking 소켓에서 정상적인 상황
-		if (error == WSAEWOULDBLOCK) {
-			return; // 단순히 리턴, 연결 끊지 않음
+	if (events & REACTOR_WRITE) {
+		if (!FlushSendBuffer(node)) {
+			return; // 전송 에러로 노드가 해제됨
 		}
+	}
 
-		// 실제 연결 종료나 에러인 경우만 제거
-		std::cout << "[WorkerThread] 클라이언트 연결 종료/에러 - 에러코드: " << error << std::endl;
-		RemoveSocketFromList(clientSocket);
+	if (events & REACTOR_READ) {
+		// 연결 종료를 감지했다면 노드는 이미 해제됨
+		ReceiveFromClient(node);
 		return;
 	}
 
-	if (headerReceived != sizeof(packetSize)) {
-		std::cerr << "[WorkerThread] 불완전한 헤더 수신: " << headerReceived << " bytes" << std::endl;
-		return; // 재시도 가능하도록 연결 유지
+	if (events & REACTOR_ERROR) {
+		std::cout << "[WorkerThread] 소켓 에러 감지, 제거: " << s << std::endl;
+		RemoveClient(node);
 	}
+}
 
-	// 네트워크 바이트 순서에서 호스트 바이트 순서로 변환
-	packetSize = ntohl(packetSize);
-
-	// 패킷 크기 검증 개선
-	if (packetSize == 0) {
-		std::cerr << "[WorkerThread] 빈 패킷 수신" << std::endl;
-		return; // 빈 패킷은 무시하고 연결 유지
-	}
+bool WorkerThread::ReceiveFromClient(SocketNode* node)
+{
+	RingBuffer& buffer = node->recv_buffer;
 
-	if (packetSize > 65536) { // 최대 64KB 제한
-		std::cerr << "[WorkerThread] 패킷 크기 초과: " << packetSize << " bytes" << std::endl;
-		RemoveSocketFromList(clientSocket);
-		return;
+	// 수신을 멈춘 연결은 커널 수신 버퍼에 데이터를 남겨 TCP 윈도우로 클라이언트를 늦춘다
+	if (node->read_paused) {
+		return true;
 	}
 
-	// 실제 패킷 데이터 읽기 - 타임아웃 추가
-	std::vector<uint8_t> packetData(packetSize);
-	int totalReceived = 0;
-	int retryCount = 0;
-	const int MAX_RETRY = 5;
+	// 엣지 트리거: 커널 수신 버퍼를 모두 비울 때까지 읽는다
+	while (true) {
+		if (buffer.Writable() == 0) {
+			buffer.Reserve(buffer.Capacity() * 2);
+		}
 
-	while (totalReceived < static_cast<int>(packetSize) && retryCount < MAX_RETRY) {
-		int received = recv(clientSocket,
-			reinterpret_cast<char*>(packetData.data()) + totalReceived,
-			packetSize - totalReceived, 0);
+		size_t space = buffer.ContiguousWritable();
+		int received = recv(node->socket, reinterpret_cast<char*>(buffer.WritePtr()), static_cast<int>(space), 0);
 
 		if (received > 0) {
-			totalReceived += received;
-			retryCount = 0; // 성공 시 재시도 카운트 리셋
+			buffer.CommitWrite(static_cast<size_t>(received));
+
+			if (!ExtractFrames(node)) {
+				return false;
+			}
+			if (node->read_paused) {
+				return true;
+			}
+
+			// 덜 채워졌어도 EWOULDBLOCK이나 0을 볼 때까지 계속 읽는다
+			// (데이터와 같은 통지로 온 연결 종료는 다음 recv()==0으로만 알 수 있고 엣지가 다시 오지 않음)
+			continue;
 		}
-		else if (received == 0) {
+
+		if (received == 0) {
 			// 연결이 정상적으로 종료됨
 			std::cout << "[WorkerThread] 클라이언트가 연결을 정상 종료" << std::endl;
-			RemoveSocketFromList(clientSocket);
+			RemoveClient(node);
+			return false;
+		}
+
+		int error = WSAGetLastError();
+		if (error == WSAEWOULDBLOCK) {
+			return true; // 더 읽을 데이터 없음, 부분 패킷은 버퍼에 남겨둠
+		}
+		if (error == WSAEINTR) {
+			continue;
+		}
+
+		// 실제 연결 종료나 에러인 경우만 제거
+		std::cout << "[WorkerThread] 클라이언트 연결 종료/에러 - 에러코드: " << error << std::endl;
+		RemoveClient(node);
+		return false;
+	}
+}
+
+void WorkerThread::StartNewTimers()
+{
+	std::vector<ConnectionHandle> handles;
+	{
+		std::lock_guard<std::mutex> lock(_outbox_mutex);
+		if (_new_timer_handles.empty()) {
 			return;
 		}
-		else {
-			int error = WSAGetLastError();
-			if (error == WSAEWOULDBLOCK) {
-				// non-blocking 상황, 잠시 대기 후 재시도
-				retryCount++;
-				std::this_thread::sleep_for(std::chrono::milliseconds(1));
-				continue;
-			}
-			else {
-				std::cerr << "[WorkerThread] 패킷 데이터 수신 실패 - 에러: " << error << std::endl;
-				RemoveSocketFromList(clientSocket);
-				return;
-			}
+		handles.swap(_new_timer_handles);
+	}
+
+	for (ConnectionHandle handle : handles) {
+		SocketNode* node = FindNode(handle);
+		if (node == nullptr) {
+			continue; // 타이머를 걸기 전에 끊김
 		}
+		node->last_recv_tick = _timers.CurrentTick();
+		UpdateTimer(node);
+	}
+}
+
+void WorkerThread::ProcessTimers()
+{
+	_timers.Advance(std::chrono::steady_clock::now(), _expired_timers);
+	if (_expired_timers.empty()) {
+		return;
 	}
 
-	if (totalReceived < static_cast<int>(packetSize)) {
-		std::cerr << "[WorkerThread] 패킷 수신 불완료: " << totalReceived << "/" << packetSize << " bytes" << std::endl;
-		return; // 부분 수신된 경우 재시도를 위해 연결 유지
+	// 만료된 타이머는 휠에서 빠진 상태 - 아직 시간이 남은 연결은 CheckTimeouts가 다시 건다
+	for (TimerEntry* entry : _expired_timers) {
+		CheckTimeouts(static_cast<SocketNode*>(entry->context));
 	}
+	_expired_timers.clear();
+}
 
-	// Task 생성 및 큐에 추가
-	if (_task_queue) {
-		Task task(clientSocket, 0, packetData.data(), packetData.size());
-		_task_queue->enqueue(task);
-		std::cout << "[WorkerThread] 패킷 수신 완료 - 소켓: " << clientSocket
-			<< ", 크기: " << packetSize << " bytes" << std::endl;
+static uint64_t EarlierDeadline(uint64_t deadline, uint64_t since, uint64_t timeout)
+{
+	if (since == 0 || timeout == 0) {
+		return deadline;
 	}
-	else {
-		std::cerr << "[WorkerThread] Task 큐가 설정되지 않음" << std::endl;
+	uint64_t candidate = since + timeout;
+	return (deadline == 0 || candidate < deadline) ? candidate : deadline;
+}
+
+uint64_t WorkerThread::NextDeadline(const SocketNode* node) const
+{
+	uint64_t deadline = 0;
+	deadline = EarlierDeadline(deadline, node->last_recv_tick, _idle_timeout_ticks);
+	deadline = EarlierDeadline(deadline, node->partial_frame_tick, _frame_timeout_ticks);
+	if (PendingSendBytes(node) > 0) {
+		deadline = EarlierDeadline(deadline, node->send_progress_tick, _send_timeout_ticks);
+	}
+	return deadline;
+}
+
+void WorkerThread::UpdateTimer(SocketNode* node)
+{
+	uint64_t deadline = NextDeadline(node);
+	if (deadline == 0) {
+		_timers.Cancel(&node->timer);
+		return;
+	}
+	if (!node->timer.IsScheduled() || node->timer.expire_tick > deadline) {
+		_timers.ScheduleAt(&node->timer, deadline);
+	}
+}
+
+bool WorkerThread::CheckTimeouts(SocketNode* node)
+{
+	uint64_t now = _timers.CurrentTick();
+
+	// 처리 중인 요청 한도로 수신을 멈춘 동안은 클라이언트가 보내지 못하는 것이므로 유휴로 보지 않는다
+	if (node->read_paused) {
+		node->last_recv_tick = now;
+	}
+
+	const char* reason = nullptr;
+	if (_frame_timeout_ticks > 0 && node->partial_frame_tick != 0 && now >= node->partial_frame_tick + _frame_timeout_ticks) {
+		reason = "미완성 프레임 시간 초과";
+		_frame_timeouts.fetch_add(1, std::memory_order_relaxed);
+	}
+	else if (_send_timeout_ticks > 0 && PendingSendBytes(node) > 0 && now >= node->send_progress_tick + _send_timeout_ticks) {
+		reason = "응답 전송 정체";
+		_send_timeouts.fetch_add(1, std::memory_order_relaxed);
+	}
+	else if (_idle_timeout_ticks > 0 && now >= node->last_recv_tick + _idle_timeout_ticks) {
+		reason = "유휴 시간 초과";
+		_idle_timeouts.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	if (reason == nullptr) {
+		UpdateTimer(node);
+		return true;
+	}
+
+	std::cout << "[WorkerThread] " << reason << ", 연결 종료: " << node->socket << std::endl;
+	RemoveClient(node);
+	return false;
+}
+
+bool WorkerThread::CheckRateViolations(SocketNode* node)
+{
+	uint32_t violationLimit = _rate_policy.GetViolationLimit();
+	if (violationLimit == 0 || node->inbox->rate_violations.load(std::memory_order_relaxed) < violationLimit) {
+		return true;
+	}
+
+	std::cerr << "[WorkerThread] 속도 제한 위반 " << violationLimit << "회 - 연결 종료: " << node->socket << std::endl;
+	_rate_limit_disconnects.fetch_add(1);
+	RemoveClient(node);
+	return false;
+}
+
+bool WorkerThread::ExtractFrames(SocketNode* node)
+{
+	RingBuffer& buffer = node->recv_buffer;
+	if (!CheckRateViolations(node)) {
+		return false;
+	}
+	node->last_recv_tick = _timers.CurrentTick();
+
+	// 프레임마다 시계를 읽지 않도록 이번 수신분은 같은 시각으로 검사
+	std::chrono::steady_clock::time_point now;
+	if (_rate_policy.HasFrameLimit()) {
+		now = std::chrono::steady_clock::now();
+	}
+
+	bool frameCompleted = false;  // 이번 호출에서 완성된 프레임을 하나라도 꺼냈는지
+	while (buffer.Size() >= sizeof(uint32_t)) {
+		// 처리 중인 요청이 한도에 도달했으면 남은 바이트는 버퍼에 두고 재개될 때 이어서 꺼낸다
+		if (node->read_paused) {
+			break;
+		}
+
+		// 패킷 크기 확인 (4바이트 헤더, 네트워크 바이트 순서)
+		uint32_t packetSize = 0;
+		buffer.Peek(&packetSize, sizeof(packetSize));
+		packetSize = ntohl(packetSize);
+
+		if (packetSize == 0) {
+			std::cerr << "[WorkerThread] 빈 패킷 수신" << std::endl;
+			buffer.Consume(sizeof(packetSize)); // 빈 패킷은 무시하고 연결 유지
+			frameCompleted = true;
+			continue;
+		}
+
+		if (packetSize > MAX_PACKET_SIZE) {
+			std::cerr << "[WorkerThread] 패킷 크기 초과: " << packetSize << " bytes" << std::endl;
+			RemoveClient(node);
+			return false;
+		}
+
+		size_t frameSize = sizeof(packetSize) + packetSize;
+		if (buffer.Size() < frameSize) {
+			// 부분 패킷은 버퍼에 남겨두고 다음 준비 이벤트에서 이어서 조립
+			buffer.Reserve(frameSize);
+			break;
+		}
+		frameCompleted = true;
+
+		// 연결 전체 한도를 넘은 프레임은 버퍼를 할당하지 않고 바로 버린다
+		if (_rate_policy.HasFrameLimit() && !_rate_policy.AllowFrame(node->frame_bucket, now)) {
+			buffer.Consume(frameSize);
+			_rate_limited_frames.fetch_add(1, std::memory_order_relaxed);
+			node->inbox->rate_violations.fetch_add(1, std::memory_order_relaxed);
+			if (!CheckRateViolations(node)) {
+				return false;
+			}
+			continue;
+		}
+
+		buffer.Consume(sizeof(packetSize));
+		// 수신 링 버퍼에서 한 번만 복사하고 이후로는 핸들만 넘긴다 (DB 스레드가 이 메모리를 그대로 검증/파싱)
+		PacketBuffer packetData = PacketBuffer::Allocate(packetSize);
+		buffer.Read(packetData.writable_data(), packetSize);
+
+		// 연결 inbox에 넣고 작업 덱으로 예약 (검증과 Task 생성은 여유 있는 워커가 처리)
+		if (_db_pool) {
+			std::cout << "[WorkerThread] 패킷 수신 완료 - 소켓: " << node->socket
+				<< ", 크기: " << packetSize << " bytes" << std::endl;
+			ScheduleFrame(node, std::move(packetData));
+
+			if (_max_in_flight > 0 && _connections->AcquireInFlight(node->handle) >= _max_in_flight) {
+				PauseReading(node);
+			}
+		}
+		else {
+			std::cerr << "[WorkerThread] Task 큐가 설정되지 않음" << std::endl;
+		}
+	}
+
+	// 미완성 프레임이 처음 남은 시점부터 마감 시간을 잰다 (수신을 멈춘 동안은 서버 사정이므로 재지 않음)
+	// 이번에 프레임이 완성됐다면 남은 바이트는 다음 프레임의 앞부분이므로 지금부터 다시 잰다
+	// (요청을 이어 보내는 클라이언트는 버퍼가 좀처럼 비지 않아 처음 시각을 유지하면 정상 연결을 끊게 됨)
+	if (!buffer.Empty() && !node->read_paused) {
+		if (node->partial_frame_tick == 0 || frameCompleted) {
+			node->partial_frame_tick = _timers.CurrentTick();
+			if (_frame_timeout_ticks > 0) {
+				UpdateTimer(node);
+			}
+		}
+	}
+	else {
+		node->partial_frame_tick = 0;
+	}
+	return true;
+}
+
+#ifdef USE_IO_URING
+
+void WorkerThread::RunUringLoop()
+{
+	printf("[WorkerThread] WorkerThread 시작 (io_uring)\n");
+
+	IoCompletion completions[128];
+
+	while (_do_thread.load()) {
+		// 이전 루프에서 쌓인 recv/send 요청 제출과 완료 대기를 한 번의 시스템 콜로 처리
+		bool hasWork = HasLocalWork();
+		_idle.store(!hasWork);
+		int count = _uring->Wait(completions, 128, hasWork ? 0 : WaitTimeoutMs());
+		_idle.store(false);
+
+		if (count < 0) {
+			std::cerr << "[WorkerThread] io_uring 대기 에러: " << errno << std::endl;
+			continue;
+		}
+
+		for (int i = 0; i < count; ++i) {
+			HandleCompletion(completions[i]);
+		}
+		RecordEvents(count);
+
+		ArmNewNodes();
+		StartNewTimers();
+		ProcessTimers();
+		DrainOutbox();
+		RetryPendingDisconnects();
+		ProcessWork();
+	}
+	HandOverPendingDisconnects();
+
+	printf("[WorkerThread] WorkerThread 종료 (io_uring 시스템 콜: %llu, 완료 이벤트: %llu)\n",
+		static_cast<unsigned long long>(_uring->GetSubmitCalls()),
+		static_cast<unsigned long long>(_uring->GetCompletions()));
+}
+
+void WorkerThread::ArmNewNodes()
+{
+	std::vector<SocketNode*> nodes;
+	{
+		std::lock_guard<std::mutex> lock(_outbox_mutex);
+		if (_new_nodes.empty()) {
+			return;
+		}
+		nodes.swap(_new_nodes);
+	}
+
+	for (SocketNode* node : nodes) {
+		node->recv_armed = _uring->ArmRecv(node->socket, node);
+		if (!node->recv_armed) {
+			std::cerr << "[WorkerThread] io_uring recv 등록 실패: " << node->socket << std::endl;
+			RemoveClient(node);
+		}
+	}
+}
+
+void WorkerThread::HandleCompletion(const IoCompletion& completion)
+{
+	SocketNode* node = static_cast<SocketNode*>(completion.context);
+
+	if (completion.op == IOURING_OP_SEND) {
+		node->send_in_flight = false;
+		if (node->closing) {
+			TryFinalizeClosing(node);
+			return;
+		}
+		if (completion.result < 0) {
+			std::cerr << "[WorkerThread] 데이터 전송 실패: " << -completion.result << std::endl;
+			RemoveClient(node);
+			return;
+		}
+
+		// 일부만 전송됐으면 나머지를, 다 보냈으면 그동안 쌓인 응답을 이어서 보냄
+		node->uring_send_offset += static_cast<size_t>(completion.result);
+		if (completion.result > 0) {
+			node->send_progress_tick = _timers.CurrentTick();
+		}
+		SubmitUringSend(node);
+		return;
+	}
+
+	if (completion.op != IOURING_OP_RECV) {
+		return;
+	}
+
+	if (!completion.more) {
+		node->recv_armed = false;  // multishot이 끝남 (버퍼 고갈, 에러, EOF)
+	}
+
+	if (node->closing) {
+		if (completion.has_buffer) {
+			_uring->ReleaseBuffer(completion.buffer_id);
+		}
+		TryFinalizeClosing(node);
+		return;
+	}
+
+	if (completion.result > 0) {
+		// 제공 버퍼는 바로 돌려주고 조립은 기존 수신 링 버퍼에서 처리
+		node->recv_buffer.Write(completion.data, static_cast<size_t>(completion.result));
+		_uring->ReleaseBuffer(completion.buffer_id);
+
+		if (!ExtractFrames(node)) {
+			return; // 프로토콜 위반으로 노드가 해제됨
+		}
+		if (!node->recv_armed && !node->read_paused) {
+			node->recv_armed = _uring->ArmRecv(node->socket, node);
+		}
+		return;
+	}
+
+	if (completion.has_buffer) {
+		_uring->ReleaseBuffer(completion.buffer_id);
+	}
+
+	if (completion.result == 0) {
+		std::cout << "[WorkerThread] 클라이언트가 연결을 정상 종료" << std::endl;
+		RemoveClient(node);
+		return;
+	}
+
+	if (completion.result == -ENOBUFS || completion.result == -ECANCELED) {
+		// 제공 버퍼가 잠시 모두 사용 중이었거나 수신 중단으로 취소됨 - 수신 중이면 다시 건다
+		if (!node->recv_armed && !node->read_paused) {
+			node->recv_armed = _uring->ArmRecv(node->socket, node);
+		}
+		return;
+	}
+
+	std::cout << "[WorkerThread] 클라이언트 연결 종료/에러 - 에러코드: " << -completion.result << std::endl;
+	RemoveClient(node);
+}
+
+bool WorkerThread::SubmitUringSend(SocketNode* node)
+{
+	if (node->send_in_flight) {
+		return true; // 완료 후 이어서 보냄
+	}
+
+	if (node->uring_send_offset >= node->uring_sending.size()) {
+		node->uring_sending.clear();
+		node->uring_send_offset = 0;
+
+		RingBuffer& buffer = node->send_buffer;
+		if (buffer.Empty()) {
+			if (node->slow_consumer) {
+				node->slow_consumer = false;
+				std::cout << "[WorkerThread] 느린 클라이언트 해소 - 소켓: " << node->socket << std::endl;
+			}
+			return true;
+		}
+
+		// 그동안 쌓인 응답을 모두 옮겨 한 번의 send로 보냄
+		node->uring_sending.resize(buffer.Size());
+		buffer.Read(node->uring_sending.data(), node->uring_sending.size());
+	}
+
+	if (!_uring->Send(node->socket, node, node->uring_sending.data() + node->uring_send_offset,
+		node->uring_sending.size() - node->uring_send_offset)) {
+		std::cerr << "[WorkerThread] io_uring send 등록 실패: " << node->socket << std::endl;
+		RemoveClient(node);
+		return false;
+	}
+	node->send_in_flight = true;
+	return true;
+}
+
+void WorkerThread::TryFinalizeClosing(SocketNode* node)
+{
+	if (node->recv_armed || node->send_in_flight) {
+		return;
+	}
+
+	for (size_t i = 0; i < _closing_nodes.size(); ++i) {
+		if (_closing_nodes[i] == node) {
+			_closing_nodes[i] = _closing_nodes.back();
+			_closing_nodes.pop_back();
+			break;
+		}
+	}
+
+	closesocket(node->socket);
+	delete node;
+}
+
+#endif
+
+void WorkerThread::SetPeers(const std::vector<WorkerThread*>& peers)
+{
+	_peers.clear();
+	for (WorkerThread* peer : peers) {
+		if (peer != this) {
+			_peers.push_back(peer);
+		}
+	}
+}
+
+void WorkerThread::ScheduleFrame(SocketNode* node, PacketBuffer&& frame)
+{
+	bool needSchedule = false;
+	{
+		std::lock_guard<std::mutex> lock(node->inbox->mutex);
+		node->inbox->frames.push_back(std::move(frame));
+		if (!node->inbox->scheduled) {
+			node->inbox->scheduled = true;
+			needSchedule = true;
+		}
+	}
+
+	// 이미 예약되어 있으면 처리 중인 워커가 이어서 가져간다
+	if (needSchedule) {
+		std::shared_ptr<ConnectionInbox> inbox = node->inbox;
+		PushWork(std::move(inbox));
+	}
+}
+
+void WorkerThread::PushWork(std::shared_ptr<ConnectionInbox>&& inbox)
+{
+	size_t pending = 0;
+	{
+		std::lock_guard<std::mutex> lock(_work_mutex);
+		_work_deque.push_back(std::move(inbox));
+		pending = _work_deque.size();
+	}
+
+	if (pending >= WORK_STEAL_THRESHOLD) {
+		NotifyIdlePeer();
+	}
+}
+
+bool WorkerThread::PopLocalWork(std::shared_ptr<ConnectionInbox>& inbox)
+{
+	std::lock_guard<std::mutex> lock(_work_mutex);
+	if (_work_deque.empty()) {
+		return false;
+	}
+	inbox = std::move(_work_deque.front());
+	_work_deque.pop_front();
+	return true;
+}
+
+bool WorkerThread::TrySteal(std::shared_ptr<ConnectionInbox>& inbox)
+{
+	// 소유 워커를 오래 막지 않도록 잠금을 바로 얻지 못하면 포기
+	std::unique_lock<std::mutex> lock(_work_mutex, std::try_to_lock);
+	if (!lock.owns_lock() || _work_deque.empty()) {
+		return false;
+	}
+	inbox = std::move(_work_deque.back());
+	_work_deque.pop_back();
+	return true;
+}
+
+bool WorkerThread::StealWork(std::shared_ptr<ConnectionInbox>& inbox)
+{
+	for (size_t i = 0; i < _peers.size(); ++i) {
+		WorkerThread* victim = _peers[(_steal_cursor + i) % _peers.size()];
+		if (victim->TrySteal(inbox)) {
+			// 다음에는 다른 워커부터 시도해서 한 워커에 몰리지 않게 함
+			_steal_cursor = (_steal_cursor + i + 1) % _peers.size();
+			return true;
+		}
+	}
+	return false;
+}
+
+bool WorkerThread::HasLocalWork()
+{
+	std::lock_guard<std::mutex> lock(_work_mutex);
+	return !_work_deque.empty();
+}
+
+void WorkerThread::NotifyIdlePeer()
+{
+	for (size_t i = 0; i < _peers.size(); ++i) {
+		WorkerThread* peer = _peers[(_steal_cursor + i) % _peers.size()];
+		if (peer->IsIdle()) {
+			peer->WakeupLoop();
+			return;
+		}
+	}
+}
+
+void WorkerThread::ProcessWork()
+{
+	for (int processed = 0; processed < WORK_BATCH_LIMIT; ++processed) {
+		std::shared_ptr<ConnectionInbox> inbox;
+		if (!PopLocalWork(inbox) && !StealWork(inbox)) {
+			return;
+		}
+		ProcessInbox(inbox);
+	}
+}
+
+void WorkerThread::RejectRequest(WorkerThread* owner, ConnectionHandle handle, EventType requestType, uint32_t requestId, uint32_t afterRequest)
+{
+	// DB 처리를 기다리지 않고 실패 응답을 보내 클라이언트가 재시도 여부를 정하게 함
+	// 같은 연결의 앞선 요청 응답보다 먼저 나가지 않도록 소유 워커가 afterRequest가 끝날 때까지 붙잡아 둔다
+	// (여기서 이미 끝난 것을 봤다면 그 응답은 outbox에 먼저 들어가 있으므로 기다릴 필요가 없음)
+	if (afterRequest != 0 && !ConnectionSlab::IsEarlierRequest(_connections->GetCompletedRequest(handle), afterRequest)) {
+		afterRequest = 0;
+	}
+
+	PacketBuffer busyResponse = _packet_manager->CreateGenericErrorResponse(
+		_packet_manager->GetResponseType(requestType), ResultCode_FAIL, handle);
+	if (owner != nullptr && !busyResponse.empty()) {
+		owner->PushOutbox({ handle, std::move(busyResponse), requestId, afterRequest, true });
+	}
+	ReleaseInFlight(handle);
+}
+
+void WorkerThread::FlushTasks(const std::shared_ptr<ConnectionInbox>& inbox, std::vector<Task>& tasks)
+{
+	if (tasks.empty()) {
+		return;
+	}
+
+	WorkerThread* owner = _connections->FindWorker(inbox->handle);
+
+	// DB 동시성 제한기를 통과한 요청만 앞으로 모음 (DB가 느려지면 우선순위가 낮은 요청부터 거절됨)
+	// 거절 응답은 큐에 넣기 전에 보내야 뒤 요청의 응답보다 먼저 소유 워커에 도착한다
+	auto now = std::chrono::steady_clock::now();
+	size_t admitted = 0;
+	size_t shed = 0;
+	uint32_t lastAdmitted = inbox->last_queued_request;
+	for (size_t i = 0; i < tasks.size(); ++i) {
+		if (!_db_limiter->TryAcquire(ConcurrencyLimiter::PriorityOf(tasks[i].event_type))) {
+			RejectRequest(owner, tasks[i].client_handle, tasks[i].event_type, tasks[i].id, lastAdmitted);
+			++shed;
+			continue;
+		}
+		lastAdmitted = tasks[i].id;
+
+		tasks[i].admitted_at = now;
+		if (admitted != i) {
+			tasks[admitted] = std::move(tasks[i]);
+		}
+		++admitted;
+	}
+	if (shed > 0) {
+		std::cerr << "[WorkerThread] DB 동시성 한도로 요청 " << shed << "개 거절 - 소켓: " << inbox->socket << std::endl;
+	}
+
+	// 완료 알림이 먼저 와도 0 아래로 내려가지 않도록 큐에 넣기 전에 올려 둔다
+	_connections->AcquireDbPending(inbox->handle, static_cast<uint32_t>(admitted));
+	size_t queued = _db_pool->QueueFor(inbox->ShardKey())->enqueue_bulk(tasks.data(), admitted);
+	if (queued > 0) {
+		inbox->last_queued_request = tasks[queued - 1].id;
+	}
+	if (queued < admitted) {
+		_connections->ReleaseDbPending(inbox->handle, static_cast<uint32_t>(admitted - queued));
+
+		// 요청 큐가 가득 참
+		size_t rejected = admitted - queued;
+		_rejected_requests.fetch_add(rejected);
+		std::cerr << "[WorkerThread] 요청 큐가 가득 차 요청 " << rejected
+			<< "개 거절 - 소켓: " << inbox->socket << std::endl;
+
+		// 넣지 못한 요청은 뒤쪽에 모여 있으므로 마지막으로 넣은 요청이 끝난 뒤에 실패 응답
+		for (size_t i = queued; i < admitted; ++i) {
+			_db_limiter->Release(std::chrono::steady_clock::duration::zero(), false);
+			RejectRequest(owner, tasks[i].client_handle, tasks[i].event_type, tasks[i].id, inbox->last_queued_request);
+		}
+	}
+	tasks.clear();
+}
+
+bool WorkerThread::QueueDisconnect(const std::shared_ptr<ConnectionInbox>& inbox)
+{
+	// 마지막 요청과 같은 샤드로 보내 저장 -> 연결 해제 순서를 지킨다
+	Task disconnectTask(inbox->handle, TaskType::CLIENT_DISCONNECTED);
+	return _db_pool->QueueFor(inbox->ShardKey())->enqueue(disconnectTask);
+}
+
+void WorkerThread::RetryPendingDisconnects()
+{
+	if (_pending_disconnects.empty()) {
+		return;
+	}
+
+	size_t kept = 0;
+	for (size_t i = 0; i < _pending_disconnects.size(); ++i) {
+		if (QueueDisconnect(_pending_disconnects[i])) {
+			continue;
+		}
+		if (kept != i) {
+			_pending_disconnects[kept] = std::move(_pending_disconnects[i]);
+		}
+		++kept;
+	}
+	_pending_disconnects.resize(kept);
+}
+
+void WorkerThread::HandOverPendingDisconnects()
+{
+	for (const std::shared_ptr<ConnectionInbox>& inbox : _pending_disconnects) {
+		_db_pool->DeferDisconnect(inbox->handle);
+	}
+	_pending_disconnects.clear();
+}
+
+void WorkerThread::ProcessInbox(const std::shared_ptr<ConnectionInbox>& inbox)
+{
+	std::deque<PacketBuffer> frames;
+	{
+		std::lock_guard<std::mutex> lock(inbox->mutex);
+		frames.swap(inbox->frames);
+	}
+
+	// 연결 하나의 요청들을 모아 요청 큐에 한 번에 넣음
+	std::vector<Task> tasks;
+	tasks.reserve(frames.size());
+
+	WorkerThread* owner = nullptr;
+	size_t rateLimited = 0;
+	auto now = std::chrono::steady_clock::now();
+	if (inbox->event_buckets.size() != _rate_policy.EventBucketCount()) {
+		inbox->event_buckets.resize(_rate_policy.EventBucketCount());
+	}
+
+	for (PacketBuffer& frame : frames) {
+		if (frame.empty()) {
+			// 연결 해제 표시 - 앞선 요청이 모두 넘어간 뒤에 알린다
+			FlushTasks(inbox, tasks);
+
+			// 세션 정리가 빠지면 안 되지만 큐가 빌 때까지 기다리면 이 워커의 모든 소켓이 멈추므로,
+			// 가득 차 있으면 미뤄두고 다음 루프에서 다시 넣는다 (해제 표시는 연결의 마지막 프레임)
+			if (!QueueDisconnect(inbox)) {
+				_pending_disconnects.push_back(inbox);
+			}
+			continue;
+		}
+
+		// DB 스레드까지 가기 전에 깨진 패킷을 걸러냄 (검증은 여기서 한 번만 하고 종류를 Task에 실어 보낸다)
+		EventType requestType = _packet_manager->GetPacketType(frame.data(), frame.size());
+		if (requestType == EventType_NONE) {
+			std::cerr << "[WorkerThread] 잘못된 패킷 무시 - 소켓: " << inbox->socket
+				<< ", 크기: " << frame.size() << " bytes" << std::endl;
+			ReleaseInFlight(inbox->handle);
+			continue;
+		}
+
+		uint32_t requestId = inbox->NextRequestId();
+
+		// 요청 종류별 한도를 넘으면 요청 큐에 넣지 않고 실패 응답 (앞서 모은 요청보다 먼저 나가지는 않음)
+		if (!_rate_policy.AllowEvent(inbox->event_buckets, requestType, now)) {
+			if (owner == nullptr) {
+				owner = _connections->FindWorker(inbox->handle);
+			}
+			RejectRequest(owner, inbox->handle, requestType, requestId,
+				tasks.empty() ? inbox->last_queued_request : tasks.back().id);
+			inbox->rate_violations.fetch_add(1, std::memory_order_relaxed);
+			++rateLimited;
+			continue;
+		}
+
+		// user_id를 실은 요청이 오면 그 사용자의 샤드로 옮김
+		// 앞선 요청이 이전 샤드에 남아 있으면 앞지를 수 있으므로 모두 끝난 뒤에만 옮기고, 그 전까지는 이전 샤드에 이어서 넣는다
+		// 슬롯이 반납된 뒤(연결 종료 중)에는 대기 수를 셀 수 없으므로 옮기지 않는다 - 남은 요청과 연결 해제 알림은 마지막 샤드로 간다
+		uint32_t userId = _packet_manager->GetRequestUserId(frame.data(), requestType);
+		if (userId != 0 && userId != inbox->shard_user_id &&
+			tasks.empty() && _connections->IsDbIdle(inbox->handle)) {
+			inbox->shard_user_id = userId;
+		}
+
+		// 프레임 버퍼를 그대로 넘겨 복사하지 않음
+		tasks.emplace_back(inbox->handle, std::move(frame), requestType);
+		tasks.back().id = requestId;
+	}
+	FlushTasks(inbox, tasks);
+
+	if (rateLimited > 0) {
+		_rate_limited_requests.fetch_add(rateLimited, std::memory_order_relaxed);
+		std::cerr << "[WorkerThread] 요청 종류별 속도 제한으로 요청 " << rateLimited << "개 거절 - 소켓: " << inbox->socket << std::endl;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(inbox->mutex);
+		if (inbox->frames.empty()) {
+			inbox->scheduled = false;
+			return;
+		}
+	}
+
+	// 처리하는 동안 새 프레임이 도착함 - 순서를 지키기 위해 예약 상태를 유지한 채 다시 넣는다
+	std::shared_ptr<ConnectionInbox> again = inbox;
+	PushWork(std::move(again));
+}
+
+void WorkerThread::Join()
+{
+	StopThread();
+	WakeupLoop();
+
+	if (_thread && _thread->joinable()) {
+		_thread->join();
 	}
 }
 
@@ -1,64 +1,318 @@
 ﻿#pragma once
 #include <list>
+#include <deque>
 #include <thread>
 #include <atomic>
 #include <memory>
 #include <mutex>
 #include <vector>
+#include <chrono>
 #include "Packet.h"
+#include "RingBuffer.h"
+#include "ServerConfig.h"
+#include "RateLimiter.h"
+#include "TimerWheel.h"
+#include "TaskQueue.h"
 
-template<typename T>
-class LockFreeQueue;
+class Reactor;
+class ConnectionSlab;
+class DatabasePool;
+class ConcurrencyLimiter;
+class ServerPacketManager;
+#ifdef USE_IO_URING
+class IoUring;
+struct IoCompletion;
+#endif
 
-#define MAX_CLIENT_COUNT 50
+#define WORKER_WAIT_TIMEOUT_MS 100
+#define WORKER_RETRY_WAIT_MS 5           // 미뤄둔 연결 해제 알림이나 거절 응답이 있을 때의 대기 타임아웃 (요청 큐가 비거나 앞선 요청이 끝나는 대로 처리하기 위해)
+#define WORKER_TIMER_TICK_MS 100         // 연결 타임아웃 휠의 틱 (대기 타임아웃과 맞춰 루프마다 한 칸씩 진행)
+#define WORKER_RATE_SAMPLE_MS 1000       // 이벤트 처리량 측정 주기
+#define WORKER_RATE_EWMA_ALPHA 0.3       // 최근 측정값 반영 비율
+#define WORKER_LOAD_EVENT_WEIGHT 0.1     // 초당 이벤트 10개를 연결 1개만큼의 부하로 본다
+#define WORK_STEAL_THRESHOLD 2          // 작업 덱에 이만큼 쌓이면 쉬고 있는 워커를 깨워 가져가게 함
+#define WORK_BATCH_LIMIT 64             // 한 루프에서 처리할 최대 작업 수 (I/O 응답성 유지)
+#define MAX_PACKET_SIZE 65536           // 최대 64KB 제한
+#define RECV_BUFFER_INITIAL_SIZE 4096   // 연결별 수신 링 버퍼 초기 크기
+#define SEND_BUFFER_INITIAL_SIZE 4096   // 연결별 송신 링 버퍼 초기 크기
+#define SEND_BUFFER_HIGH_WATER (256 * 1024)        // 이 이상 쌓이면 느린 소비자로 표시
+#define SEND_BUFFER_HARD_LIMIT (4 * 1024 * 1024)   // 이 이상 쌓이면 연결 종료
 
-// Lock-free 노드 구조체
+// 연결 하나의 수신 프레임 묶음 (work stealing 작업 단위)
+// - 한 번에 한 워커만 처리하므로(scheduled) 다른 워커가 가져가도 연결별 순서가 유지된다.
+// - 노드가 해제된 뒤에도 남은 프레임을 처리할 수 있도록 shared_ptr로 공유한다.
+struct ConnectionInbox {
+    SOCKET socket;             // 로그용
+    ConnectionHandle handle;   // Task에 실어 보낼 연결 핸들
+    std::mutex mutex;
+    std::deque<PacketBuffer> frames;  // 빈 프레임은 연결 해제 표시
+    bool scheduled;  // 작업 덱에 들어가 있거나 처리 중인지
+
+    // 요청 종류별 토큰 버킷 (scheduled로 한 번에 한 워커만 처리하므로 잠그지 않는다)
+    std::vector<TokenBucket> event_buckets;
+    // 속도 제한 위반 횟수 (어느 워커나 올리고, 소유 워커가 프레임을 조립할 때 보고 연결을 끊는다)
+    std::atomic<uint32_t> rate_violations;
+    // 요청을 보낼 DB 샤드의 사용자 (0이면 아직 user_id를 실은 요청이 없어 연결 핸들로 보냄)
+    uint32_t shard_user_id;
+    // 연결별 요청 번호 (Task.id로 실어 보내 응답과 거절 응답을 요청 순서대로 보낸다, 0은 쓰지 않음)
+    uint32_t last_request_id;
+    // 마지막으로 요청 큐에 넣은 요청 번호 (거절 응답은 이 요청이 끝난 뒤에 보낸다)
+    uint32_t last_queued_request;
+
+    ConnectionInbox(SOCKET s) : socket(s), handle(INVALID_CONNECTION_HANDLE), scheduled(false), rate_violations(0), shard_user_id(0),
+        last_request_id(0), last_queued_request(0) {}
+
+    uint32_t ShardKey() const { return shard_user_id != 0 ? shard_user_id : handle; }
+    uint32_t NextRequestId() {
+        if (++last_request_id == 0) {
+            last_request_id = 1;
+        }
+        return last_request_id;
+    }
+};
+
+// 앞선 요청이 끝나기를 기다리는 거절 응답, 또는 그 거절 응답보다 뒤 요청의 응답
+struct DeferredResponse {
+    uint32_t request_id;
+    uint32_t after_request;  // 거절 응답이면 먼저 끝나야 하는 요청 번호 (0이면 없음)
+    bool rejection;
+    PacketBuffer data;
+};
+
+// 연결 하나의 상태 (ConnectionSlab 슬롯에 등록되어 핸들로 찾는다)
 struct SocketNode {
     SOCKET socket;
-    std::atomic<SocketNode*> next;
+    ConnectionHandle handle; // AddClient에서 슬랩 등록 후 설정
+    RingBuffer recv_buffer;  // 아직 완성되지 않은 패킷을 이어 붙이는 수신 버퍼 (워커 스레드 전용)
+    RingBuffer send_buffer;  // 아직 커널로 넘기지 못한 응답 바이트 (워커 스레드 전용)
+    bool write_interest;     // Reactor에 쓰기 가능 통지를 요청했는지 여부
+    bool slow_consumer;      // 송신 버퍼가 high-water mark를 넘었는지 여부
+    bool flush_pending;      // 이번 루프에서 응답이 추가되어 한 번에 내보내야 하는지 여부
+    bool read_paused;        // 처리 중인 요청이 한도에 도달해 수신을 멈췄는지 여부
+    TokenBucket frame_bucket; // 연결 전체 프레임 속도 제한 (워커 스레드 전용)
+    TimerEntry timer;             // 가장 가까운 타임아웃에 걸어 두는 타이머 (워커 스레드 전용)
+    uint64_t last_recv_tick;      // 마지막으로 데이터를 받은 틱 (유휴 타임아웃)
+    uint64_t partial_frame_tick;  // 미완성 프레임이 버퍼에 남기 시작한 틱 (0이면 없음)
+    uint64_t send_progress_tick;  // 보낼 데이터가 남은 동안 마지막으로 전송이 진척된 틱
+    std::shared_ptr<ConnectionInbox> inbox;  // 조립이 끝난 프레임 (처리는 아무 워커나 가능)
+    // 요청 순서를 지키기 위해 붙잡아 둔 응답 (요청 번호 순, 워커 스레드 전용)
+    std::deque<DeferredResponse> deferred_responses;
+    uint32_t rejected_through;    // 마지막으로 보낸 거절 응답의 요청 번호 (그 앞 요청은 모두 끝남)
+    uint32_t completed_snapshot;  // outbox를 꺼내기 전에 읽은 마지막 완료 요청 번호
+
+#ifdef USE_IO_URING
+    // io_uring 모드: 커널이 전송을 끝낼 때까지 메모리가 움직이면 안 되므로 송신 버퍼에서 옮겨 담아 보낸다
+    std::vector<uint8_t> uring_sending;
+    size_t uring_send_offset;
+    bool send_in_flight;  // 완료되지 않은 send 요청이 있는지
+    bool recv_armed;      // multishot recv가 걸려 있는지
+    bool closing;         // 리스트에서 빠졌고 남은 요청이 끝나면 해제됨
+#endif
 
-    SocketNode(SOCKET s) : socket(s), next(nullptr) {}
+    SocketNode(SOCKET s)
+        : socket(s), handle(INVALID_CONNECTION_HANDLE), recv_buffer(RECV_BUFFER_INITIAL_SIZE), send_buffer(SEND_BUFFER_INITIAL_SIZE),
+        write_interest(false), slow_consumer(false), flush_pending(false), read_paused(false),
+        timer(this), last_recv_tick(0), partial_frame_tick(0), send_progress_tick(0), inbox(std::make_shared<ConnectionInbox>(s)),
+        rejected_through(0), completed_snapshot(0)
+#ifdef USE_IO_URING
+        , uring_send_offset(0), send_in_flight(false), recv_armed(false), closing(false)
+#endif
+    {}
+};
+
+// 다른 스레드가 요청한 전송 (워커 스레드가 꺼내서 해당 연결의 송신 버퍼에 붙인다)
+// data가 비어 있으면 수신 재개 요청 (처리 중인 요청 수가 한도 아래로 내려감)
+struct OutboundMessage {
+    ConnectionHandle handle;
+    PacketBuffer data;
+    uint32_t request_id;     // 응답한 요청 번호 (0이면 순서와 관계없는 전송)
+    uint32_t after_request;  // 거절 응답이면 먼저 끝나야 하는 요청 번호
+    bool rejection;
 };
 
 class WorkerThread
 {
 private:
     std::atomic<bool> _do_thread;
-    std::atomic<SocketNode*> _head;  // Lock-free linked list head
-    std::atomic<SocketNode*> _tail;  // Lock-free linked list tail
     std::atomic<int> _client_count;  // 클라이언트 수 추적
+    std::atomic<double> _event_rate; // 초당 처리 이벤트 수 (EWMA), 연결 배치에 사용
+    uint64_t _sample_events;         // 현재 측정 구간에 처리한 이벤트 수 (워커 스레드 전용)
+    std::chrono::steady_clock::time_point _sample_start;
     std::unique_ptr<std::thread> _thread;
+    std::unique_ptr<Reactor> _reactor;  // 소켓 준비 상태 통지 (epoll / WSAPoll), io_uring 모드에서는 nullptr
+#ifdef USE_IO_URING
+    std::unique_ptr<IoUring> _uring;           // 완료 기반 I/O (선택 시)
+    std::vector<SocketNode*> _new_nodes;       // AddClient로 들어와 아직 recv를 걸지 않은 노드 (_outbox_mutex로 보호)
+    std::vector<SocketNode*> _closing_nodes;   // 커널 요청이 남아 해제를 미룬 노드
+#endif
+
+    DatabasePool* _db_pool;  // DB 실행기 풀 참조 (연결마다 정해진 실행기의 요청 큐로 Task를 넘긴다)
+    ConnectionSlab* _connections;      // 연결 슬랩 참조 (서버 소유, 이 워커의 연결도 여기서 찾는다)
+    ConcurrencyLimiter* _db_limiter;   // DB 실행기 앞단 동시성 제한기 참조 (서버 소유)
+    std::unique_ptr<ServerPacketManager> _packet_manager;  // 프레임 검증/거절 응답 생성용 (워커별)
+    uint32_t _max_in_flight;           // 연결당 처리 중인 요청 한도 (0이면 제한 없음)
+    RateLimitPolicy _rate_policy;      // 연결당/요청 종류별 속도 제한 (설정에서 복사, 읽기 전용)
 
-    LockFreeQueue<Task>* _task_queue;  // Task 큐 참조
-    std::mutex _send_mutex;  // 전송 시 동기화용
+    std::atomic<uint64_t> _rejected_requests;  // 요청 큐가 가득 차 실패 응답으로 돌려보낸 요청 수
+    std::atomic<uint64_t> _read_pauses;        // 처리 중인 요청 한도로 수신을 멈춘 횟수
+    std::atomic<uint64_t> _rate_limited_frames;    // 연결 프레임 한도를 넘어 버린 프레임 수
+    std::atomic<uint64_t> _rate_limited_requests;  // 요청 종류별 한도를 넘어 실패 응답으로 돌려보낸 요청 수
+    std::atomic<uint64_t> _rate_limit_disconnects; // 속도 제한 위반이 쌓여 끊은 연결 수
+
+    // 연결 타임아웃 (워커 스레드 전용, 시간 초과 값은 틱 단위이고 0이면 검사하지 않음)
+    TimerWheel _timers;
+    std::vector<TimerEntry*> _expired_timers;
+    std::vector<ConnectionHandle> _new_timer_handles;  // AddClient로 들어와 아직 타이머를 걸지 않은 연결 (_outbox_mutex로 보호)
+    // 요청 큐가 가득 차 아직 넘기지 못한 연결 해제 알림 (워커 스레드 전용, 루프를 돌 때마다 다시 시도)
+    std::vector<std::shared_ptr<ConnectionInbox>> _pending_disconnects;
+    // 앞선 요청이 끝나기를 기다리는 응답이 있는 연결 (워커 스레드 전용, outbox를 비울 때마다 다시 확인)
+    std::vector<ConnectionHandle> _deferred_handles;
+    uint64_t _idle_timeout_ticks;
+    uint64_t _frame_timeout_ticks;
+    uint64_t _send_timeout_ticks;
+    std::atomic<uint64_t> _idle_timeouts;   // 유휴 시간 초과로 끊은 연결 수
+    std::atomic<uint64_t> _frame_timeouts;  // 미완성 프레임 시간 초과(slowloris)로 끊은 연결 수
+    std::atomic<uint64_t> _send_timeouts;   // 응답을 가져가지 않아 끊은 연결 수
+
+    // work stealing: 소유 워커는 앞에서, 다른 워커는 뒤에서 꺼낸다
+    std::mutex _work_mutex;
+    std::deque<std::shared_ptr<ConnectionInbox>> _work_deque;
+    std::vector<WorkerThread*> _peers;  // 훔쳐올 대상 (자신 제외), 시작 전에 한 번만 설정
+    size_t _steal_cursor;
+    std::atomic<bool> _idle;            // 작업 없이 I/O 대기 중인지
+
+    std::mutex _outbox_mutex;                 // _outbox 보호용 (짧게만 잡는다)
+    std::vector<OutboundMessage> _outbox;     // 워커 스레드로 넘길 전송 요청
+
+    // 설정에 따라 reactor 또는 io_uring을 준비 (io_uring 실패 시 reactor로 대체)
+    void InitializeIo(const ServerConfig& config);
+    // 새 노드를 I/O 대기 대상으로 등록 (AddClient를 호출한 스레드에서 실행)
+    void RegisterNode(SocketNode* node);
+    // 슬랩에서 빠진 노드의 소켓을 닫고 메모리를 해제
+    void ReleaseNode(SocketNode* node);
+    void WakeupLoop();
+    // 처리한 이벤트 수를 누적하고 측정 주기가 지나면 _event_rate 갱신
+    void RecordEvents(int count);
 
     void RunOnServerThread();
-    void ProcessClientData(SOCKET clientSocket, char* buffer, int bufferSize);
+    void HandleSocketEvent(SocketNode* node, uint32_t events);
 
-    // Lock-free 리스트에서 노드 제거 (내부용으로 사용)
-    void RemoveSocketFromList(SOCKET target_socket);
+#ifdef USE_IO_URING
+    void RunUringLoop();
+    void HandleCompletion(const IoCompletion& completion);
+    void ArmNewNodes();
+    bool SubmitUringSend(SocketNode* node);
+    // 남은 커널 요청이 없으면 노드를 실제로 해제
+    void TryFinalizeClosing(SocketNode* node);
+#endif
 
-public:
-    // 기존 생성자 (하위 호환성)
-    WorkerThread(SOCKET ClientSocket);
+    // 새 연결에 타이머를 걸고, 만료된 타이머의 연결을 검사해 시간 초과면 끊는다 (루프마다 호출)
+    void StartNewTimers();
+    void ProcessTimers();
+    bool CheckTimeouts(SocketNode* node);
+    // 연결의 가장 가까운 타임아웃 틱으로 타이머를 당김 (더 늦어지는 경우는 만료될 때 다시 건다)
+    void UpdateTimer(SocketNode* node);
+    uint64_t NextDeadline(const SocketNode* node) const;
+
+    // 수신 가능한 바이트를 링 버퍼로 모두 읽어들임 (연결이 끊겨 노드가 해제되면 false)
+    bool ReceiveFromClient(SocketNode* node);
+    // 링 버퍼에서 완성된 길이-접두 패킷을 모두 꺼내 Task로 넘김 (프로토콜 위반으로 연결을 끊으면 false)
+    bool ExtractFrames(SocketNode* node);
+    // 속도 제한 위반이 한도에 도달한 연결을 끊음 (끊었으면 false)
+    bool CheckRateViolations(SocketNode* node);
 
-    // 새로운 생성자 (Task 큐 포함)
-    WorkerThread(SOCKET ClientSocket, LockFreeQueue<Task>* taskQueue);
+    // _outbox에 쌓인 전송 요청을 각 연결의 송신 버퍼로 옮긴 뒤 연결마다 한 번씩 전송
+    void DrainOutbox();
+    // 헤더를 붙여 송신 버퍼에 추가 (한도를 넘어 연결을 끊으면 false)
+    bool QueueSend(SocketNode* node, const PacketBuffer& data);
+    // 송신 버퍼에 추가하고 이번 루프에 내보낼 연결로 표시 (연결을 끊으면 false)
+    bool QueueResponse(SocketNode* node, const PacketBuffer& data, std::vector<ConnectionHandle>& touched);
+    // 요청 번호 순서를 지키며 응답을 붙잡아 둠
+    void DeferResponse(SocketNode* node, OutboundMessage& message);
+    // 앞선 요청이 끝난 거절 응답과 그 뒤의 응답을 순서대로 내보냄 (모두 내보냈거나 연결을 끊었으면 true)
+    bool FlushDeferredResponses(SocketNode* node, std::vector<ConnectionHandle>& touched);
+    // 요청이 끝나 응답이 모두 나갔는지 (DB 완료는 outbox를 꺼내기 전에 읽은 값으로 판단)
+    bool IsRequestSettled(const SocketNode* node, uint32_t requestId) const;
+    // 다른 스레드에서 온 전송 요청을 outbox에 넣고 필요하면 깨움
+    void PushOutbox(OutboundMessage&& message);
+    // 송신 버퍼를 gather write로 WOULDBLOCK이 날 때까지 전송하고 쓰기 관심을 갱신 (연결을 끊으면 false)
+    bool FlushSendBuffer(SocketNode* node);
+    // 처리 중인 요청이 한도에 도달한 연결의 수신을 멈추고, 한도 아래로 내려가면 다시 읽는다
+    void PauseReading(SocketNode* node);
+    void ResumeReading(SocketNode* node);
+    // 수신 재개 요청을 소유 워커 스레드로 넘김 (어느 스레드에서나 호출 가능)
+    void RequestResume(ConnectionHandle handle);
+    uint32_t ReadInterest(const SocketNode* node) const;
+
+    // 이 워커가 소유한 살아있는 연결의 노드 (끊긴 연결의 핸들이면 nullptr)
+    SocketNode* FindNode(ConnectionHandle handle) const;
+    size_t PendingSendBytes(const SocketNode* node) const;
+
+    // 프레임을 연결 inbox에 넣고, 처음 들어온 경우 작업 덱에 연결을 등록
+    void ScheduleFrame(SocketNode* node, PacketBuffer&& frame);
+    void PushWork(std::shared_ptr<ConnectionInbox>&& inbox);
+    bool PopLocalWork(std::shared_ptr<ConnectionInbox>& inbox);
+    bool StealWork(std::shared_ptr<ConnectionInbox>& inbox);
+    bool HasLocalWork();
+    void NotifyIdlePeer();
+    // 자신의 작업과 훔쳐온 작업을 WORK_BATCH_LIMIT까지 처리
+    void ProcessWork();
+    // inbox의 프레임을 순서대로 검증해 Task로 넘김
+    void ProcessInbox(const std::shared_ptr<ConnectionInbox>& inbox);
+    // 모아둔 Task 중 동시성 제한기를 통과한 것만 요청 큐에 한 번에 넣음 (거절되거나 넣지 못한 요청은 바로 실패 응답)
+    void FlushTasks(const std::shared_ptr<ConnectionInbox>& inbox, std::vector<Task>& tasks);
+    // 연결 해제 알림을 마지막 요청과 같은 샤드의 요청 큐에 넣음 (가득 차 있으면 false)
+    bool QueueDisconnect(const std::shared_ptr<ConnectionInbox>& inbox);
+    // 미뤄둔 연결 해제 알림을 다시 넣어 봄 (큐가 비워질 때까지 워커 스레드를 막지 않는다)
+    void RetryPendingDisconnects();
+    // 종료할 때 남은 연결 해제 알림을 DB 풀의 종료 정리로 넘김
+    void HandOverPendingDisconnects();
+    // 할 일이 없을 때 이벤트를 기다릴 시간 (미뤄둔 연결 해제 알림이나 거절 응답이 있으면 짧게)
+    int WaitTimeoutMs() const {
+        return _pending_disconnects.empty() && _deferred_handles.empty() ? WORKER_WAIT_TIMEOUT_MS : WORKER_RETRY_WAIT_MS;
+    }
+    // 요청을 처리하지 않고 실패 응답을 보낸 뒤 처리 중인 요청 수를 돌려놓음
+    // 응답은 afterRequest까지의 요청이 끝난 뒤에 나가도록 소유 워커가 붙잡아 둔다 (요청 순서대로 응답)
+    void RejectRequest(WorkerThread* owner, ConnectionHandle handle, EventType requestType, uint32_t requestId, uint32_t afterRequest);
+
+    // 연결 제거: 슬랩 반납 후 DB 스레드에 해제를 알리고 소켓을 닫는다 (이미 제거된 노드면 무시)
+    void RemoveClient(SocketNode* node);
+
+public:
+    // 빈 워커 생성 (서버 시작 시 고정 개수만큼 만들어 두고 AddClient로 연결을 배정)
+    WorkerThread(DatabasePool* dbPool, ConnectionSlab* connections, ConcurrencyLimiter* dbLimiter,
+        const ServerConfig& config = ServerConfig());
 
     ~WorkerThread();
 
-    void AddClient(SOCKET clientSocket);
+    // 슬랩에 빈 슬롯이 없으면 false (소켓은 호출자가 닫는다)
+    bool AddClient(SOCKET clientSocket);
     void StopThread();
+    // 스레드 종료까지 대기 (다른 워커가 이 워커의 덱을 훔쳐갈 수 있으므로 모두 Join한 뒤 해제해야 함)
+    void Join();
 
-    // 클라이언트에게 데이터 전송
-    bool SendToClient(SOCKET clientSocket, const std::vector<uint8_t>& data);
+    // work stealing 대상 워커 설정 (풀 생성 직후, Start() 전에 호출)
+    void SetPeers(const std::vector<WorkerThread*>& peers);
+    // 워커 스레드 시작
+    void Start();
+    // 다른 워커가 호출 - 덱 뒤쪽 작업 하나를 넘겨줌
+    bool TrySteal(std::shared_ptr<ConnectionInbox>& inbox);
+    inline bool IsIdle() const {
+        return _idle.load();
+    }
 
-    // 특정 소켓이 이 워커에 속하는지 확인
-    bool HasClient(SOCKET clientSocket) const;
+    // 클라이언트에게 데이터 전송 요청 (어느 스레드에서나 호출 가능, 실제 전송은 워커 스레드가 수행)
+    // 끊긴 연결(세대가 다른 핸들)로 가는 응답은 워커 스레드에서 버려진다
+    bool SendToClient(ConnectionHandle handle, const std::vector<uint8_t>& data);
+    // DB 스레드가 응답을 복사 없이 넘길 때 사용 (requestId는 응답한 요청 번호, 앞선 거절 응답보다 먼저 나가지 않는다)
+    bool SendToClient(ConnectionHandle handle, PacketBuffer data, uint32_t requestId = 0);
 
-    inline bool IsFullAccess() const {
-        return _client_count.load() >= MAX_CLIENT_COUNT;
-    }
+    // 요청 하나의 처리가 끝남 (DB 스레드 또는 요청을 버린 워커가 호출)
+    // 처리 중인 요청 수가 한도 아래로 내려가면 수신을 멈춘 연결을 소유 워커가 다시 읽게 한다
+    void ReleaseInFlight(ConnectionHandle handle);
+
+    // 특정 연결이 이 워커에 속하는지 확인 (슬랩 조회, O(1))
+    bool HasClient(ConnectionHandle handle) const;
 
     inline bool DoThread() const {
         return _do_thread.load();
@@ -67,4 +321,45 @@ public:
     inline int GetClientCount() const {
         return _client_count.load();
     }
+
+    inline uint64_t GetRejectedRequests() const {
+        return _rejected_requests.load();
+    }
+
+    inline uint64_t GetReadPauses() const {
+        return _read_pauses.load();
+    }
+
+    inline uint64_t GetRateLimitedFrames() const {
+        return _rate_limited_frames.load();
+    }
+
+    inline uint64_t GetRateLimitedRequests() const {
+        return _rate_limited_requests.load();
+    }
+
+    inline uint64_t GetRateLimitDisconnects() const {
+        return _rate_limit_disconnects.load();
+    }
+
+    inline uint64_t GetIdleTimeouts() const {
+        return _idle_timeouts.load();
+    }
+
+    inline uint64_t GetFrameTimeouts() const {
+        return _frame_timeouts.load();
+    }
+
+    inline uint64_t GetSendTimeouts() const {
+        return _send_timeouts.load();
+    }
+
+    inline double GetEventRate() const {
+        return _event_rate.load();
+    }
+
+    // 연결 배치용 부하 점수 (연결 수 + 최근 이벤트 처리량)
+    inline double GetLoadScore() const {
+        return _client_count.load() + _event_rate.load() * WORKER_LOAD_EVENT_WEIGHT;
+    }
 };
\ No newline at end of file
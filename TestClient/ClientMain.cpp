@@ -447,28 +447,42 @@ public:
 
         std::this_thread::sleep_for(std::chrono::milliseconds(200));
 
-        auto response = ReceivePacket();
-        if (response.empty()) {
-            return false;
-        }
+        // 목록이 길면 여러 조각으로 나눠 오므로 has_more가 false인 조각까지 모두 받는다
+        // (조각 버퍼를 모두 들고 있어야 앞 조각의 서버 항목 포인터가 유효하다)
+        std::vector<std::vector<uint8_t>> chunks;
+        std::vector<const GameServerData*> servers;
+        const S2C_GameServerList* listResponse = nullptr;
+        do {
+            chunks.push_back(ReceivePacket());
+            const std::vector<uint8_t>& response = chunks.back();
+            if (response.empty()) {
+                return false;
+            }
 
-        const S2C_GameServerList* listResponse = _packet_manager.ParseGameServerListResponse(response.data(), response.size());
-        if (!listResponse) {
-            std::cout << "[ERROR] Failed to parse game server list response" << std::endl;
-            return false;
-        }
+            listResponse = _packet_manager.ParseGameServerListResponse(response.data(), response.size());
+            if (!listResponse) {
+                std::cout << "[ERROR] Failed to parse game server list response" << std::endl;
+                return false;
+            }
 
+            if (listResponse->servers()) {
+                for (size_t i = 0; i < listResponse->servers()->size(); ++i) {
+                    servers.push_back(listResponse->servers()->Get(i));
+                }
+            }
+        } while (listResponse->has_more() && _packet_manager.IsGameServerListValid(listResponse));
+
+        // 마지막 조각의 결과가 전체 결과 (중간에 실패하면 FAIL로 끝난다)
         if (_packet_manager.IsGameServerListValid(listResponse)) {
-            std::cout << "[SUCCESS] Game server list retrieved successfully!" << std::endl;
+            std::cout << "[SUCCESS] Game server list retrieved successfully! (" << chunks.size() << " chunk(s))" << std::endl;
 
-            if (listResponse->servers() && listResponse->servers()->size() > 0) {
-                std::cout << "  Active Game Servers (" << listResponse->servers()->size() << " found):" << std::endl;
+            if (!servers.empty()) {
+                std::cout << "  Active Game Servers (" << servers.size() << " found):" << std::endl;
                 std::cout << "  " << std::string(80, '-') << std::endl;
                 std::cout << "  ID | Server Name           | Owner            | Players | IP:Port       | PWD" << std::endl;
                 std::cout << "  " << std::string(80, '-') << std::endl;
 
-                for (size_t i = 0; i < listResponse->servers()->size(); ++i) {
-                    const auto* server = listResponse->servers()->Get(i);
+                for (const GameServerData* server : servers) {
                     std::string owner_display = server->owner_nickname()->str() +
                         "(" + std::to_string(server->owner_user_id()).substr(0, 3) + "...)";
 
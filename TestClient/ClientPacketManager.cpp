@@ -41,7 +41,7 @@ bool ClientPacketManager::VerifyPacket(const uint8_t* data, size_t size)
     return VerifyDatabasePacketBuffer(verifier);
 }
 
-// === Ŭ̾Ʈ û Ŷ  (C2S) ===
+// === 클라이언트 요청 패킷 생성 (C2S) ===
 
 std::vector<uint8_t> ClientPacketManager::CreateLoginRequest(const std::string& username, const std::string& password)
 {
@@ -144,7 +144,7 @@ std::vector<uint8_t> ClientPacketManager::CreatePlayerDataQueryRequest(uint32_t
     try {
         flatbuffers::FlatBufferBuilder builder;
 
-        auto playerRequest = CreateC2S_PlayerData(builder, user_id, 0); // request_type = 0 (ȸ)
+        auto playerRequest = CreateC2S_PlayerData(builder, user_id, 0); // request_type = 0 (조회)
         auto packet = CreateDatabasePacket(builder, EventType_C2S_PlayerData, playerRequest.Union());
 
         builder.Finish(packet);
@@ -166,7 +166,7 @@ std::vector<uint8_t> ClientPacketManager::CreatePlayerDataUpdateRequest(uint32_t
     try {
         flatbuffers::FlatBufferBuilder builder;
 
-        auto playerRequest = CreateC2S_PlayerData(builder, user_id, 1, level, exp, hp, mp, pos_x, pos_y); // request_type = 1 (Ʈ)
+        auto playerRequest = CreateC2S_PlayerData(builder, user_id, 1, level, exp, hp, mp, pos_x, pos_y); // request_type = 1 (업데이트)
         auto packet = CreateDatabasePacket(builder, EventType_C2S_PlayerData, playerRequest.Union());
 
         builder.Finish(packet);
@@ -211,7 +211,7 @@ std::vector<uint8_t> ClientPacketManager::CreateChatSendRequest(uint32_t sender_
         flatbuffers::FlatBufferBuilder builder;
 
         auto messageOffset = builder.CreateString(message);
-        auto chatRequest = CreateC2S_PlayerChat(builder, 1, sender_id, receiver_id, messageOffset, chat_type); // request_type = 1 ()
+        auto chatRequest = CreateC2S_PlayerChat(builder, 1, sender_id, receiver_id, messageOffset, chat_type); // request_type = 1 (전송)
         auto packet = CreateDatabasePacket(builder, EventType_C2S_PlayerChat, chatRequest.Union());
 
         builder.Finish(packet);
@@ -233,7 +233,7 @@ std::vector<uint8_t> ClientPacketManager::CreateChatQueryRequest(uint32_t reques
     try {
         flatbuffers::FlatBufferBuilder builder;
 
-        auto chatRequest = CreateC2S_PlayerChat(builder, 0, sender_id, receiver_id, 0, chat_type); // request_type = 0 (ȸ)
+        auto chatRequest = CreateC2S_PlayerChat(builder, 0, sender_id, receiver_id, 0, chat_type); // request_type = 0 (조회)
         auto packet = CreateDatabasePacket(builder, EventType_C2S_PlayerChat, chatRequest.Union());
 
         builder.Finish(packet);
@@ -315,7 +315,7 @@ std::vector<uint8_t> ClientPacketManager::CreateShopTransactionRequest(uint32_t
     }
 }
 
-// ===   Ŷ Ľ (S2C) ===
+// === 서버 응답 패킷 파싱 (S2C) ===
 
 const S2C_Login* ClientPacketManager::ParseLoginResponse(const uint8_t* data, size_t size)
 {
@@ -467,7 +467,7 @@ const S2C_ShopTransaction* ClientPacketManager::ParseShopTransactionResponse(con
     return packet->packet_event_as_S2C_ShopTransaction();
 }
 
-// ===  Լ ===
+// === 편의 함수들 ===
 
 bool ClientPacketManager::IsLoginSuccess(const S2C_Login* response)
 {
@@ -504,7 +504,7 @@ bool ClientPacketManager::IsShopTransactionSuccess(const S2C_ShopTransaction* re
     return response && response->result() == ResultCode_SUCCESS;
 }
 
-// === ƿƼ Լ ===
+// === 유틸리티 함수들 ===
 
 EventType ClientPacketManager::GetPacketType(const uint8_t* data, size_t size)
 {
@@ -532,7 +532,7 @@ bool ClientPacketManager::IsValidPacket(const uint8_t* data, size_t size)
 }
 
 
-// ===    Ŭ̾Ʈ û Ŷ  (C2S) ===
+// === 게임 서버 관련 클라이언트 요청 패킷 생성 (C2S) ===
 
 std::vector<uint8_t> ClientPacketManager::CreateGameServerRequest(uint32_t user_id, const std::string& server_name,
     const std::string& server_password, const std::string& server_ip, uint32_t server_port, uint32_t max_players)
@@ -652,7 +652,7 @@ std::vector<uint8_t> ClientPacketManager::CreateSavePlayerDataRequest(uint32_t u
     }
 }
 
-// ===      Ŷ Ľ (S2C) ===
+// === 게임 서버 관련 서버 응답 패킷 파싱 (S2C) ===
 
 const S2C_CreateGameServer* ClientPacketManager::ParseCreateGameServerResponse(const uint8_t* data, size_t size)
 {
@@ -729,7 +729,7 @@ const S2C_SavePlayerData* ClientPacketManager::ParseSavePlayerDataResponse(const
     return packet->packet_event_as_S2C_SavePlayerData();
 }
 
-// ===     Լ ===
+// === 게임 서버 관련 편의 함수들 ===
 
 bool ClientPacketManager::IsCreateGameServerSuccess(const S2C_CreateGameServer* response)
 {
@@ -756,7 +756,7 @@ bool ClientPacketManager::IsSavePlayerDataSuccess(const S2C_SavePlayerData* resp
     return response && response->result() == ResultCode_SUCCESS;
 }
 
-// GetPacketTypeName ο ̽ ߰
+// GetPacketTypeName에도 새로운 케이스들 추가
 
 std::string ClientPacketManager::GetPacketTypeName(EventType packet_type)
 {
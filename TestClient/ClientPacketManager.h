@@ -4,7 +4,7 @@
 #include <string>
 #include <cstdint>
 
-//   (ߺ )
+// 전방 선언 (중복 방지)
 struct DatabasePacket;
 struct S2C_Login;
 struct S2C_Logout;
@@ -17,7 +17,7 @@ struct S2C_ShopList;
 struct S2C_ShopItems;
 struct S2C_ShopTransaction;
 
-//    ü ߰
+// 게임 서버 관련 구조체 추가
 struct S2C_CreateGameServer;
 struct S2C_GameServerList;
 struct S2C_JoinGameServer;
@@ -28,7 +28,7 @@ struct GameServerData;
 enum EventType : uint8_t;
 enum ResultCode : int8_t;
 
-// Ŭ̾Ʈ Ŷ Ŵ Ŭ
+// 클라이언트용 패킷 매니저 클래스
 class ClientPacketManager
 {
 private:
@@ -42,171 +42,171 @@ public:
     ClientPacketManager();
     ~ClientPacketManager();
 
-    // ===  Ŭ̾Ʈ û Ŷ  (C2S) ===
+    // === 기존 클라이언트 요청 패킷 생성 (C2S) ===
 
-    // α û
+    // 로그인 요청
     std::vector<uint8_t> CreateLoginRequest(const std::string& username, const std::string& password);
 
-    // α׾ƿ û
+    // 로그아웃 요청
     std::vector<uint8_t> CreateLogoutRequest(uint32_t user_id);
 
-    //   û
+    // 계정 생성 요청
     std::vector<uint8_t> CreateAccountRequest(const std::string& username, const std::string& password, const std::string& nickname);
 
-    //   û
+    // 아이템 데이터 요청
     std::vector<uint8_t> CreateItemDataRequest(uint32_t user_id, uint32_t request_type, uint32_t item_id = 0, uint32_t item_count = 0);
 
-    // ÷̾  û (ȸ)
+    // 플레이어 데이터 요청 (조회용)
     std::vector<uint8_t> CreatePlayerDataQueryRequest(uint32_t user_id);
 
-    // ÷̾  û (Ʈ)
+    // 플레이어 데이터 요청 (업데이트용)
     std::vector<uint8_t> CreatePlayerDataUpdateRequest(uint32_t user_id, uint32_t level, uint32_t exp,
         uint32_t hp, uint32_t mp, float pos_x, float pos_y);
 
-    //   û
+    // 몬스터 데이터 요청
     std::vector<uint8_t> CreateMonsterDataRequest(uint32_t request_type, uint32_t monster_id = 0);
 
-    // ä ޽  û
+    // 채팅 메시지 전송 요청
     std::vector<uint8_t> CreateChatSendRequest(uint32_t sender_id, uint32_t receiver_id, const std::string& message, uint32_t chat_type);
 
-    // ä ȸ û
+    // 채팅 조회 요청
     std::vector<uint8_t> CreateChatQueryRequest(uint32_t request_type, uint32_t sender_id, uint32_t receiver_id, uint32_t chat_type);
 
-    //   û
+    // 상점 목록 요청
     std::vector<uint8_t> CreateShopListRequest(uint32_t request_type = 0, uint32_t map_id = 0);
 
-    //    û
+    // 상점 아이템 목록 요청
     std::vector<uint8_t> CreateShopItemsRequest(uint32_t shop_id);
 
-    //  ŷ û (/Ǹ)
+    // 상점 거래 요청 (구매/판매)
     std::vector<uint8_t> CreateShopTransactionRequest(uint32_t user_id, uint32_t shop_id, uint32_t item_id, uint32_t item_count, uint32_t transaction_type);
 
-    // ===    Ŭ̾Ʈ û Ŷ  (C2S) ߰ ===
+    // === 게임 서버 관련 클라이언트 요청 패킷 생성 (C2S) 추가 ===
 
-    //    û
+    // 게임 서버 생성 요청
     std::vector<uint8_t> CreateGameServerRequest(uint32_t user_id, const std::string& server_name,
         const std::string& server_password, const std::string& server_ip, uint32_t server_port, uint32_t max_players = 10);
 
-    //    û
+    // 게임 서버 목록 요청
     std::vector<uint8_t> CreateGameServerListRequest(uint32_t request_type = 0);
 
-    //    û
+    // 게임 서버 접속 요청
     std::vector<uint8_t> CreateJoinGameServerRequest(uint32_t user_id, uint32_t server_id, const std::string& server_password = "");
 
-    //    û ( ڸ)
+    // 게임 서버 종료 요청 (서버 관리자만)
     std::vector<uint8_t> CreateCloseGameServerRequest(uint32_t user_id, uint32_t server_id);
 
-    // ÷̾   û ( )
+    // 플레이어 데이터 저장 요청 (월드 퇴장시)
     std::vector<uint8_t> CreateSavePlayerDataRequest(uint32_t user_id, uint32_t level, uint32_t exp,
         uint32_t hp, uint32_t mp, uint32_t gold, float pos_x, float pos_y);
 
-    // ===    Ŷ Ľ (S2C) ===
-    // FlatBuffers ü ͸  ȯ
+    // === 기존 서버 응답 패킷 파싱 (S2C) ===
+    // FlatBuffers 구조체 포인터를 직접 반환
 
-    // α  Ľ
+    // 로그인 응답 파싱
     const S2C_Login* ParseLoginResponse(const uint8_t* data, size_t size);
 
-    // α׾ƿ  Ľ
+    // 로그아웃 응답 파싱
     const S2C_Logout* ParseLogoutResponse(const uint8_t* data, size_t size);
 
-    //    Ľ
+    // 계정 생성 응답 파싱
     const S2C_CreateAccount* ParseCreateAccountResponse(const uint8_t* data, size_t size);
 
-    //    Ľ
+    // 아이템 데이터 응답 파싱
     const S2C_ItemData* ParseItemDataResponse(const uint8_t* data, size_t size);
 
-    // ÷̾   Ľ
+    // 플레이어 데이터 응답 파싱
     const S2C_PlayerData* ParsePlayerDataResponse(const uint8_t* data, size_t size);
 
-    //    Ľ
+    // 몬스터 데이터 응답 파싱
     const S2C_MonsterData* ParseMonsterDataResponse(const uint8_t* data, size_t size);
 
-    // ä  Ľ
+    // 채팅 응답 파싱
     const S2C_PlayerChat* ParsePlayerChatResponse(const uint8_t* data, size_t size);
 
-    //    Ľ
+    // 상점 목록 응답 파싱
     const S2C_ShopList* ParseShopListResponse(const uint8_t* data, size_t size);
 
-    //    Ľ
+    // 상점 아이템 응답 파싱
     const S2C_ShopItems* ParseShopItemsResponse(const uint8_t* data, size_t size);
 
-    //  ŷ  Ľ
+    // 상점 거래 응답 파싱
     const S2C_ShopTransaction* ParseShopTransactionResponse(const uint8_t* data, size_t size);
 
-    // ===      Ŷ Ľ (S2C) ߰ ===
+    // === 게임 서버 관련 서버 응답 패킷 파싱 (S2C) 추가 ===
 
-    //     Ľ
+    // 게임 서버 생성 응답 파싱
     const S2C_CreateGameServer* ParseCreateGameServerResponse(const uint8_t* data, size_t size);
 
-    //     Ľ
+    // 게임 서버 목록 응답 파싱
     const S2C_GameServerList* ParseGameServerListResponse(const uint8_t* data, size_t size);
 
-    //     Ľ
+    // 게임 서버 접속 응답 파싱
     const S2C_JoinGameServer* ParseJoinGameServerResponse(const uint8_t* data, size_t size);
 
-    //     Ľ
+    // 게임 서버 종료 응답 파싱
     const S2C_CloseGameServer* ParseCloseGameServerResponse(const uint8_t* data, size_t size);
 
-    // ÷̾    Ľ
+    // 플레이어 데이터 저장 응답 파싱
     const S2C_SavePlayerData* ParseSavePlayerDataResponse(const uint8_t* data, size_t size);
 
-    // ===  Լ ===
+    // === 편의 함수들 ===
 
-    // α  Ȯ
+    // 로그인 결과 확인
     bool IsLoginSuccess(const S2C_Login* response);
 
-    //    Ȯ
+    // 계정 생성 결과 확인
     bool IsCreateAccountSuccess(const S2C_CreateAccount* response);
 
-    // ÷̾  ȸ  Ȯ
+    // 플레이어 데이터 조회 성공 확인
     bool IsPlayerDataValid(const S2C_PlayerData* response);
 
-    //   ȸ  Ȯ
+    // 아이템 데이터 조회 성공 확인
     bool IsItemDataValid(const S2C_ItemData* response);
 
-    //   ȸ  Ȯ
+    // 상점 목록 조회 성공 확인
     bool IsShopListValid(const S2C_ShopList* response);
 
-    //   ȸ  Ȯ
+    // 상점 아이템 조회 성공 확인
     bool IsShopItemsValid(const S2C_ShopItems* response);
 
-    //  ŷ  Ȯ
+    // 상점 거래 성공 확인
     bool IsShopTransactionSuccess(const S2C_ShopTransaction* response);
 
-    // ===     Լ ߰ ===
+    // === 게임 서버 관련 편의 함수들 추가 ===
 
-    //     Ȯ
+    // 게임 서버 생성 성공 확인
     bool IsCreateGameServerSuccess(const S2C_CreateGameServer* response);
 
-    //    ȸ  Ȯ
+    // 게임 서버 목록 조회 성공 확인
     bool IsGameServerListValid(const S2C_GameServerList* response);
 
-    //     Ȯ
+    // 게임 서버 접속 성공 확인
     bool IsJoinGameServerSuccess(const S2C_JoinGameServer* response);
 
-    //     Ȯ
+    // 게임 서버 종료 성공 확인
     bool IsCloseGameServerSuccess(const S2C_CloseGameServer* response);
 
-    // ÷̾    Ȯ
+    // 플레이어 데이터 저장 성공 확인
     bool IsSavePlayerDataSuccess(const S2C_SavePlayerData* response);
 
-    // === ƿƼ Լ ===
+    // === 유틸리티 함수들 ===
 
-    // Ŷ Ÿ Ȯ (EventType enum ȯ)
+    // 패킷 타입 확인 (EventType enum 반환)
     EventType GetPacketType(const uint8_t* data, size_t size);
 
-    // Ŭ̾Ʈ   Ȯ
+    // 클라이언트 소켓 정보 확인
     uint32_t GetClientSocket(const uint8_t* data, size_t size);
 
-    // Ŷ 
+    // 패킷 검증
     bool IsValidPacket(const uint8_t* data, size_t size);
 
-    // Ŷ Ÿ ڿ ȯ ()
+    // 패킷 타입을 문자열로 변환 (디버깅용)
     std::string GetPacketTypeName(EventType packet_type);
 
-    //  ڵ带 ڿ ȯ ()
+    // 결과 코드를 문자열로 변환 (디버깅용)
     std::string GetResultCodeName(ResultCode result);
 
-    //  ޽ ȯ
+    // 에러 메시지 반환
     std::string GetLastError() const { return _last_error; }
 };
\ No newline at end of file